@@ -0,0 +1,39 @@
+#pragma once
+#include <LinearAlgebra/Matrix.hpp>
+
+namespace BenchmarkHelper
+{
+    /// <summary>
+    /// Linear congruential generator of values in [-1, 1], in steps of 1e-3, such that every run and platform
+    /// benchmarks the same matrices.
+    /// </summary>
+    class RandomGenerator
+    {
+    public:
+        explicit RandomGenerator(unsigned int seed) : m_state(seed) {}
+
+        double NextValue()
+        {
+            m_state = m_state * 1103515245u + 12345u;
+            return static_cast<double>((m_state >> 16) % 2001) / 1000.0 - 1.0;
+        }
+
+    private:
+        unsigned int m_state;
+    };
+
+    /// <summary>
+    /// Square matrix of which the entries are the values of RandomGenerator(seed), row by row.
+    /// </summary>
+    inline LinearAlgebra::Matrix<double> CreateRandomMatrix(const size_t size, const unsigned int seed)
+    {
+        RandomGenerator random(seed);
+        LinearAlgebra::Matrix<double> matrix(size, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+                matrix(i, j) = random.NextValue();
+        }
+        return matrix;
+    }
+}
@@ -0,0 +1,247 @@
+#include <Geometry/MeshGenerator.hpp>
+#include <Geometry/MeshHierarchy.hpp>
+#include <Geometry/MeshOrdering.hpp>
+#include <LinearAlgebra/AlgebraicMultigrid.hpp>
+#include <LinearAlgebra/ConjugateGradient.hpp>
+#include <LinearAlgebra/FactorizationBand.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/GeometricMultigrid.hpp>
+#include <LinearAlgebra/Preconditioners.hpp>
+#include <LinearAlgebra/SparseCholesky.hpp>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+
+// Preconditioned conjugate gradients versus dense PLU on the heat system M + dt * K of a P1 discretization of the unit
+// square, meshed by CreateRectangularMesh with n x n cells, with a lumped mass matrix M. The counter reports the
+// iterations to a relative residual of 1e-8. Run with --benchmark_filter=BM_Pcg to only run these benchmarks.
+
+static LinearAlgebra::SparseMatrix<double> AssembleHeatSystem(const Geometry::Mesh2D& mesh)
+{
+    const double dt = 1e-3;
+
+    std::vector<LinearAlgebra::SparseEntry<double>> entries;
+    for (const auto& element : mesh.Interior)
+    {
+        const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+        const Geometry::Vertex2F v0 = mesh.Vertices[element.I], v1 = mesh.Vertices[element.J], v2 = mesh.Vertices[element.K];
+        const double area = 0.5 * std::abs((v1.X - v0.X) * (v2.Y - v0.Y) - (v2.X - v0.X) * (v1.Y - v0.Y));
+
+        // Gradients of the barycentric coordinates are the rotated opposite edges over twice the area
+        const std::array<std::array<double, 2>, 3> gradients = {{{v1.Y - v2.Y, v2.X - v1.X}, {v2.Y - v0.Y, v0.X - v2.X}, {v0.Y - v1.Y, v1.X - v0.X}}};
+        for (size_t a = 0; a < 3; a++)
+        {
+            entries.push_back({indices[a], indices[a], area / 3});
+            for (size_t b = 0; b < 3; b++)
+            {
+                const double stiffness = (gradients[a][0] * gradients[b][0] + gradients[a][1] * gradients[b][1]) / (4 * area);
+                entries.push_back({indices[a], indices[b], dt * stiffness});
+            }
+        }
+    }
+    return LinearAlgebra::SparseMatrix<double>(mesh.Vertices.size(), mesh.Vertices.size(), entries);
+}
+
+static LinearAlgebra::SparseMatrix<double> CreateHeatSystem(const unsigned int cells)
+{
+    return AssembleHeatSystem(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), cells, cells));
+}
+
+static LinearAlgebra::ColumnVector<double> CreateRightHandSide(const size_t size)
+{
+    LinearAlgebra::ColumnVector<double> rhs(size);
+    for (size_t i = 0; i < size; i++)
+        rhs[i] = std::sin(0.1 * static_cast<double>(i));
+    return rhs;
+}
+
+template <typename P>
+static void RunPcg(benchmark::State& state, const std::function<P(const LinearAlgebra::SparseMatrix<double>&)>& createPreconditioner)
+{
+    const LinearAlgebra::SparseMatrix<double> matrix = CreateHeatSystem(static_cast<unsigned int>(state.range(0)));
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+    LinearAlgebra::ColumnVector<double> x(matrix.GetRowCount());
+    LinearAlgebra::Iterative::ConjugateGradientSolver<double> solver(matrix.GetRowCount());
+    LinearAlgebra::Iterative::IterativeReport report;
+
+    for (auto _ : state)
+    {
+        // The setup of the preconditioner is part of the solve
+        const P preconditioner = createPreconditioner(matrix);
+        x.Fill(0.0);
+        report = solver.Solve(matrix, rhs, x, preconditioner);
+        benchmark::DoNotOptimize(x.Data());
+    }
+
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+    state.counters["Iterations"] = static_cast<double>(report.Iterations);
+    if (!report.Converged)
+        state.SkipWithError("Not converged");
+}
+
+static void BM_PcgIdentity(benchmark::State& state)
+{
+    RunPcg<LinearAlgebra::Iterative::IdentityPreconditioner<double>>(state, [](const auto&)
+                                                                      { return LinearAlgebra::Iterative::IdentityPreconditioner<double>(); });
+}
+
+static void BM_PcgJacobi(benchmark::State& state)
+{
+    RunPcg<LinearAlgebra::Iterative::JacobiPreconditioner<double>>(state, [](const auto& matrix)
+                                                                    { return LinearAlgebra::Iterative::JacobiPreconditioner<double>(matrix); });
+}
+
+static void BM_PcgSsor(benchmark::State& state)
+{
+    RunPcg<LinearAlgebra::Iterative::SsorPreconditioner<double>>(state, [](const auto& matrix)
+                                                                  { return LinearAlgebra::Iterative::SsorPreconditioner<double>(matrix, 1.2); });
+}
+
+static void BM_PcgIncompleteCholesky(benchmark::State& state)
+{
+    RunPcg<LinearAlgebra::Iterative::IncompleteCholeskyPreconditioner<double>>(state, [](const auto& matrix)
+                                                                                { return LinearAlgebra::Iterative::IncompleteCholeskyPreconditioner<double>(matrix); });
+}
+
+// The hierarchy is built once, outside of the timed loop, as when it is reused across time steps. Its setup and the
+// time per V-cycle are reported as counters.
+static void BM_PcgAlgebraicMultigrid(benchmark::State& state)
+{
+    const LinearAlgebra::SparseMatrix<double> matrix = CreateHeatSystem(static_cast<unsigned int>(state.range(0)));
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+    LinearAlgebra::ColumnVector<double> x(matrix.GetRowCount());
+    LinearAlgebra::Iterative::ConjugateGradientSolver<double> solver(matrix.GetRowCount());
+    const LinearAlgebra::Iterative::AlgebraicMultigrid<double> multigrid(matrix);
+    LinearAlgebra::Iterative::IterativeReport report;
+
+    for (auto _ : state)
+    {
+        x.Fill(0.0);
+        report = solver.Solve(matrix, rhs, x, multigrid);
+        benchmark::DoNotOptimize(x.Data());
+    }
+
+    const LinearAlgebra::Iterative::MultigridStatistics& statistics = multigrid.GetStatistics();
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+    state.counters["Iterations"] = static_cast<double>(report.Iterations);
+    state.counters["Levels"] = static_cast<double>(statistics.LevelSizes.size());
+    state.counters["SetupMs"] = 1e3 * statistics.SetupSeconds;
+    state.counters["CycleMs"] = 1e3 * statistics.CycleSeconds / static_cast<double>(statistics.CycleCount);
+    if (!report.Converged)
+        state.SkipWithError("Not converged");
+}
+
+// The coarse levels are assembled on the coarser meshes, rather than formed as Galerkin products, since the lumped
+// mass matrix is not preserved by them.
+static void BM_PcgGeometricMultigrid(benchmark::State& state)
+{
+    const unsigned int cells = static_cast<unsigned int>(state.range(0));
+    const Geometry::RectangularMeshHierarchy hierarchy = Geometry::CreateRectangularMeshHierarchy(Geometry::Rectangle(0, 1, 0, 1), cells, cells);
+    std::vector<LinearAlgebra::SparseMatrix<double>> operators;
+    std::vector<LinearAlgebra::SparseMatrix<double>> prolongations;
+    for (const Geometry::Mesh2D& mesh : hierarchy.Meshes)
+        operators.push_back(AssembleHeatSystem(mesh));
+    for (const LinearAlgebra::SparseMatrix<float>& prolongation : hierarchy.Prolongations)
+        prolongations.push_back(LinearAlgebra::ConvertSparseMatrix<double>(prolongation));
+
+    const LinearAlgebra::SparseMatrix<double>& matrix = operators[0];
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+    LinearAlgebra::ColumnVector<double> x(matrix.GetRowCount());
+    LinearAlgebra::Iterative::ConjugateGradientSolver<double> solver(matrix.GetRowCount());
+    const LinearAlgebra::Iterative::GeometricMultigrid<double> multigrid(operators, prolongations);
+    LinearAlgebra::Iterative::IterativeReport report;
+
+    for (auto _ : state)
+    {
+        x.Fill(0.0);
+        report = solver.Solve(matrix, rhs, x, multigrid);
+        benchmark::DoNotOptimize(x.Data());
+    }
+
+    const LinearAlgebra::Iterative::MultigridStatistics& statistics = multigrid.GetStatistics();
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+    state.counters["Iterations"] = static_cast<double>(report.Iterations);
+    state.counters["Levels"] = static_cast<double>(statistics.LevelSizes.size());
+    state.counters["SetupMs"] = 1e3 * statistics.SetupSeconds;
+    state.counters["CycleMs"] = 1e3 * statistics.CycleSeconds / static_cast<double>(statistics.CycleCount);
+    if (!report.Converged)
+        state.SkipWithError("Not converged");
+}
+
+static void BM_PcgDenseLUSolve(benchmark::State& state)
+{
+    const LinearAlgebra::SparseMatrix<double> sparse = CreateHeatSystem(static_cast<unsigned int>(state.range(0)));
+    const LinearAlgebra::Matrix<double> matrix = sparse.ToMatrix();
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::ColumnVector<double> x = LinearAlgebra::Factorization::LUSolve(matrix, rhs, 1e-12);
+        benchmark::DoNotOptimize(x.Data());
+    }
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+}
+
+// The direct solve for comparison, the numeric factorization reuses the symbolic analysis, as for a new time step
+// size. The second argument selects the nested dissection: 0 on the graph of the matrix, 1 by the mesh coordinates.
+static void BM_SparseCholeskySolve(benchmark::State& state)
+{
+    const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), static_cast<unsigned int>(state.range(0)),
+                                                                  static_cast<unsigned int>(state.range(0)));
+    const LinearAlgebra::SparseMatrix<double> matrix = AssembleHeatSystem(mesh);
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+
+    const auto start = std::chrono::steady_clock::now();
+    LinearAlgebra::Factorization::SparseCholeskyAnalysis analysis =
+        state.range(1) == 0 ? LinearAlgebra::Factorization::SparseCholeskyAnalysis(matrix)
+                            : LinearAlgebra::Factorization::SparseCholeskyAnalysis(matrix, LinearAlgebra::Ordering::NestedDissection(matrix, mesh.Vertices));
+    const double analysisSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LinearAlgebra::Factorization::SparseCholeskyFactorization<double> cholesky(std::move(analysis), matrix, 1e-14);
+
+    for (auto _ : state)
+    {
+        cholesky.Factorize(matrix);
+        LinearAlgebra::ColumnVector<double> x = cholesky.Solve(rhs);
+        benchmark::DoNotOptimize(x.Data());
+    }
+
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+    state.counters["FactorNonZeros"] = static_cast<double>(cholesky.GetAnalysis().GetFactorNonZeroCount());
+    state.counters["Supernodes"] = static_cast<double>(cholesky.GetAnalysis().GetSupernodeCount());
+    state.counters["AnalysisMs"] = 1e3 * analysisSeconds;
+}
+
+// Banded Cholesky on the mesh numbered by reverse Cuthill-McKee, of which the band is about n. Costs O(n^4) for the
+// n^2 unknowns, thus only competitive with the sparse Cholesky on small or elongated meshes.
+static void BM_BandCholeskySolve(benchmark::State& state)
+{
+    Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), static_cast<unsigned int>(state.range(0)),
+                                                            static_cast<unsigned int>(state.range(0)));
+    Geometry::ReorderMesh(mesh, Geometry::VertexOrdering::ReverseCuthillMcKee);
+    const LinearAlgebra::SparseMatrix<double> matrix = AssembleHeatSystem(mesh);
+    const LinearAlgebra::ColumnVector<double> rhs = CreateRightHandSide(matrix.GetRowCount());
+
+    size_t bandwidth = 0;
+    for (auto _ : state)
+    {
+        LinearAlgebra::Factorization::BandCholeskyFactorization<double> cholesky(matrix, 1e-14);
+        LinearAlgebra::ColumnVector<double> x = cholesky.Solve(rhs);
+        benchmark::DoNotOptimize(x.Data());
+        bandwidth = cholesky.GetFactor().GetLowerBandwidth();
+    }
+
+    state.counters["Unknowns"] = static_cast<double>(matrix.GetRowCount());
+    state.counters["Bandwidth"] = static_cast<double>(bandwidth);
+}
+
+BENCHMARK(BM_PcgIdentity)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgJacobi)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgSsor)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgIncompleteCholesky)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgAlgebraicMultigrid)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgGeometricMultigrid)->RangeMultiplier(2)->Range(16, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PcgDenseLUSolve)->RangeMultiplier(2)->Range(16, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SparseCholeskySolve)->ArgsProduct({benchmark::CreateRange(16, 512, 2), {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BandCholeskySolve)->RangeMultiplier(2)->Range(16, 256)->Unit(benchmark::kMillisecond);
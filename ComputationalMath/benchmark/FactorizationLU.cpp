@@ -0,0 +1,65 @@
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelper.hpp"
+
+// Unblocked versus blocked PLU factorization for sizes 128 to 8192.
+// Run with --benchmark_filter=BM_Plu to only run these benchmarks.
+
+static void SetPluCounters(benchmark::State& state, const size_t size)
+{
+    state.counters["FLOPS"] = benchmark::Counter(2.0 / 3.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void BM_PluUnblocked(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    const LinearAlgebra::Matrix<double> matrix = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Factorization::FactorizationResult<double> result = LinearAlgebra::Factorization::UnblockedPluFactorization(matrix, 1e-12);
+        benchmark::DoNotOptimize(result.Factorization.Data());
+    }
+    SetPluCounters(state, size);
+}
+
+static void BM_PluBlocked(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    const LinearAlgebra::Matrix<double> matrix = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Factorization::FactorizationResult<double> result = LinearAlgebra::Factorization::BlockedPluFactorization(matrix, 1e-12, state.range(1));
+        benchmark::DoNotOptimize(result.Factorization.Data());
+    }
+    SetPluCounters(state, size);
+}
+
+BENCHMARK(BM_PluUnblocked)->RangeMultiplier(2)->Range(128, 8192)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PluBlocked)->ArgsProduct({benchmark::CreateRange(128, 8192, 2), {32, 64, 128}})->Unit(benchmark::kMillisecond);
+
+// Triangular solve of a size x size factor with size right-hand sides, as in InverseMatrix.
+// Run with --benchmark_filter=BM_Trsm to only run these benchmarks.
+
+static void BM_TrsmMultipleRightHandSides(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    LinearAlgebra::Matrix<double> factor = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+    for (size_t i = 0; i < size; i++)
+    {
+        factor(i, i) += static_cast<double>(size);
+    }
+    const LinearAlgebra::Matrix<double> rhs = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Matrix<double> solution(rhs);
+        LinearAlgebra::Factorization::BackwardSubstitutionInPlace(factor, solution);
+        benchmark::DoNotOptimize(solution.Data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(static_cast<double>(size) * size * size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(BM_TrsmMultipleRightHandSides)->RangeMultiplier(2)->Range(128, 2048)->Unit(benchmark::kMillisecond);
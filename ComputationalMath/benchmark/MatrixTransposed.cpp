@@ -70,12 +70,14 @@ static void Transpose2(const LinearAlgebra::Matrix<T>& mat, LinearAlgebra::Matri
 
     size_t rowCount = mat.GetRowCount();
     size_t columnCount = mat.GetColumnCount();
+    size_t srcStride = mat.GetLeadingDimension();
+    size_t dstStride = output.GetLeadingDimension();
 
     for (size_t i = 0; i < rowCount; i++)
     {
         for (size_t j = 0; j < columnCount; j++)
         {
-            dst[j * rowCount + i] = src[i * columnCount + j];
+            dst[j * dstStride + i] = src[i * srcStride + j];
         }
     }
 }
@@ -88,6 +90,8 @@ static void Transpose3(const LinearAlgebra::Matrix<T>& mat, LinearAlgebra::Matri
 
     size_t rowCount = mat.GetRowCount();
     size_t columnCount = mat.GetColumnCount();
+    size_t srcStride = mat.GetLeadingDimension();
+    size_t dstStride = output.GetLeadingDimension();
     size_t block = 32;
     for (size_t i = 0; i < rowCount; i += block)
     {
@@ -95,7 +99,7 @@ static void Transpose3(const LinearAlgebra::Matrix<T>& mat, LinearAlgebra::Matri
         {
             for (size_t k = 0; k < block && i + k < rowCount; ++k)
             {
-                dst[j * rowCount + i + k] = src[(i + k) * columnCount + j];
+                dst[j * dstStride + i + k] = src[(i + k) * srcStride + j];
             }
         }
     }
@@ -0,0 +1,43 @@
+#include <LinearAlgebra/FactorizationOutOfCore.hpp>
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelper.hpp"
+
+// Out-of-core PLU factorization over a memory-mapped temporary file, for sizes 1024 to 8192 and tile sizes 128 to 512.
+// The counters report the tile traffic of the schedule per floating point operation, which is the I/O intensity
+// once the matrix exceeds the memory. Run with --benchmark_filter=BM_OutOfCore to only run these benchmarks.
+
+static void FillBenchmarkMatrix(LinearAlgebra::OutOfCoreMatrix<double>& matrix)
+{
+    BenchmarkHelper::RandomGenerator random(12345);
+    for (size_t j = 0; j < matrix.GetSize(); j++)
+    {
+        for (size_t i = 0; i < matrix.GetSize(); i++)
+            matrix(i, j) = random.NextValue();
+    }
+}
+
+static void BM_OutOfCorePlu(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    const size_t tileSize = state.range(1);
+    LinearAlgebra::Factorization::OutOfCoreStatistics statistics;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LinearAlgebra::OutOfCoreMatrix<double> matrix(size, tileSize);
+        FillBenchmarkMatrix(matrix);
+        state.ResumeTiming();
+
+        LinearAlgebra::Factorization::OutOfCoreLUFactorization<double> factorization(std::move(matrix), 1e-12);
+        statistics = factorization.GetStatistics();
+        benchmark::DoNotOptimize(factorization.GetFactorization().Strip(0));
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(statistics.Flops, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["ReadBytesPerFlop"] = static_cast<double>(statistics.BytesRead) / statistics.Flops;
+    state.counters["WrittenBytesPerFlop"] = static_cast<double>(statistics.BytesWritten) / statistics.Flops;
+}
+
+BENCHMARK(BM_OutOfCorePlu)->ArgsProduct({benchmark::CreateRange(1024, 8192, 2), {128, 256, 512}})->Unit(benchmark::kMillisecond)->Iterations(1);
@@ -0,0 +1,73 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/ThreadPool.hpp>
+#include <benchmark/benchmark.h>
+#include <thread>
+
+// Scaling of the parallel GEMM and GEMV over the number of threads, for sizes 256 to 8192.
+// Run with --benchmark_filter=BM_Parallel to only run these benchmarks.
+
+static void ThreadScalingArguments(benchmark::internal::Benchmark* benchmark)
+{
+    const int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int size = 1 << 8; size <= 1 << 13; size <<= 1)
+    {
+        for (int threads = 1; threads < maxThreads; threads <<= 1)
+        {
+            benchmark->Args({size, threads});
+        }
+        benchmark->Args({size, maxThreads});
+    }
+}
+
+static void BM_ParallelGemm(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    LinearAlgebra::Parallel::SetThreadCount(state.range(1));
+
+    LinearAlgebra::Matrix<float> lhs(size, size);
+    LinearAlgebra::Matrix<float> rhs(size, size);
+    LinearAlgebra::Matrix<float> product(size, size);
+    lhs.Fill(1.0f);
+    rhs.Fill(2.0f);
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Gemm(1.0f, lhs, rhs, 0.0f, product);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+    LinearAlgebra::Parallel::SetThreadCount(0);
+}
+
+static void BM_ParallelGemv(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    LinearAlgebra::Parallel::SetThreadCount(state.range(1));
+
+    LinearAlgebra::Matrix<float> matrix(size, size);
+    LinearAlgebra::ColumnVector<float> vector(size);
+    matrix.Fill(1.0f);
+    vector.Fill(2.0f);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(matrix * vector);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["Bandwidth"] = benchmark::Counter(sizeof(float) * size * size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1024);
+    LinearAlgebra::Parallel::SetThreadCount(0);
+}
+
+BENCHMARK(BM_ParallelGemm)
+    ->Apply(ThreadScalingArguments)
+    ->ArgNames({"size", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_ParallelGemv)
+    ->Apply(ThreadScalingArguments)
+    ->ArgNames({"size", "threads"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,89 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SimdOps.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
+#include <benchmark/benchmark.h>
+
+// Sparse matrix-vector products with the 5-point Laplacian of a grid, about 5 nonzeros per row as a P1 FEM matrix.
+// BM_SpmvScalar restricts the gathers to scalar loads, BM_DenseGemv multiplies the same matrix stored densely.
+// The counter reports the bytes of the matrix, x and y streamed per second.
+
+template <typename T>
+static LinearAlgebra::SparseMatrix<T> CreateBenchmarkLaplacian(const size_t size)
+{
+    std::vector<LinearAlgebra::SparseEntry<T>> entries;
+    for (size_t i = 0; i < size; i++)
+    {
+        for (size_t j = 0; j < size; j++)
+        {
+            const LinearAlgebra::SparseIndex row = static_cast<LinearAlgebra::SparseIndex>(i * size + j);
+            entries.push_back({row, row, T(4)});
+            if (i > 0)
+                entries.push_back({row, static_cast<LinearAlgebra::SparseIndex>(row - size), T(-1)});
+            if (i + 1 < size)
+                entries.push_back({row, static_cast<LinearAlgebra::SparseIndex>(row + size), T(-1)});
+            if (j > 0)
+                entries.push_back({row, row - 1, T(-1)});
+            if (j + 1 < size)
+                entries.push_back({row, row + 1, T(-1)});
+        }
+    }
+    return LinearAlgebra::SparseMatrix<T>(size * size, size * size, entries);
+}
+
+template <typename T>
+static void RunSpmv(benchmark::State& state)
+{
+    const LinearAlgebra::SparseMatrix<T> matrix = CreateBenchmarkLaplacian<T>(state.range(0));
+    LinearAlgebra::ColumnVector<T> x(matrix.GetColumnCount());
+    x.Fill(T(1));
+    LinearAlgebra::ColumnVector<T> y(matrix.GetRowCount());
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Spmv(T(1), matrix, x, T(0), y);
+        benchmark::DoNotOptimize(y.Data());
+        benchmark::ClobberMemory();
+    }
+
+    const double bytes = static_cast<double>(matrix.GetNonZeroCount() * (sizeof(T) + sizeof(LinearAlgebra::SparseIndex)) +
+                                             matrix.GetRowCount() * (sizeof(LinearAlgebra::SparseIndex) + 2 * sizeof(T)));
+    state.counters["Bandwidth"] = benchmark::Counter(bytes, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1024);
+}
+
+static void BM_Spmv(benchmark::State& state)
+{
+    RunSpmv<double>(state);
+}
+
+static void BM_SpmvFloat(benchmark::State& state)
+{
+    RunSpmv<float>(state);
+}
+
+static void BM_SpmvScalar(benchmark::State& state)
+{
+    const LinearAlgebra::SimdOps::InstructionSet previous = LinearAlgebra::SimdOps::GetInstructionSet();
+    LinearAlgebra::SimdOps::SetInstructionSet(LinearAlgebra::SimdOps::InstructionSet::Scalar);
+    RunSpmv<double>(state);
+    LinearAlgebra::SimdOps::SetInstructionSet(previous);
+}
+
+static void BM_DenseGemv(benchmark::State& state)
+{
+    const LinearAlgebra::Matrix<double> matrix = CreateBenchmarkLaplacian<double>(state.range(0)).ToMatrix();
+    LinearAlgebra::ColumnVector<double> x(matrix.GetColumnCount());
+    x.Fill(1.0);
+    LinearAlgebra::ColumnVector<double> y(matrix.GetRowCount());
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Gemv(1.0, matrix, x, 0.0, y);
+        benchmark::DoNotOptimize(y.Data());
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_Spmv)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SpmvFloat)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SpmvScalar)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DenseGemv)->RangeMultiplier(2)->Range(16, 64)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,74 @@
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/ThreadPool.hpp>
+#include <benchmark/benchmark.h>
+#include <thread>
+
+#include "BenchmarkHelper.hpp"
+
+// Scaling of the blocked and the tiled PLU factorization over the number of threads, for sizes 512 to 4096.
+// Run with --benchmark_filter=BM_Scaling to only run these benchmarks. The counters of BM_ScalingTiledPlu are taken
+// from the task profile of the last iteration: Busy is the fraction of thread time spent in tasks, CriticalPath the
+// fraction of the wall time on the critical path and CriticalPathWait the fraction of the critical path spent waiting
+// for a free thread.
+
+static void LuThreadScalingArguments(benchmark::internal::Benchmark* benchmark)
+{
+    const int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (int size = 1 << 9; size <= 1 << 12; size <<= 1)
+    {
+        for (int threads = 1; threads < maxThreads; threads <<= 1)
+        {
+            benchmark->Args({size, threads});
+        }
+        benchmark->Args({size, maxThreads});
+    }
+}
+
+static void BM_ScalingBlockedPlu(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    LinearAlgebra::Parallel::SetThreadCount(state.range(1));
+    const LinearAlgebra::Matrix<double> matrix = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+
+    for (auto _ : state)
+    {
+        LinearAlgebra::Factorization::FactorizationResult<double> result = LinearAlgebra::Factorization::BlockedPluFactorization(matrix, 1e-12);
+        benchmark::DoNotOptimize(result.Factorization.Data());
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(2.0 / 3.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+    LinearAlgebra::Parallel::SetThreadCount(0);
+}
+
+static void BM_ScalingTiledPlu(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    const size_t threads = state.range(1);
+    LinearAlgebra::Parallel::SetThreadCount(threads);
+    const LinearAlgebra::Matrix<double> matrix = BenchmarkHelper::CreateRandomMatrix(size, 12345);
+
+    LinearAlgebra::TaskGraphProfile profile;
+    for (auto _ : state)
+    {
+        LinearAlgebra::Factorization::FactorizationResult<double> result = LinearAlgebra::Factorization::TiledPluFactorization(matrix, 1e-12, LinearAlgebra::Factorization::LuBlocking<double>::TileSize, &profile);
+        benchmark::DoNotOptimize(result.Factorization.Data());
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(2.0 / 3.0 * size * size * size, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["Busy"] = profile.BusySeconds / (threads * profile.WallSeconds);
+    state.counters["CriticalPath"] = profile.CriticalPathSeconds / profile.WallSeconds;
+    state.counters["CriticalPathWait"] = profile.CriticalPathWaitSeconds / profile.CriticalPathSeconds;
+    LinearAlgebra::Parallel::SetThreadCount(0);
+}
+
+BENCHMARK(BM_ScalingBlockedPlu)
+    ->Apply(LuThreadScalingArguments)
+    ->ArgNames({"size", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_ScalingTiledPlu)
+    ->Apply(LuThreadScalingArguments)
+    ->ArgNames({"size", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
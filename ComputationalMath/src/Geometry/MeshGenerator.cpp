@@ -1,5 +1,6 @@
 #include "MeshGenerator.hpp"
 
+#include "Geometry/MeshOrdering.hpp"
 #include "Geometry/RefinedDelaunay.hpp"
 #include "Geometry/Structures/Mesh2D.hpp"
 #include "Geometry/Structures/PlanarStraightLineGraph.hpp"
@@ -28,7 +29,11 @@ namespace Geometry
         delaunay.InsertPoint(Vertex2F(cx - 0.1, cy));
         delaunay.InsertPoint(Vertex2F(cx, cy - 0.1));
         delaunay.Refine(25);
-        return delaunay.ToMesh();
+
+        // The refinement inserts the vertices in no spatial order, which scatters the rows of the FEM matrices
+        Mesh2D mesh = delaunay.ToMesh();
+        ReorderMesh(mesh, VertexOrdering::ReverseCuthillMcKee);
+        return mesh;
     }
 
     Mesh2D CreateRectangularMesh(const Rectangle& rect, const unsigned int nx, const unsigned int ny)
@@ -0,0 +1,69 @@
+#include "MeshHierarchy.hpp"
+
+#include "Geometry/MeshGenerator.hpp"
+#include <stdexcept>
+
+namespace Geometry
+{
+    RectangularMeshHierarchy CreateRectangularMeshHierarchy(const Rectangle& rect, unsigned int nx, unsigned int ny, const unsigned int minCells)
+    {
+        if (nx == 0 || ny == 0)
+            throw std::invalid_argument("Mesh should have at least one cell");
+
+        RectangularMeshHierarchy hierarchy;
+        hierarchy.Bounds = rect;
+        hierarchy.CellCountsX.push_back(nx);
+        hierarchy.CellCountsY.push_back(ny);
+        hierarchy.Meshes.push_back(CreateRectangularMesh(rect, nx, ny));
+
+        while (nx % 2 == 0 && ny % 2 == 0 && nx / 2 >= minCells && ny / 2 >= minCells)
+        {
+            nx /= 2;
+            ny /= 2;
+            hierarchy.CellCountsX.push_back(nx);
+            hierarchy.CellCountsY.push_back(ny);
+            hierarchy.Meshes.push_back(CreateRectangularMesh(rect, nx, ny));
+            hierarchy.Prolongations.push_back(CreateRectangularProlongation(nx, ny));
+        }
+        return hierarchy;
+    }
+
+    LinearAlgebra::SparseMatrix<float> CreateRectangularProlongation(const unsigned int nx, const unsigned int ny)
+    {
+        const unsigned int fineNx = 2 * nx, fineNy = 2 * ny;
+        const auto coarseIndex = [nx](const unsigned int i, const unsigned int j)
+        { return static_cast<LinearAlgebra::SparseIndex>(i + (nx + 1) * j); };
+
+        std::vector<LinearAlgebra::SparseEntry<float>> entries;
+        entries.reserve(2 * (fineNx + 1) * (fineNy + 1));
+        for (unsigned int j = 0; j <= fineNy; j++)
+        {
+            for (unsigned int i = 0; i <= fineNx; i++)
+            {
+                const auto fine = static_cast<LinearAlgebra::SparseIndex>(i + (fineNx + 1) * j);
+                const unsigned int ci = i / 2, cj = j / 2;
+                if (i % 2 == 0 && j % 2 == 0)
+                {
+                    entries.push_back({fine, coarseIndex(ci, cj), 1.0f});
+                }
+                else if (j % 2 == 0)
+                {
+                    entries.push_back({fine, coarseIndex(ci, cj), 0.5f});
+                    entries.push_back({fine, coarseIndex(ci + 1, cj), 0.5f});
+                }
+                else if (i % 2 == 0)
+                {
+                    entries.push_back({fine, coarseIndex(ci, cj), 0.5f});
+                    entries.push_back({fine, coarseIndex(ci, cj + 1), 0.5f});
+                }
+                else
+                {
+                    // The cells are split along the diagonal from corner (i, j) to (i + 1, j + 1)
+                    entries.push_back({fine, coarseIndex(ci, cj), 0.5f});
+                    entries.push_back({fine, coarseIndex(ci + 1, cj + 1), 0.5f});
+                }
+            }
+        }
+        return LinearAlgebra::SparseMatrix<float>((fineNx + 1) * (fineNy + 1), (nx + 1) * (ny + 1), entries);
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "Geometry/Structures/Mesh2D.hpp"
+#include "Geometry/Structures/Rectangle.hpp"
+#include "LinearAlgebra/SparseMatrix.hpp"
+
+#include <vector>
+
+namespace Geometry
+{
+    /// <summary>
+    /// Nested rectangular meshes, as CreateRectangularMesh creates them, finest first. Every coarser mesh has half
+    /// the cells in both directions, and Prolongations[l] interpolates the P1 functions of mesh l + 1 on mesh l.
+    /// </summary>
+    struct RectangularMeshHierarchy
+    {
+        Rectangle Bounds;
+        std::vector<unsigned int> CellCountsX;
+        std::vector<unsigned int> CellCountsY;
+        std::vector<Mesh2D> Meshes;
+        std::vector<LinearAlgebra::SparseMatrix<float>> Prolongations;
+    };
+
+    /// <summary>
+    /// Halves the nx x ny mesh as long as both cell counts are even, and the coarser mesh keeps at least minCells
+    /// cells in both directions.
+    /// </summary>
+    RectangularMeshHierarchy CreateRectangularMeshHierarchy(const Rectangle& rect, unsigned int nx, unsigned int ny, unsigned int minCells = 2);
+
+    /// <summary>
+    /// Interpolation of the P1 functions on the coarse nx x ny rectangular mesh to the 2nx x 2ny mesh. The fine
+    /// vertices at coarse vertices take their value, those at the midpoints of coarse edges, including the cell
+    /// diagonals, the mean of both ends.
+    /// </summary>
+    LinearAlgebra::SparseMatrix<float> CreateRectangularProlongation(unsigned int nx, unsigned int ny);
+}
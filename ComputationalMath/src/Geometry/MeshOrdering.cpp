@@ -0,0 +1,229 @@
+#include "MeshOrdering.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+namespace Geometry
+{
+    namespace
+    {
+        constexpr unsigned int Unvisited = std::numeric_limits<unsigned int>::max();
+
+        std::vector<std::vector<unsigned int>> CreateVertexAdjacency(const Mesh2D& mesh)
+        {
+            std::vector<std::vector<unsigned int>> adjacency(mesh.Vertices.size());
+            const auto connect = [&adjacency](const unsigned int a, const unsigned int b)
+            {
+                adjacency[a].push_back(b);
+                adjacency[b].push_back(a);
+            };
+            for (const TriangleElement& element : mesh.Interior)
+            {
+                connect(element.I, element.J);
+                connect(element.J, element.K);
+                connect(element.K, element.I);
+            }
+            for (const LineElement& element : mesh.Boundary)
+                connect(element.I, element.J);
+
+            for (std::vector<unsigned int>& neighbors : adjacency)
+            {
+                std::sort(neighbors.begin(), neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+            }
+            return adjacency;
+        }
+
+        /// <summary>
+        /// Breadth first search from root over the unvisited vertices, with the neighbors of every vertex in order of
+        /// increasing degree. Appends the vertices to order and returns the vertex of least degree in the last level.
+        /// </summary>
+        unsigned int AppendLevelOrder(const std::vector<std::vector<unsigned int>>& adjacency, const unsigned int root,
+                                      std::vector<unsigned int>& level, std::vector<unsigned int>& order)
+        {
+            const size_t begin = order.size();
+            order.push_back(root);
+            level[root] = 0;
+            std::vector<unsigned int> neighbors;
+            for (size_t head = begin; head < order.size(); head++)
+            {
+                const unsigned int vertex = order[head];
+                neighbors.clear();
+                for (const unsigned int neighbor : adjacency[vertex])
+                {
+                    if (level[neighbor] == Unvisited)
+                    {
+                        level[neighbor] = level[vertex] + 1;
+                        neighbors.push_back(neighbor);
+                    }
+                }
+                std::stable_sort(neighbors.begin(), neighbors.end(), [&adjacency](const unsigned int a, const unsigned int b)
+                                 { return adjacency[a].size() < adjacency[b].size(); });
+                order.insert(order.end(), neighbors.begin(), neighbors.end());
+            }
+
+            // The last level is contiguous at the end of the order, its vertex of least degree is the candidate
+            const unsigned int lastLevel = level[order.back()];
+            unsigned int candidate = order.back();
+            for (size_t k = order.size(); k-- > begin && level[order[k]] == lastLevel;)
+            {
+                if (adjacency[order[k]].size() <= adjacency[candidate].size())
+                    candidate = order[k];
+            }
+            return candidate;
+        }
+
+        std::vector<unsigned int> ReverseCuthillMcKee(const Mesh2D& mesh)
+        {
+            const std::vector<std::vector<unsigned int>> adjacency = CreateVertexAdjacency(mesh);
+            const size_t size = adjacency.size();
+            std::vector<unsigned int> level(size, Unvisited);
+            std::vector<unsigned int> order;
+            order.reserve(size);
+
+            for (unsigned int start = 0; start < size; start++)
+            {
+                if (level[start] != Unvisited)
+                    continue;
+
+                // George and Liu: restart from the end of the deepest level, as long as the number of levels grows
+                const size_t begin = order.size();
+                unsigned int candidate = AppendLevelOrder(adjacency, start, level, order);
+                unsigned int depth = level[order.back()];
+                while (true)
+                {
+                    for (size_t k = begin; k < order.size(); k++)
+                        level[order[k]] = Unvisited;
+                    order.resize(begin);
+
+                    const unsigned int next = AppendLevelOrder(adjacency, candidate, level, order);
+                    if (level[order.back()] <= depth)
+                        break;
+
+                    candidate = next;
+                    depth = level[order.back()];
+                }
+            }
+
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+        /// <summary>
+        /// Index of (x, y) along the Hilbert curve through the 2^16 x 2^16 grid.
+        /// </summary>
+        uint64_t HilbertIndex(uint32_t x, uint32_t y)
+        {
+            constexpr uint32_t side = 1u << 16;
+            uint64_t index = 0;
+            for (uint32_t s = side / 2; s > 0; s /= 2)
+            {
+                const uint32_t rx = (x & s) > 0 ? 1 : 0;
+                const uint32_t ry = (y & s) > 0 ? 1 : 0;
+                index += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+
+                // Rotate the quadrant, such that the curve in it starts and ends as the curve in the whole grid
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = side - 1 - x;
+                        y = side - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return index;
+        }
+
+        std::vector<unsigned int> HilbertOrder(const Mesh2D& mesh)
+        {
+            const size_t size = mesh.Vertices.size();
+            std::vector<unsigned int> order(size);
+            if (size == 0)
+                return order;
+
+            float minX = mesh.Vertices[0].X, maxX = minX, minY = mesh.Vertices[0].Y, maxY = minY;
+            for (const Vertex2F& vertex : mesh.Vertices)
+            {
+                minX = std::min(minX, vertex.X);
+                maxX = std::max(maxX, vertex.X);
+                minY = std::min(minY, vertex.Y);
+                maxY = std::max(maxY, vertex.Y);
+            }
+
+            // The same scale in both directions keeps the curve local in elongated domains
+            const double extent = std::max(maxX - minX, maxY - minY);
+            const double scale = extent > 0 ? static_cast<double>((1u << 16) - 1) / extent : 0.0;
+            std::vector<std::pair<uint64_t, unsigned int>> keys(size);
+            for (unsigned int i = 0; i < size; i++)
+            {
+                const uint32_t x = static_cast<uint32_t>((mesh.Vertices[i].X - minX) * scale);
+                const uint32_t y = static_cast<uint32_t>((mesh.Vertices[i].Y - minY) * scale);
+                keys[i] = {HilbertIndex(x, y), i};
+            }
+            std::sort(keys.begin(), keys.end());
+            for (size_t i = 0; i < size; i++)
+                order[i] = keys[i].second;
+            return order;
+        }
+    }
+
+    std::vector<unsigned int> ReorderMesh(Mesh2D& mesh, const VertexOrdering ordering)
+    {
+        std::vector<unsigned int> permutation;
+        switch (ordering)
+        {
+        case VertexOrdering::ReverseCuthillMcKee:
+            permutation = ReverseCuthillMcKee(mesh);
+            break;
+        case VertexOrdering::Hilbert:
+            permutation = HilbertOrder(mesh);
+            break;
+        default:
+            throw std::invalid_argument("Unknown vertex ordering");
+        }
+
+        std::vector<unsigned int> inverse(permutation.size());
+        std::vector<Vertex2F> vertices(permutation.size());
+        for (unsigned int i = 0; i < permutation.size(); i++)
+        {
+            inverse[permutation[i]] = i;
+            vertices[i] = mesh.Vertices[permutation[i]];
+        }
+        mesh.Vertices = std::move(vertices);
+
+        for (TriangleElement& element : mesh.Interior)
+        {
+            element = TriangleElement(inverse[element.I], inverse[element.J], inverse[element.K]);
+            if (element.J < element.I && element.J < element.K)
+                element = TriangleElement(element.J, element.K, element.I);
+            else if (element.K < element.I && element.K < element.J)
+                element = TriangleElement(element.K, element.I, element.J);
+        }
+        std::sort(mesh.Interior.begin(), mesh.Interior.end(), [](const TriangleElement& a, const TriangleElement& b)
+                  { return std::tie(a.I, a.J, a.K) < std::tie(b.I, b.J, b.K); });
+
+        // Boundary elements keep their direction, which orients the boundary
+        for (LineElement& element : mesh.Boundary)
+            element = LineElement(inverse[element.I], inverse[element.J]);
+        std::sort(mesh.Boundary.begin(), mesh.Boundary.end(), [](const LineElement& a, const LineElement& b)
+                  { return std::tie(a.I, a.J) < std::tie(b.I, b.J); });
+
+        return permutation;
+    }
+
+    unsigned int GetMeshBandwidth(const Mesh2D& mesh)
+    {
+        const auto distance = [](const unsigned int a, const unsigned int b) { return a > b ? a - b : b - a; };
+        unsigned int bandwidth = 0;
+        for (const TriangleElement& element : mesh.Interior)
+            bandwidth = std::max({bandwidth, distance(element.I, element.J), distance(element.J, element.K), distance(element.K, element.I)});
+        for (const LineElement& element : mesh.Boundary)
+            bandwidth = std::max(bandwidth, distance(element.I, element.J));
+        return bandwidth;
+    }
+}
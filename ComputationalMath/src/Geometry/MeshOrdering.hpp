@@ -0,0 +1,38 @@
+#pragma once
+#include "Geometry/Structures/Mesh2D.hpp"
+
+#include <vector>
+
+namespace Geometry
+{
+    enum class VertexOrdering
+    {
+        /// <summary>
+        /// Breadth first from a pseudo-peripheral vertex, neighbors by increasing degree, reversed. Minimizes the
+        /// bandwidth of the FEM matrices, which suits banded and skyline solvers.
+        /// </summary>
+        ReverseCuthillMcKee,
+
+        /// <summary>
+        /// Along a Hilbert curve through the bounding box. Vertices close in the plane are close in memory, which
+        /// suits the gathers and scatters of assembly and SpMV, but not banded solvers.
+        /// </summary>
+        Hilbert
+    };
+
+    /// <summary>
+    /// Renumbers the vertices of mesh in place, and remaps the Interior and Boundary elements to them. Every triangle
+    /// is rotated to start at its lowest vertex, which keeps its orientation, and the elements are sorted by their
+    /// first vertex, such that the elements are traversed in the vertex order.
+    ///
+    /// Returns the permutation, permutation[i] is the original index of vertex i, thus a solution u on the reordered
+    /// mesh maps back by original[permutation[i]] = u[i]. Data indexed by the vertices, such as the prolongations of a
+    /// RectangularMeshHierarchy, are not remapped.
+    /// </summary>
+    std::vector<unsigned int> ReorderMesh(Mesh2D& mesh, VertexOrdering ordering);
+
+    /// <summary>
+    /// Largest |i - j| of the vertices i and j of an element of mesh, the half bandwidth of its FEM matrices.
+    /// </summary>
+    unsigned int GetMeshBandwidth(const Mesh2D& mesh);
+}
@@ -0,0 +1,262 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Multigrid.hpp"
+#include "SparseMatrix.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    struct AlgebraicMultigridSettings
+    {
+        /// <summary>
+        /// a_ij is a strong connection when |a_ij| >= StrengthThreshold * sqrt(|a_ii a_jj|).
+        /// </summary>
+        double StrengthThreshold = 0.08;
+
+        /// <summary>
+        /// Coarsening stops once a level has at most MaxCoarseSize rows, which are solved by a dense PLU.
+        /// </summary>
+        size_t MaxCoarseSize = 256;
+        size_t MaxLevels = 12;
+
+        /// <summary>
+        /// The tentative prolongator is smoothed by one damped Jacobi step with weight ProlongatorDamping / rho(D^-1 A).
+        /// </summary>
+        double ProlongatorDamping = 4.0 / 3.0;
+
+        MultigridSmoother Smoother = MultigridSmoother::GaussSeidel;
+        double JacobiWeight = 2.0 / 3.0;
+        size_t ChebyshevDegree = 3;
+        size_t PreSmoothingSteps = 1;
+        size_t PostSmoothingSteps = 1;
+    };
+
+    /// <summary>
+    /// Smoothed aggregation algebraic multigrid. The setup aggregates the strongly connected unknowns of every level,
+    /// builds the tentative prolongator that interpolates the constant vector exactly, smooths it with damped Jacobi,
+    /// and forms the Galerkin coarse operator R A P with R = P^T. Suited for the M-matrix-like operators of elliptic
+    /// problems, such as FEM stiffness and M + dt K matrices, for which a V-cycle reduces the error by a factor that
+    /// does not depend on the mesh size. The V-cycle itself is that of MultigridHierarchy.
+    /// </summary>
+    template <typename T>
+    class AlgebraicMultigrid : public MultigridHierarchy<T>
+    {
+    public:
+        explicit AlgebraicMultigrid(const SparseMatrix<T>& matrix, AlgebraicMultigridSettings settings = {});
+
+        const AlgebraicMultigridSettings& GetSettings() const { return m_settings; }
+
+    private:
+        static MultigridCycleSettings CycleSettings(const AlgebraicMultigridSettings& settings)
+        {
+            return {settings.Smoother, settings.JacobiWeight, settings.ChebyshevDegree, settings.PreSmoothingSteps, settings.PostSmoothingSteps};
+        }
+
+    private:
+        AlgebraicMultigridSettings m_settings;
+    };
+
+    namespace Multigrid
+    {
+        constexpr SparseIndex Unaggregated = std::numeric_limits<SparseIndex>::max();
+
+        /// <summary>
+        /// Strong off-diagonal connections of every row, in CSR format with sorted columns.
+        /// </summary>
+        struct StrengthGraph
+        {
+            std::vector<SparseIndex> RowOffsets;
+            std::vector<SparseIndex> ColumnIndices;
+        };
+
+        template <typename T>
+        StrengthGraph CreateStrengthGraph(const SparseMatrix<T>& matrix, const std::vector<T>& inverseDiagonal, const double threshold)
+        {
+            StrengthGraph graph;
+            graph.RowOffsets.assign(matrix.GetRowCount() + 1, 0);
+            graph.ColumnIndices.reserve(matrix.GetNonZeroCount());
+            for (size_t i = 0; i < matrix.GetRowCount(); i++)
+            {
+                for (size_t k = matrix.RowOffsets()[i]; k < matrix.RowOffsets()[i + 1]; k++)
+                {
+                    // |a_ij|^2 >= threshold^2 |a_ii a_jj|, without the square root
+                    const size_t j = matrix.ColumnIndices()[k];
+                    const double value = static_cast<double>(matrix.Values()[k]);
+                    const double scale = std::abs(1.0 / static_cast<double>(inverseDiagonal[i] * inverseDiagonal[j]));
+                    if (j != i && value * value >= threshold * threshold * scale)
+                        graph.ColumnIndices.push_back(static_cast<SparseIndex>(j));
+                }
+                graph.RowOffsets[i + 1] = static_cast<SparseIndex>(graph.ColumnIndices.size());
+            }
+
+            // Keep the mutual connections only, which changes nothing for symmetric A, but isolates the rows of
+            // essential boundary conditions that other rows still couple to
+            StrengthGraph symmetric;
+            symmetric.RowOffsets.assign(graph.RowOffsets.size(), 0);
+            symmetric.ColumnIndices.reserve(graph.ColumnIndices.size());
+            for (size_t i = 0; i + 1 < graph.RowOffsets.size(); i++)
+            {
+                for (size_t k = graph.RowOffsets[i]; k < graph.RowOffsets[i + 1]; k++)
+                {
+                    const SparseIndex j = graph.ColumnIndices[k];
+                    const auto begin = graph.ColumnIndices.begin() + graph.RowOffsets[j];
+                    const auto end = graph.ColumnIndices.begin() + graph.RowOffsets[j + 1];
+                    if (std::binary_search(begin, end, static_cast<SparseIndex>(i)))
+                        symmetric.ColumnIndices.push_back(j);
+                }
+                symmetric.RowOffsets[i + 1] = static_cast<SparseIndex>(symmetric.ColumnIndices.size());
+            }
+            return symmetric;
+        }
+
+        /// <summary>
+        /// Standard aggregation: first aggregates of a node and all of its strong neighbors, when none of them is
+        /// aggregated yet, then the remaining nodes join an aggregate of a neighbor, and the rest form aggregates with
+        /// their unaggregated neighbors. Nodes without strong connections, such as Dirichlet rows, stay Unaggregated.
+        /// Returns the aggregate of every node, and the aggregate count.
+        /// </summary>
+        inline size_t Aggregate(const StrengthGraph& graph, std::vector<SparseIndex>& aggregates)
+        {
+            const size_t n = graph.RowOffsets.size() - 1;
+            aggregates.assign(n, Unaggregated);
+            SparseIndex count = 0;
+
+            for (size_t i = 0; i < n; i++)
+            {
+                const size_t begin = graph.RowOffsets[i], end = graph.RowOffsets[i + 1];
+                if (aggregates[i] != Unaggregated || begin == end)
+                    continue;
+                bool free = true;
+                for (size_t k = begin; k < end && free; k++)
+                    free = aggregates[graph.ColumnIndices[k]] == Unaggregated;
+                if (!free)
+                    continue;
+
+                aggregates[i] = count;
+                for (size_t k = begin; k < end; k++)
+                    aggregates[graph.ColumnIndices[k]] = count;
+                count++;
+            }
+
+            // Join the aggregates of the first pass only, such that no chains of joined nodes grow
+            const std::vector<SparseIndex> firstPass = aggregates;
+            for (size_t i = 0; i < n; i++)
+            {
+                if (aggregates[i] != Unaggregated)
+                    continue;
+                for (size_t k = graph.RowOffsets[i]; k < graph.RowOffsets[i + 1]; k++)
+                {
+                    if (firstPass[graph.ColumnIndices[k]] != Unaggregated)
+                    {
+                        aggregates[i] = firstPass[graph.ColumnIndices[k]];
+                        break;
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < n; i++)
+            {
+                const size_t begin = graph.RowOffsets[i], end = graph.RowOffsets[i + 1];
+                if (aggregates[i] != Unaggregated || begin == end)
+                    continue;
+                aggregates[i] = count;
+                for (size_t k = begin; k < end; k++)
+                {
+                    if (aggregates[graph.ColumnIndices[k]] == Unaggregated)
+                        aggregates[graph.ColumnIndices[k]] = count;
+                }
+                count++;
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// Tentative prolongator, T(i, a) = b_i / |b_a|_2 for node i in aggregate a, which interpolates the near null
+        /// space vector b exactly with the coarse vector of the norms |b_a|_2, returned in coarseNullSpace.
+        /// </summary>
+        template <typename T>
+        SparseMatrix<T> CreateTentativeProlongator(const std::vector<SparseIndex>& aggregates, const size_t aggregateCount,
+                                                   const std::vector<T>& nullSpace, std::vector<T>& coarseNullSpace)
+        {
+            const size_t n = aggregates.size();
+            coarseNullSpace.assign(aggregateCount, T(0));
+            for (size_t i = 0; i < n; i++)
+            {
+                if (aggregates[i] != Unaggregated)
+                    coarseNullSpace[aggregates[i]] += nullSpace[i] * nullSpace[i];
+            }
+            for (T& norm : coarseNullSpace)
+                norm = std::sqrt(norm);
+
+            std::vector<SparseIndex> rowOffsets(n + 1, 0);
+            std::vector<SparseIndex> columnIndices;
+            std::vector<T> values;
+            columnIndices.reserve(n);
+            values.reserve(n);
+            for (size_t i = 0; i < n; i++)
+            {
+                if (aggregates[i] != Unaggregated)
+                {
+                    columnIndices.push_back(aggregates[i]);
+                    values.push_back(nullSpace[i] / coarseNullSpace[aggregates[i]]);
+                }
+                rowOffsets[i + 1] = static_cast<SparseIndex>(columnIndices.size());
+            }
+            return SparseMatrix<T>(n, aggregateCount, std::move(rowOffsets), std::move(columnIndices), std::move(values));
+        }
+
+        /// <summary>
+        /// P = (I - omega D^-1 A) T. Every nonzero of T lies on the pattern of A T, as A stores its diagonal.
+        /// </summary>
+        template <typename T>
+        SparseMatrix<T> SmoothProlongator(const SparseMatrix<T>& matrix, const std::vector<T>& inverseDiagonal, const SparseMatrix<T>& tentative,
+                                          const T omega)
+        {
+            SparseMatrix<T> prolongator = matrix * tentative;
+            T* values = prolongator.Values();
+            for (size_t i = 0; i < prolongator.GetRowCount(); i++)
+            {
+                const T scale = -omega * inverseDiagonal[i];
+                for (size_t k = prolongator.RowOffsets()[i]; k < prolongator.RowOffsets()[i + 1]; k++)
+                    values[k] *= scale;
+                for (size_t k = tentative.RowOffsets()[i]; k < tentative.RowOffsets()[i + 1]; k++)
+                    values[prolongator.FindIndex(i, tentative.ColumnIndices()[k])] += tentative.Values()[k];
+            }
+            return prolongator;
+        }
+    }
+
+    template <typename T>
+    AlgebraicMultigrid<T>::AlgebraicMultigrid(const SparseMatrix<T>& matrix, const AlgebraicMultigridSettings settings)
+        : MultigridHierarchy<T>(matrix, CycleSettings(settings)), m_settings(settings)
+    {
+        if (settings.MaxLevels == 0)
+            throw std::invalid_argument("Hierarchy should have at least one level");
+
+        std::vector<T> nullSpace(matrix.GetRowCount(), T(1));
+        std::vector<T> coarseNullSpace;
+        std::vector<SparseIndex> aggregates;
+
+        while (this->GetLevelCount() < settings.MaxLevels && this->GetCoarsestLevel().Operator.GetRowCount() > settings.MaxCoarseSize)
+        {
+            const SparseMatrix<T>& A = this->GetCoarsestLevel().Operator;
+            const std::vector<T>& inverseDiagonal = this->GetCoarsestLevel().InverseDiagonal;
+
+            const Multigrid::StrengthGraph graph = Multigrid::CreateStrengthGraph(A, inverseDiagonal, settings.StrengthThreshold);
+            const size_t aggregateCount = Multigrid::Aggregate(graph, aggregates);
+            if (aggregateCount == 0 || aggregateCount == A.GetRowCount())
+                break; // No strong connections left to coarsen
+
+            const SparseMatrix<T> tentative = Multigrid::CreateTentativeProlongator(aggregates, aggregateCount, nullSpace, coarseNullSpace);
+            const double radius = this->GetCoarsestLevel().SpectralRadius;
+            const T omega = static_cast<T>(radius > 0.0 ? settings.ProlongatorDamping / radius : 0.0);
+            this->AddGalerkinLevel(Multigrid::SmoothProlongator(A, inverseDiagonal, tentative, omega));
+            std::swap(nullSpace, coarseNullSpace);
+        }
+        this->Finalize();
+    }
+}
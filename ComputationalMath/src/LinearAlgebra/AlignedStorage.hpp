@@ -0,0 +1,107 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace LinearAlgebra
+{
+    // Alignment of matrix and vector storage in bytes, one cache line, which also covers AVX-512 loads
+    constexpr size_t CacheLineSize = 64;
+
+    /// <summary>
+    /// Storage layout of Matrix and VectorBase per element type, specialize to opt a type in or out.
+    /// Alignment is the alignment in bytes of the first element, the allocation is padded to a multiple of it.
+    /// With PadRows, matrix rows of at least Alignment bytes are padded to a multiple of Alignment bytes, such that
+    /// every row starts aligned. Shorter rows stay packed, to not blow up small matrices.
+    /// Padding elements are zero initialized and kept zero by all Matrix and VectorBase operations.
+    /// </summary>
+    template <typename T>
+    struct StorageTraits
+    {
+        static constexpr size_t Alignment = std::max(alignof(T), CacheLineSize);
+        static constexpr bool PadRows = false;
+    };
+
+    template <>
+    struct StorageTraits<float>
+    {
+        static constexpr size_t Alignment = CacheLineSize;
+        static constexpr bool PadRows = true;
+    };
+
+    template <>
+    struct StorageTraits<double>
+    {
+        static constexpr size_t Alignment = CacheLineSize;
+        static constexpr bool PadRows = true;
+    };
+
+    /// <summary>
+    /// Length rounded up such that length elements fill a multiple of the alignment.
+    /// </summary>
+    template <typename T>
+    constexpr size_t PaddedLength(const size_t length)
+    {
+        constexpr size_t alignment = StorageTraits<T>::Alignment;
+        if constexpr (alignment % sizeof(T) != 0)
+            return length;
+
+        constexpr size_t elementsPerAlignment = alignment / sizeof(T);
+        return (length + elementsPerAlignment - 1) / elementsPerAlignment * elementsPerAlignment;
+    }
+
+    /// <summary>
+    /// Distance between consecutive rows of a matrix with columnCount columns, see StorageTraits.
+    /// </summary>
+    template <typename T>
+    constexpr size_t LeadingDimension(const size_t columnCount)
+    {
+        if constexpr (!StorageTraits<T>::PadRows)
+            return columnCount;
+
+        if (columnCount * sizeof(T) < StorageTraits<T>::Alignment)
+            return columnCount;
+        return PaddedLength<T>(columnCount);
+    }
+
+    /// <summary>
+    /// Allocates storage for length elements, aligned as in StorageTraits<T>. The elements are default initialized,
+    /// like new T[length], the padding up to PaddedLength<T>(length) is value initialized.
+    /// </summary>
+    template <typename T>
+    std::shared_ptr<T[]> AllocateStorage(const size_t length)
+    {
+        if (length == 0)
+            return nullptr;
+
+        constexpr std::align_val_t alignment{StorageTraits<T>::Alignment};
+        const size_t capacity = PaddedLength<T>(length);
+        T* data = static_cast<T*>(::operator new(capacity * sizeof(T), alignment));
+        try
+        {
+            std::uninitialized_default_construct_n(data, length);
+        }
+        catch (...)
+        {
+            ::operator delete(data, alignment);
+            throw;
+        }
+
+        try
+        {
+            std::uninitialized_value_construct_n(data + length, capacity - length);
+        }
+        catch (...)
+        {
+            std::destroy_n(data, length);
+            ::operator delete(data, alignment);
+            throw;
+        }
+
+        return std::shared_ptr<T[]>(data, [capacity](T* pointer)
+                                    {
+                                        std::destroy_n(pointer, capacity);
+                                        ::operator delete(pointer, std::align_val_t{StorageTraits<T>::Alignment}); });
+    }
+}
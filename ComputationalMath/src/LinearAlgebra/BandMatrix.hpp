@@ -0,0 +1,200 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Blas1.hpp"
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Square matrix of which only the band of LowerBandwidth diagonals below and UpperBandwidth diagonals above the
+    /// diagonal is stored, in size * (LowerBandwidth + UpperBandwidth + 1) elements. The band is stored row-major:
+    /// row i holds the columns i - LowerBandwidth to i + UpperBandwidth contiguously, the positions of the first and
+    /// last rows outside of the matrix are zero padding. Thus the rows of a band are contiguous, as in Matrix, and
+    /// row operations are Axpy and Dot on them.
+    ///
+    /// The FEM matrices of a mesh numbered by ReverseCuthillMcKee have a band of about the shortest extent of the mesh
+    /// in elements, and the banded factorizations cost O(n b^2), rather than the O(n^3) of a dense factorization.
+    /// </summary>
+    template <typename T>
+    class BandMatrix
+    {
+    public:
+        BandMatrix();
+
+        /// <summary>
+        /// Zero initialized band matrix of size x size.
+        /// </summary>
+        BandMatrix(size_t size, size_t lowerBandwidth, size_t upperBandwidth);
+
+        /// <summary>
+        /// Band matrix of a square sparse matrix, with the smallest band that contains its sparsity pattern.
+        /// </summary>
+        explicit BandMatrix(const SparseMatrix<T>& matrix);
+
+        /// <summary>
+        /// Band matrix of a square sparse matrix, with a band of at least lowerBandwidth and upperBandwidth, e.g. to
+        /// reserve the fill of a factorization.
+        /// </summary>
+        BandMatrix(const SparseMatrix<T>& matrix, size_t lowerBandwidth, size_t upperBandwidth);
+
+        size_t GetSize() const { return m_size; }
+        size_t GetLowerBandwidth() const { return m_lowerBandwidth; }
+        size_t GetUpperBandwidth() const { return m_upperBandwidth; }
+
+        /// <summary>
+        /// Number of stored elements of a row, LowerBandwidth + UpperBandwidth + 1.
+        /// </summary>
+        size_t GetRowWidth() const { return m_lowerBandwidth + m_upperBandwidth + 1; }
+
+        bool IsInBand(const size_t row, const size_t column) const
+        {
+            return column + m_lowerBandwidth >= row && column <= row + m_upperBandwidth;
+        }
+
+        /// <summary>
+        /// Pointer to element (row, column) of the band, of which the elements of the row up to column
+        /// row + UpperBandwidth follow contiguously.
+        /// </summary>
+        T* At(const size_t row, const size_t column) { return m_values.data() + row * GetRowWidth() + column + m_lowerBandwidth - row; }
+        const T* At(const size_t row, const size_t column) const { return m_values.data() + row * GetRowWidth() + column + m_lowerBandwidth - row; }
+
+        T* Data() { return m_values.data(); }
+        const T* Data() const { return m_values.data(); }
+
+        /// <summary>
+        /// Element (row, column), which should be in the band.
+        /// </summary>
+        T& operator()(size_t row, size_t column);
+
+        /// <summary>
+        /// Element (row, column), zero outside of the band.
+        /// </summary>
+        T operator()(size_t row, size_t column) const;
+
+        ColumnVector<T> operator*(const ColumnVector<T>& vector) const;
+
+        Matrix<T> ToMatrix() const;
+
+    private:
+        size_t m_size;
+        size_t m_lowerBandwidth;
+        size_t m_upperBandwidth;
+        std::vector<T> m_values;
+    };
+
+    /// <summary>
+    /// Lower and upper bandwidth of a sparse matrix, the largest i - j and j - i of its sparsity pattern.
+    /// </summary>
+    template <typename T>
+    std::pair<size_t, size_t> GetBandwidths(const SparseMatrix<T>& matrix)
+    {
+        size_t lower = 0;
+        size_t upper = 0;
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            const SparseIndex* columns = matrix.ColumnIndices();
+            const size_t begin = matrix.RowOffsets()[i];
+            const size_t end = matrix.RowOffsets()[i + 1];
+            if (begin == end)
+                continue;
+
+            // The columns of a row are increasing, thus the first and last are the farthest from the diagonal
+            if (columns[begin] < i)
+                lower = std::max<size_t>(lower, i - columns[begin]);
+            if (columns[end - 1] > i)
+                upper = std::max<size_t>(upper, columns[end - 1] - i);
+        }
+        return {lower, upper};
+    }
+
+    template <typename T>
+    BandMatrix<T>::BandMatrix()
+        : BandMatrix(0, 0, 0)
+    {
+    }
+
+    template <typename T>
+    BandMatrix<T>::BandMatrix(const size_t size, const size_t lowerBandwidth, const size_t upperBandwidth)
+        : m_size(size), m_lowerBandwidth(lowerBandwidth), m_upperBandwidth(upperBandwidth)
+    {
+        if (m_size != 0 && GetRowWidth() > std::numeric_limits<size_t>::max() / m_size)
+            throw std::overflow_error("Band size overflow");
+        m_values.assign(m_size * GetRowWidth(), T(0));
+    }
+
+    template <typename T>
+    BandMatrix<T>::BandMatrix(const SparseMatrix<T>& matrix)
+        : BandMatrix(matrix, 0, 0)
+    {
+    }
+
+    template <typename T>
+    BandMatrix<T>::BandMatrix(const SparseMatrix<T>& matrix, const size_t lowerBandwidth, const size_t upperBandwidth)
+        : m_size(0), m_lowerBandwidth(0), m_upperBandwidth(0)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        const auto [lower, upper] = GetBandwidths(matrix);
+        *this = BandMatrix(matrix.GetRowCount(), std::max(lower, lowerBandwidth), std::max(upper, upperBandwidth));
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t k = matrix.RowOffsets()[i]; k < matrix.RowOffsets()[i + 1]; k++)
+                *At(i, matrix.ColumnIndices()[k]) = matrix.Values()[k];
+        }
+    }
+
+    template <typename T>
+    T& BandMatrix<T>::operator()(const size_t row, const size_t column)
+    {
+        if (row >= m_size || column >= m_size || !IsInBand(row, column))
+            throw std::out_of_range("Element outside of the band");
+        return *At(row, column);
+    }
+
+    template <typename T>
+    T BandMatrix<T>::operator()(const size_t row, const size_t column) const
+    {
+        if (row >= m_size || column >= m_size)
+            throw std::out_of_range("Index out of range");
+        return IsInBand(row, column) ? *At(row, column) : T(0);
+    }
+
+    template <typename T>
+    ColumnVector<T> BandMatrix<T>::operator*(const ColumnVector<T>& vector) const
+    {
+        if (m_size != vector.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+
+        ColumnVector<T> result(m_size);
+        for (size_t i = 0; i < m_size; i++)
+        {
+            const size_t first = i > m_lowerBandwidth ? i - m_lowerBandwidth : 0;
+            const size_t last = std::min(m_size - 1, i + m_upperBandwidth);
+            result[i] = Blas::Dot(last - first + 1, At(i, first), vector.Data() + first);
+        }
+        return result;
+    }
+
+    template <typename T>
+    Matrix<T> BandMatrix<T>::ToMatrix() const
+    {
+        Matrix<T> matrix(m_size, m_size);
+        matrix.Fill(T(0));
+        for (size_t i = 0; i < m_size; i++)
+        {
+            const size_t first = i > m_lowerBandwidth ? i - m_lowerBandwidth : 0;
+            const size_t last = std::min(m_size - 1, i + m_upperBandwidth);
+            for (size_t j = first; j <= last; j++)
+                matrix(i, j) = *At(i, j);
+        }
+        return matrix;
+    }
+}
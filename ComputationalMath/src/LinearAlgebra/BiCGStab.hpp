@@ -0,0 +1,164 @@
+#pragma once
+#include <utility>
+
+#include "IterativeSettings.hpp"
+#include "Preconditioners.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Right-preconditioned BiCGStab for general non-singular A. Unlike GMRES its memory does not grow with the
+    /// iteration count, but the residual does not decrease monotonically. An iteration costs two SpMVs, two
+    /// applications of the preconditioner, and is counted once, also when it stops halfway. The work vectors are
+    /// allocated once, at construction.
+    /// </summary>
+    template <typename T>
+    class BiCGStabSolver
+    {
+    public:
+        explicit BiCGStabSolver(size_t size, IterativeSettings settings = {});
+
+        const IterativeSettings& GetSettings() const { return m_settings; }
+
+        /// <summary>
+        /// Solves A x = b, starting from the initial guess in x. Convergence of the recursive residual is confirmed
+        /// by the true residual, which restarts the iteration when they differ.
+        /// </summary>
+        template <Preconditioner<T> P>
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner);
+
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x)
+        {
+            return Solve(A, b, x, IdentityPreconditioner<T>());
+        }
+
+    private:
+        IterativeSettings m_settings;
+        ColumnVector<T> m_residual;
+        ColumnVector<T> m_shadowResidual;
+        ColumnVector<T> m_direction;
+        ColumnVector<T> m_preconditionedDirection;
+        ColumnVector<T> m_directionProduct;
+        ColumnVector<T> m_preconditionedResidual;
+        ColumnVector<T> m_residualProduct;
+    };
+
+    template <typename T>
+    BiCGStabSolver<T>::BiCGStabSolver(const size_t size, const IterativeSettings settings)
+        : m_settings(settings), m_residual(size), m_shadowResidual(size), m_direction(size), m_preconditionedDirection(size),
+          m_directionProduct(size), m_preconditionedResidual(size), m_residualProduct(size)
+    {
+    }
+
+    template <typename T>
+    template <Preconditioner<T> P>
+    IterativeReport BiCGStabSolver<T>::Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner)
+    {
+        AssertSolverDimensions(m_residual.GetLength(), A, b, x);
+
+        IterativeReport report;
+        report.ResidualNorms.reserve(m_settings.MaxIterations + 1);
+
+        const double rhsNorm = static_cast<double>(b.Norm2());
+        if (rhsNorm == 0.0)
+        {
+            x.Fill(T(0));
+            report.ResidualNorms.push_back(0.0);
+            report.Converged = true;
+            return report;
+        }
+
+        m_residual = b;
+        Spmv(T(-1), A, x, T(1), m_residual);
+        report.ResidualNorms.push_back(static_cast<double>(m_residual.Norm2()) / rhsNorm);
+        report.Converged = report.ResidualNorms.back() <= m_settings.Tolerance;
+
+        bool restart = true;
+        T rho = T(1), alpha = T(1), omega = T(1);
+        while (!report.Converged && report.Iterations < m_settings.MaxIterations)
+        {
+            if (restart)
+            {
+                m_shadowResidual = m_residual;
+                m_direction = m_residual;
+                rho = m_shadowResidual.Dot(m_residual);
+                restart = false;
+            }
+            else
+            {
+                const T rhoNext = m_shadowResidual.Dot(m_residual);
+                if (rhoNext == T(0))
+                    break; // The residual is orthogonal to the shadow residual
+                const T beta = (rhoNext / rho) * (alpha / omega);
+                rho = rhoNext;
+
+                // p = r + beta (p - omega v)
+                m_direction.Axpy(-omega, m_directionProduct);
+                m_direction.Scale(beta);
+                m_direction.Axpy(T(1), m_residual);
+            }
+
+            preconditioner.Apply(m_direction, m_preconditionedDirection);
+            Spmv(T(1), A, m_preconditionedDirection, T(0), m_directionProduct);
+            const T shadowProduct = m_shadowResidual.Dot(m_directionProduct);
+            if (shadowProduct == T(0))
+                break;
+            alpha = rho / shadowProduct;
+
+            // s = r - alpha v, stored in r
+            x.Axpy(alpha, m_preconditionedDirection);
+            m_residual.Axpy(-alpha, m_directionProduct);
+            report.Iterations++;
+
+            double residualNorm = static_cast<double>(m_residual.Norm2()) / rhsNorm;
+            if (residualNorm > m_settings.Tolerance)
+            {
+                preconditioner.Apply(m_residual, m_preconditionedResidual);
+                Spmv(T(1), A, m_preconditionedResidual, T(0), m_residualProduct);
+                const T productNorm = m_residualProduct.Dot(m_residualProduct);
+                if (productNorm == T(0))
+                {
+                    report.ResidualNorms.push_back(residualNorm);
+                    break;
+                }
+                omega = m_residualProduct.Dot(m_residual) / productNorm;
+
+                x.Axpy(omega, m_preconditionedResidual);
+                m_residual.Axpy(-omega, m_residualProduct);
+                residualNorm = static_cast<double>(m_residual.Norm2()) / rhsNorm;
+            }
+
+            if (residualNorm <= m_settings.Tolerance)
+            {
+                // Confirm with the true residual, as the recursive one drifts from it in finite precision
+                m_residual = b;
+                Spmv(T(-1), A, x, T(1), m_residual);
+                residualNorm = static_cast<double>(m_residual.Norm2()) / rhsNorm;
+                restart = true;
+            }
+            report.ResidualNorms.push_back(residualNorm);
+            report.Converged = residualNorm <= m_settings.Tolerance;
+            if (!restart && omega == T(0))
+                break; // Stagnation, the minimal residual step made no progress
+        }
+        return report;
+    }
+
+    /// <summary>
+    /// Solves A x = b with preconditioned BiCGStab from x = 0. The report, if given, receives the residual history.
+    /// </summary>
+    template <typename T, Preconditioner<T> P>
+    ColumnVector<T> BiCGStab(const SparseMatrix<T>& A, const ColumnVector<T>& b, const P& preconditioner, const IterativeSettings& settings = {},
+                             IterativeReport* report = nullptr)
+    {
+        ColumnVector<T> x(b.GetLength());
+        x.Fill(T(0));
+        BiCGStabSolver<T> solver(b.GetLength(), settings);
+        IterativeReport result = solver.Solve(A, b, x, preconditioner);
+        if (report != nullptr)
+            *report = std::move(result);
+        return x;
+    }
+}
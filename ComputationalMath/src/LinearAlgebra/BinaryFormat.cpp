@@ -0,0 +1,71 @@
+#include "BinaryFormat.hpp"
+#include <cstring>
+#include <limits>
+
+namespace LinearAlgebra
+{
+    namespace
+    {
+        constexpr char BinaryMagic[8] = {'C', 'M', 'B', 'I', 'N', 'A', 'R', 'Y'};
+
+        size_t ElementSize(const BinaryElementType type)
+        {
+            switch (type)
+            {
+            case BinaryElementType::Float32:
+            case BinaryElementType::Int32:
+                return 4;
+            case BinaryElementType::Float64:
+            case BinaryElementType::Int64:
+                return 8;
+            }
+            return 0;
+        }
+    }
+
+    BinaryHeader CreateBinaryHeader(const BinaryObjectKind kind, const BinaryElementType elementType, const size_t elementSize, const size_t alignment,
+                                    const size_t rowCount, const size_t columnCount, const size_t leadingDimension)
+    {
+        BinaryHeader header{};
+        std::memcpy(header.Magic, BinaryMagic, sizeof(BinaryMagic));
+        header.Version = BinaryFormatVersion;
+        header.ByteOrderMark = BinaryByteOrderMark;
+        header.Kind = kind;
+        header.ElementType = elementType;
+        header.ElementSize = static_cast<uint32_t>(elementSize);
+        header.Layout = BinaryLayout::RowMajor;
+        header.Alignment = static_cast<uint32_t>(alignment);
+        header.RowCount = rowCount;
+        header.ColumnCount = columnCount;
+        header.LeadingDimension = leadingDimension;
+        header.DataOffset = (sizeof(BinaryHeader) + alignment - 1) / alignment * alignment;
+        return header;
+    }
+
+    BinaryHeader ReadBinaryHeader(const char* data, const size_t byteCount)
+    {
+        BinaryHeader header;
+        if (byteCount < sizeof(BinaryHeader))
+            throw std::runtime_error("Not a binary matrix file");
+        std::memcpy(&header, data, sizeof(BinaryHeader));
+
+        if (std::memcmp(header.Magic, BinaryMagic, sizeof(BinaryMagic)) != 0)
+            throw std::runtime_error("Not a binary matrix file");
+        if (header.ByteOrderMark != BinaryByteOrderMark)
+            throw std::runtime_error("Binary file has a different byte order");
+        if (header.Version != BinaryFormatVersion)
+            throw std::runtime_error("Unsupported binary file version " + std::to_string(header.Version));
+        if (header.Layout != BinaryLayout::RowMajor || header.ElementSize == 0 || header.ElementSize != ElementSize(header.ElementType))
+            throw std::runtime_error("Binary file has an unknown element type or layout");
+        if (header.LeadingDimension < header.ColumnCount || header.DataOffset < sizeof(BinaryHeader))
+            throw std::runtime_error("Binary file header is corrupt");
+
+        // The data should fit in the file, checked without overflowing
+        const uint64_t available = byteCount - std::min<uint64_t>(byteCount, header.DataOffset);
+        const uint64_t rowBytes = header.LeadingDimension * header.ElementSize;
+        if (header.LeadingDimension > std::numeric_limits<uint64_t>::max() / header.ElementSize ||
+            (rowBytes != 0 && header.RowCount > available / rowBytes) || (rowBytes == 0 && header.RowCount != 0 && header.ColumnCount != 0))
+            throw std::runtime_error("Binary file is truncated");
+        return header;
+    }
+}
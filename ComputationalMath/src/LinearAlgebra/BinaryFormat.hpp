@@ -0,0 +1,286 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "AlignedStorage.hpp"
+#include "MappedFile.hpp"
+#include "Matrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra
+{
+    enum class BinaryObjectKind : uint32_t
+    {
+        Matrix = 1,
+        ColumnVector = 2
+    };
+
+    enum class BinaryElementType : uint32_t
+    {
+        Float32 = 1,
+        Float64 = 2,
+        Int32 = 3,
+        Int64 = 4
+    };
+
+    enum class BinaryLayout : uint32_t
+    {
+        RowMajor = 1
+    };
+
+    template <typename T>
+    struct BinaryElementTraits;
+
+    template <>
+    struct BinaryElementTraits<float>
+    {
+        static constexpr BinaryElementType Type = BinaryElementType::Float32;
+    };
+
+    template <>
+    struct BinaryElementTraits<double>
+    {
+        static constexpr BinaryElementType Type = BinaryElementType::Float64;
+    };
+
+    template <>
+    struct BinaryElementTraits<int32_t>
+    {
+        static constexpr BinaryElementType Type = BinaryElementType::Int32;
+    };
+
+    template <>
+    struct BinaryElementTraits<int64_t>
+    {
+        static constexpr BinaryElementType Type = BinaryElementType::Int64;
+    };
+
+    constexpr uint32_t BinaryFormatVersion = 1;
+
+    // Written in the byte order of the writer, files of the other byte order are rejected
+    constexpr uint32_t BinaryByteOrderMark = 0x01020304;
+
+    /// <summary>
+    /// Header at the start of a binary Matrix or ColumnVector file. The elements follow at DataOffset, as RowCount rows
+    /// of LeadingDimension elements, of which the first ColumnCount are the row and the rest is zero padding.
+    /// DataOffset and the row stride are multiples of Alignment bytes, and the data is zero padded up to a multiple
+    /// of Alignment bytes. Written with the StorageTraits of the writer, the file is the exact in-memory layout of the
+    /// Matrix, such that loading it maps the file without copying. A ColumnVector is a single column, LeadingDimension 1.
+    /// </summary>
+    struct BinaryHeader
+    {
+        char Magic[8];
+        uint32_t Version;
+        uint32_t ByteOrderMark;
+        BinaryObjectKind Kind;
+        BinaryElementType ElementType;
+        uint32_t ElementSize;
+        BinaryLayout Layout;
+        uint32_t Alignment;
+        uint32_t Reserved;
+        uint64_t RowCount;
+        uint64_t ColumnCount;
+        uint64_t LeadingDimension;
+        uint64_t DataOffset;
+    };
+
+    static_assert(sizeof(BinaryHeader) == 72, "Binary header layout should not depend on the compiler");
+
+    BinaryHeader CreateBinaryHeader(BinaryObjectKind kind, BinaryElementType elementType, size_t elementSize, size_t alignment,
+                                    size_t rowCount, size_t columnCount, size_t leadingDimension);
+
+    /// <summary>
+    /// Reads and validates the header at the start of data, the contents of a file of byteCount bytes.
+    /// Throws std::runtime_error when it is no binary file of this version, or when the data exceeds the file.
+    /// </summary>
+    BinaryHeader ReadBinaryHeader(const char* data, size_t byteCount);
+
+    /// <summary>
+    /// Writes a binary file row by row, such that large objects can be stored while they are produced, without holding
+    /// the file contents in memory. All rows should be written before Close.
+    /// </summary>
+    template <typename T>
+    class BinaryWriter
+    {
+    public:
+        BinaryWriter(const std::string& path, BinaryObjectKind kind, size_t rowCount, size_t columnCount);
+        ~BinaryWriter();
+
+        BinaryWriter(const BinaryWriter&) = delete;
+        BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+        /// <summary>
+        /// Appends rowCount rows of ColumnCount elements, which are leadingDimension elements apart in rows.
+        /// </summary>
+        void WriteRows(const T* rows, size_t rowCount, size_t leadingDimension);
+        void WriteRow(const T* row) { WriteRows(row, 1, m_header.ColumnCount); }
+
+        /// <summary>
+        /// Writes the padding after the last row and closes the file, throws when rows are missing or writing failed.
+        /// </summary>
+        void Close();
+
+    private:
+        BinaryHeader m_header;
+        std::ofstream m_stream;
+        size_t m_rowsWritten;
+        std::vector<T> m_zeros;
+    };
+
+    template <typename T>
+    BinaryWriter<T>::BinaryWriter(const std::string& path, const BinaryObjectKind kind, const size_t rowCount, const size_t columnCount)
+        : m_header(CreateBinaryHeader(kind, BinaryElementTraits<T>::Type, sizeof(T), StorageTraits<T>::Alignment, rowCount, columnCount,
+                                      kind == BinaryObjectKind::Matrix ? LeadingDimension<T>(columnCount) : 1)),
+          m_stream(path, std::ios::binary | std::ios::trunc),
+          m_rowsWritten(0)
+    {
+        if (kind == BinaryObjectKind::ColumnVector && columnCount != 1)
+            throw std::invalid_argument("Column vector should have one column");
+        if (!m_stream)
+            throw std::runtime_error("Creating " + path + " failed");
+
+        // The padding up to DataOffset is zero
+        std::vector<char> header(m_header.DataOffset, 0);
+        std::copy(reinterpret_cast<const char*>(&m_header), reinterpret_cast<const char*>(&m_header) + sizeof(BinaryHeader), header.data());
+        m_stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+        m_zeros.resize(std::max<size_t>(m_header.LeadingDimension - m_header.ColumnCount, StorageTraits<T>::Alignment / sizeof(T)), T(0));
+    }
+
+    template <typename T>
+    BinaryWriter<T>::~BinaryWriter()
+    {
+        if (m_stream.is_open())
+            m_stream.close();
+    }
+
+    template <typename T>
+    void BinaryWriter<T>::WriteRows(const T* rows, const size_t rowCount, const size_t leadingDimension)
+    {
+        if (m_rowsWritten + rowCount > m_header.RowCount)
+            throw std::out_of_range("More rows than the header");
+
+        const size_t columnCount = m_header.ColumnCount;
+        const size_t padding = m_header.LeadingDimension - columnCount;
+        if (padding == 0 && leadingDimension == columnCount)
+        {
+            m_stream.write(reinterpret_cast<const char*>(rows), static_cast<std::streamsize>(rowCount * columnCount * sizeof(T)));
+        }
+        else
+        {
+            for (size_t i = 0; i < rowCount; i++)
+            {
+                m_stream.write(reinterpret_cast<const char*>(rows + i * leadingDimension), static_cast<std::streamsize>(columnCount * sizeof(T)));
+                m_stream.write(reinterpret_cast<const char*>(m_zeros.data()), static_cast<std::streamsize>(padding * sizeof(T)));
+            }
+        }
+        m_rowsWritten += rowCount;
+    }
+
+    template <typename T>
+    void BinaryWriter<T>::Close()
+    {
+        if (m_rowsWritten != m_header.RowCount)
+            throw std::out_of_range("Not all rows are written");
+
+        const size_t length = m_header.RowCount * m_header.LeadingDimension;
+        m_stream.write(reinterpret_cast<const char*>(m_zeros.data()), static_cast<std::streamsize>((PaddedLength<T>(length) - length) * sizeof(T)));
+        m_stream.close();
+        if (!m_stream)
+            throw std::runtime_error("Writing the binary file failed");
+    }
+
+    template <typename T>
+    void SaveBinary(const std::string& path, const Matrix<T>& matrix)
+    {
+        BinaryWriter<T> writer(path, BinaryObjectKind::Matrix, matrix.GetRowCount(), matrix.GetColumnCount());
+        writer.WriteRows(matrix.Data(), matrix.GetRowCount(), matrix.GetLeadingDimension());
+        writer.Close();
+    }
+
+    template <typename T>
+    void SaveBinary(const std::string& path, const ColumnVector<T>& vector)
+    {
+        BinaryWriter<T> writer(path, BinaryObjectKind::ColumnVector, vector.GetLength(), 1);
+        writer.WriteRows(vector.Data(), vector.GetLength(), 1);
+        writer.Close();
+    }
+
+    /// <summary>
+    /// Maps the data of a binary file copy-on-write, the storage owns the mapping and unmaps it when released.
+    /// Returns nullptr when the layout or alignment differs from StorageTraits<T>, thus the data has to be copied.
+    /// </summary>
+    template <typename T>
+    std::shared_ptr<T[]> MapBinaryStorage(const std::shared_ptr<MappedFile>& file, const BinaryHeader& header, const size_t leadingDimension)
+    {
+        const size_t length = header.RowCount * header.LeadingDimension;
+        const bool sameLayout = header.LeadingDimension == leadingDimension && header.DataOffset % StorageTraits<T>::Alignment == 0 &&
+                                header.DataOffset + PaddedLength<T>(length) * sizeof(T) <= file->GetByteCount();
+        if (!sameLayout || length == 0)
+            return nullptr;
+
+        // Aliasing constructor, the storage shares the ownership of the mapping
+        return std::shared_ptr<T[]>(file, reinterpret_cast<T*>(file->Data() + header.DataOffset));
+    }
+
+    template <typename T>
+    BinaryHeader ReadBinaryHeader(const MappedFile& file, const BinaryObjectKind kind)
+    {
+        const BinaryHeader header = ReadBinaryHeader(file.Data(), file.GetByteCount());
+        if (header.Kind != kind)
+            throw std::invalid_argument(kind == BinaryObjectKind::Matrix ? "File does not contain a matrix" : "File does not contain a column vector");
+        if (header.ElementType != BinaryElementTraits<T>::Type)
+            throw std::invalid_argument("Element type mismatch");
+        return header;
+    }
+
+    /// <summary>
+    /// Loads a matrix stored by SaveBinary or BinaryWriter. The file is mapped copy-on-write and, when it was written
+    /// with the same StorageTraits, used as the matrix storage without copying, thus loading only costs page faults
+    /// on access. Modifying the matrix never changes the file.
+    /// </summary>
+    template <typename T>
+    Matrix<T> LoadMatrix(const std::string& path)
+    {
+        auto file = std::make_shared<MappedFile>(path);
+        const BinaryHeader header = ReadBinaryHeader<T>(*file, BinaryObjectKind::Matrix);
+        const size_t rowCount = header.RowCount;
+        const size_t columnCount = header.ColumnCount;
+
+        std::shared_ptr<T[]> storage = MapBinaryStorage<T>(file, header, LeadingDimension<T>(columnCount));
+        if (storage)
+            return Matrix<T>(rowCount, columnCount, std::move(storage));
+
+        Matrix<T> matrix(rowCount, columnCount);
+        const T* source = reinterpret_cast<const T*>(file->Data() + header.DataOffset);
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            std::copy(source + i * header.LeadingDimension, source + i * header.LeadingDimension + columnCount, matrix.Data() + i * matrix.GetLeadingDimension());
+        }
+        return matrix;
+    }
+
+    /// <summary>
+    /// Loads a column vector stored by SaveBinary or BinaryWriter, without copying, see LoadMatrix.
+    /// </summary>
+    template <typename T>
+    ColumnVector<T> LoadColumnVector(const std::string& path)
+    {
+        auto file = std::make_shared<MappedFile>(path);
+        const BinaryHeader header = ReadBinaryHeader<T>(*file, BinaryObjectKind::ColumnVector);
+        const size_t length = header.RowCount;
+
+        std::shared_ptr<T[]> storage = MapBinaryStorage<T>(file, header, 1);
+        if (storage)
+            return ColumnVector<T>(length, std::move(storage));
+
+        ColumnVector<T> vector(length);
+        const T* source = reinterpret_cast<const T*>(file->Data() + header.DataOffset);
+        std::copy(source, source + length, vector.Data());
+        return vector;
+    }
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "SimdOps.hpp"
+
+namespace LinearAlgebra::Blas
+{
+    // float and double dispatch to the runtime selected SimdOps kernels, other types use the loops below
+
+    /// <summary>
+    /// y = alpha * x + y for vectors of length n. x and y may be identical, but may not partially overlap.
+    /// </summary>
+    template <typename T>
+    void Axpy(const size_t n, const T& alpha, const T* x, T* y)
+    {
+        if (alpha == T(0))
+            return;
+
+        if constexpr (SimdOps::IsAccelerated<T>)
+        {
+            SimdOps::Axpy(alpha, x, n, y);
+            return;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    /// <summary>
+    /// x = alpha * x for a vector of length n.
+    /// </summary>
+    template <typename T>
+    void Scal(const size_t n, const T& alpha, T* x)
+    {
+        if (alpha == T(1))
+            return;
+
+        if constexpr (SimdOps::IsAccelerated<T>)
+        {
+            SimdOps::Scale(x, alpha, n, x);
+            return;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] *= alpha;
+        }
+    }
+
+    /// <summary>
+    /// Inner product of x and y of length n.
+    /// </summary>
+    template <typename T>
+    T Dot(const size_t n, const T* x, const T* y)
+    {
+        if constexpr (SimdOps::IsAccelerated<T>)
+            return SimdOps::Dot(x, y, n);
+
+        // Independent partial sums break the dependency chain of the reduction, which lets the compiler
+        // keep several vector registers in flight without having to reorder floating point additions
+        T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            sum0 += x[i] * y[i];
+            sum1 += x[i + 1] * y[i + 1];
+            sum2 += x[i + 2] * y[i + 2];
+            sum3 += x[i + 3] * y[i + 3];
+        }
+        for (; i < n; i++)
+        {
+            sum0 += x[i] * y[i];
+        }
+        return (sum0 + sum1) + (sum2 + sum3);
+    }
+
+    /// <summary>
+    /// Largest absolute value of x of length n, the infinity norm.
+    /// </summary>
+    template <typename T>
+    T MaxAbs(const size_t n, const T* x)
+    {
+        T maximum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            maximum = std::max(maximum, static_cast<T>(std::abs(x[i])));
+        }
+        return maximum;
+    }
+
+    /// <summary>
+    /// Euclidean norm of x of length n. Entries whose squares overflow or underflow, beyond about 1e19 or below about
+    /// 1e-19 for float, are scaled by the largest absolute value first, as in the LAPACK nrm2.
+    /// </summary>
+    template <typename T>
+    T Nrm2(const size_t n, const T* x)
+    {
+        const T sum = Dot(n, x, x);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // The squares that underflowed are below min() each, which is negligible relative to a sum of at least
+            // min() / epsilon(). An infinite sum may have overflowed, a NaN sum propagates.
+            constexpr T smallestAccurateSum = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+            if (std::isnan(sum) || (sum >= smallestAccurateSum && sum <= std::numeric_limits<T>::max()))
+                return std::sqrt(sum);
+
+            const T scale = MaxAbs(n, x);
+            if (scale == T(0) || std::isinf(scale))
+                return scale;
+
+            T scaledSum = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                const T scaled = x[i] / scale;
+                scaledSum += scaled * scaled;
+            }
+            return scale * std::sqrt(scaledSum);
+        }
+        else
+        {
+            return static_cast<T>(std::sqrt(sum));
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <utility>
+
+#include "IterativeSettings.hpp"
+#include "Preconditioners.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Preconditioned conjugate gradient method for symmetric positive definite A. The work vectors are allocated
+    /// once, at construction, thus repeated solves of the same size, as the time steps of a heat equation, and the
+    /// iterations themselves do not allocate. An iteration costs one SpMV, one application of the preconditioner,
+    /// two dot products and three AXPYs.
+    /// </summary>
+    template <typename T>
+    class ConjugateGradientSolver
+    {
+    public:
+        explicit ConjugateGradientSolver(size_t size, IterativeSettings settings = {});
+
+        const IterativeSettings& GetSettings() const { return m_settings; }
+
+        /// <summary>
+        /// Solves A x = b, starting from the initial guess in x. The preconditioner should be symmetric positive definite.
+        /// </summary>
+        template <Preconditioner<T> P>
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner);
+
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x)
+        {
+            return Solve(A, b, x, IdentityPreconditioner<T>());
+        }
+
+    private:
+        IterativeSettings m_settings;
+        ColumnVector<T> m_residual;
+        ColumnVector<T> m_preconditioned;
+        ColumnVector<T> m_direction;
+        ColumnVector<T> m_product;
+    };
+
+    template <typename T>
+    ConjugateGradientSolver<T>::ConjugateGradientSolver(const size_t size, const IterativeSettings settings)
+        : m_settings(settings), m_residual(size), m_preconditioned(size), m_direction(size), m_product(size)
+    {
+    }
+
+    template <typename T>
+    template <Preconditioner<T> P>
+    IterativeReport ConjugateGradientSolver<T>::Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner)
+    {
+        AssertSolverDimensions(m_residual.GetLength(), A, b, x);
+
+        IterativeReport report;
+        report.ResidualNorms.reserve(m_settings.MaxIterations + 1);
+
+        const double rhsNorm = static_cast<double>(b.Norm2());
+        if (rhsNorm == 0.0)
+        {
+            x.Fill(T(0));
+            report.ResidualNorms.push_back(0.0);
+            report.Converged = true;
+            return report;
+        }
+
+        // r = b - A x, z = M^-1 r, p = z
+        m_residual = b;
+        Spmv(T(-1), A, x, T(1), m_residual);
+        preconditioner.Apply(m_residual, m_preconditioned);
+        m_direction = m_preconditioned;
+        T rz = m_residual.Dot(m_preconditioned);
+
+        double residualNorm = static_cast<double>(m_residual.Norm2()) / rhsNorm;
+        report.ResidualNorms.push_back(residualNorm);
+        report.Converged = residualNorm <= m_settings.Tolerance;
+
+        while (!report.Converged && report.Iterations < m_settings.MaxIterations)
+        {
+            Spmv(T(1), A, m_direction, T(0), m_product);
+            const T curvature = m_direction.Dot(m_product);
+            if (!(curvature > T(0)) || !(rz > T(0)))
+                break; // A or M is not positive definite, or the residual vanished in this precision
+
+            const T alpha = rz / curvature;
+            x.Axpy(alpha, m_direction);
+            m_residual.Axpy(-alpha, m_product);
+            report.Iterations++;
+
+            residualNorm = static_cast<double>(m_residual.Norm2()) / rhsNorm;
+            report.ResidualNorms.push_back(residualNorm);
+            report.Converged = residualNorm <= m_settings.Tolerance;
+            if (report.Converged)
+                break;
+
+            preconditioner.Apply(m_residual, m_preconditioned);
+            const T rzNext = m_residual.Dot(m_preconditioned);
+            const T beta = rzNext / rz;
+            rz = rzNext;
+
+            // p = z + beta p
+            m_direction.Scale(beta);
+            m_direction.Axpy(T(1), m_preconditioned);
+        }
+        return report;
+    }
+
+    /// <summary>
+    /// Solves the symmetric positive definite system A x = b with preconditioned conjugate gradients from x = 0.
+    /// The report, if given, receives the residual history.
+    /// </summary>
+    template <typename T, Preconditioner<T> P>
+    ColumnVector<T> ConjugateGradient(const SparseMatrix<T>& A, const ColumnVector<T>& b, const P& preconditioner,
+                                      const IterativeSettings& settings = {}, IterativeReport* report = nullptr)
+    {
+        ColumnVector<T> x(b.GetLength());
+        x.Fill(T(0));
+        ConjugateGradientSolver<T> solver(b.GetLength(), settings);
+        IterativeReport result = solver.Solve(A, b, x, preconditioner);
+        if (report != nullptr)
+            *report = std::move(result);
+        return x;
+    }
+}
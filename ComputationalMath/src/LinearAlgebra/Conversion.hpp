@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Elementwise static_cast of a matrix to another value type, e.g. between the float and double precisions.
+    /// </summary>
+    template <typename TTarget, typename TSource>
+    Matrix<TTarget> ConvertMatrix(const Matrix<TSource>& matrix)
+    {
+        Matrix<TTarget> result(matrix.GetRowCount(), matrix.GetColumnCount());
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            for (size_t j = 0; j < matrix.GetColumnCount(); j++)
+            {
+                result(i, j) = static_cast<TTarget>(matrix(i, j));
+            }
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Elementwise static_cast of a column vector to another value type.
+    /// </summary>
+    template <typename TTarget, typename TSource>
+    ColumnVector<TTarget> ConvertVector(const ColumnVector<TSource>& vector)
+    {
+        ColumnVector<TTarget> result(vector.GetLength());
+        for (size_t i = 0; i < vector.GetLength(); i++)
+        {
+            result[i] = static_cast<TTarget>(vector[i]);
+        }
+        return result;
+    }
+}
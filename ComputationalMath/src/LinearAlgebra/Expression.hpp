@@ -0,0 +1,488 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "SimdOps.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Lazy elementwise arithmetic. The operators +, - and scalar * on Matrix, ColumnVector and RowVector build an
+    /// expression tree instead of a temporary per operator. The tree is evaluated in a single loop when it is
+    /// assigned to, or used to construct, a container, e.g. A + B * dt only reads A and B once and writes once.
+    ///
+    /// Expressions keep references to their operands, they should not outlive the statement that creates them.
+    /// </summary>
+    template <typename E>
+    concept LinearExpression = requires {
+        typename E::ValueType;
+        typename E::ResultType;
+    };
+
+    /// <summary>
+    /// An expression node that is not a container itself, i.e. it still needs to be evaluated.
+    /// </summary>
+    template <typename E>
+    concept LinearExpressionNode = LinearExpression<E> && !std::same_as<E, typename E::ResultType>;
+
+    /// <summary>
+    /// How an operand is stored inside an expression node. Nodes are stored by value, containers are stored
+    /// as a terminal, a light-weight pointer wrapper. Containers specialize this in their own header.
+    /// </summary>
+    template <typename E>
+    struct ExpressionOperand
+    {
+        using Type = E;
+    };
+
+    template <typename E>
+    using ExpressionOperandType = typename ExpressionOperand<E>::Type;
+
+    /// <summary>
+    /// Whether the storage spans of two rowCount x columnCount layouts, entry (i, j) at data[i * rowStride + j *
+    /// columnStride], intersect. Interleaved layouts, e.g. the even and the odd columns, are reported as intersecting.
+    /// </summary>
+    template <typename T>
+    bool StorageSpansIntersect(const T* first, const size_t firstRowStride, const size_t firstColumnStride, const T* second,
+                               const size_t secondRowStride, const size_t secondColumnStride, const size_t rowCount, const size_t columnCount)
+    {
+        if (rowCount == 0 || columnCount == 0)
+            return false;
+
+        const T* firstEnd = first + (rowCount - 1) * firstRowStride + (columnCount - 1) * firstColumnStride + 1;
+        const T* secondEnd = second + (rowCount - 1) * secondRowStride + (columnCount - 1) * secondColumnStride + 1;
+        return std::less<const T*>()(first, secondEnd) && std::less<const T*>()(second, firstEnd);
+    }
+
+    template <typename T, typename Result>
+    class DenseVectorTerminal
+    {
+    public:
+        using ValueType = T;
+        using ResultType = Result;
+        static constexpr bool IsMatrix = false;
+
+        template <typename Container>
+        explicit DenseVectorTerminal(const Container& container)
+            : m_data(container.Data()), m_length(container.GetLength()) {}
+
+        size_t GetLength() const { return m_length; }
+        T At(const size_t index) const { return m_data[index]; }
+        const T* Row(const size_t) const { return m_data; }
+
+    private:
+        const T* m_data;
+        size_t m_length;
+    };
+
+    template <typename T, typename Result>
+    class DenseMatrixTerminal
+    {
+    public:
+        using ValueType = T;
+        using ResultType = Result;
+        static constexpr bool IsMatrix = true;
+
+        template <typename Container>
+        explicit DenseMatrixTerminal(const Container& container)
+            : m_data(container.Data()), m_rowCount(container.GetRowCount()), m_columnCount(container.GetColumnCount()),
+              m_leadingDimension(container.GetLeadingDimension()) {}
+
+        size_t GetRowCount() const { return m_rowCount; }
+        size_t GetColumnCount() const { return m_columnCount; }
+        T At(const size_t row, const size_t column) const { return m_data[row * m_leadingDimension + column]; }
+        const T* Row(const size_t row) const { return m_data + row * m_leadingDimension; }
+
+        bool ReadsOtherEntries(const T* destination, const size_t rowStride, const size_t columnStride) const
+        {
+            return StorageSpansIntersect(m_data, m_leadingDimension, size_t(1), destination, rowStride, columnStride, m_rowCount, m_columnCount)
+                   && !(m_data == destination && m_leadingDimension == rowStride && columnStride == 1);
+        }
+
+    private:
+        const T* m_data;
+        size_t m_rowCount;
+        size_t m_columnCount;
+        size_t m_leadingDimension;
+    };
+
+    template <typename T, typename Result>
+    class StridedVectorTerminal
+    {
+    public:
+        using ValueType = T;
+        using ResultType = Result;
+        static constexpr bool IsMatrix = false;
+
+        template <typename View>
+        explicit StridedVectorTerminal(const View& view)
+            : m_data(view.Data()), m_length(view.GetLength()), m_stride(view.GetStride()) {}
+
+        size_t GetLength() const { return m_length; }
+        T At(const size_t index) const { return m_data[index * m_stride]; }
+
+    private:
+        const T* m_data;
+        size_t m_length;
+        size_t m_stride;
+    };
+
+    template <typename T, typename Result>
+    class StridedMatrixTerminal
+    {
+    public:
+        using ValueType = T;
+        using ResultType = Result;
+        static constexpr bool IsMatrix = true;
+
+        template <typename View>
+        explicit StridedMatrixTerminal(const View& view)
+            : m_data(view.Data()), m_rowCount(view.GetRowCount()), m_columnCount(view.GetColumnCount()),
+              m_rowStride(view.GetRowStride()), m_columnStride(view.GetColumnStride()) {}
+
+        size_t GetRowCount() const { return m_rowCount; }
+        size_t GetColumnCount() const { return m_columnCount; }
+        T At(const size_t row, const size_t column) const { return m_data[row * m_rowStride + column * m_columnStride]; }
+
+        bool ReadsOtherEntries(const T* destination, const size_t rowStride, const size_t columnStride) const
+        {
+            return StorageSpansIntersect(m_data, m_rowStride, m_columnStride, destination, rowStride, columnStride, m_rowCount, m_columnCount)
+                   && !(m_data == destination && m_rowStride == rowStride && m_columnStride == columnStride);
+        }
+
+    private:
+        const T* m_data;
+        size_t m_rowCount;
+        size_t m_columnCount;
+        size_t m_rowStride;
+        size_t m_columnStride;
+    };
+
+    struct AssignOperation
+    {
+        template <typename T>
+        static T Apply(const T&, const T& right) { return right; }
+    };
+
+    struct AddOperation
+    {
+        template <typename T>
+        static T Apply(const T& left, const T& right) { return left + right; }
+    };
+
+    struct SubtractOperation
+    {
+        template <typename T>
+        static T Apply(const T& left, const T& right) { return left - right; }
+    };
+
+    template <typename Lhs, typename Rhs, typename Operation>
+    class BinaryExpression
+    {
+    public:
+        using ValueType = typename Lhs::ValueType;
+        using ResultType = typename Lhs::ResultType;
+        using LhsOperand = ExpressionOperandType<Lhs>;
+        using RhsOperand = ExpressionOperandType<Rhs>;
+        using OperationType = Operation;
+        static constexpr bool IsMatrix = ExpressionOperandType<Lhs>::IsMatrix;
+
+        BinaryExpression(const Lhs& lhs, const Rhs& rhs)
+            : m_lhs(lhs), m_rhs(rhs)
+        {
+            if constexpr (IsMatrix)
+            {
+                if (m_lhs.GetRowCount() != m_rhs.GetRowCount() || m_lhs.GetColumnCount() != m_rhs.GetColumnCount())
+                    throw std::invalid_argument("Dimensions mismatch");
+            }
+            else
+            {
+                if (m_lhs.GetLength() != m_rhs.GetLength())
+                    throw std::invalid_argument("Dimensions mismatch");
+            }
+        }
+
+        size_t GetLength() const { return m_lhs.GetLength(); }
+        size_t GetRowCount() const { return m_lhs.GetRowCount(); }
+        size_t GetColumnCount() const { return m_lhs.GetColumnCount(); }
+
+        ValueType At(const size_t index) const { return Operation::Apply(m_lhs.At(index), m_rhs.At(index)); }
+        ValueType At(const size_t row, const size_t column) const { return Operation::Apply(m_lhs.At(row, column), m_rhs.At(row, column)); }
+
+        const LhsOperand& GetLhs() const { return m_lhs; }
+        const RhsOperand& GetRhs() const { return m_rhs; }
+
+    private:
+        ExpressionOperandType<Lhs> m_lhs;
+        ExpressionOperandType<Rhs> m_rhs;
+    };
+
+    template <typename E>
+    class ScalarProductExpression
+    {
+    public:
+        using ValueType = typename E::ValueType;
+        using ResultType = typename E::ResultType;
+        using ScaledOperand = ExpressionOperandType<E>;
+        static constexpr bool IsMatrix = ExpressionOperandType<E>::IsMatrix;
+
+        ScalarProductExpression(const ValueType& scalar, const E& expression)
+            : m_scalar(scalar), m_expression(expression) {}
+
+        size_t GetLength() const { return m_expression.GetLength(); }
+        size_t GetRowCount() const { return m_expression.GetRowCount(); }
+        size_t GetColumnCount() const { return m_expression.GetColumnCount(); }
+
+        ValueType At(const size_t index) const { return m_scalar * m_expression.At(index); }
+        ValueType At(const size_t row, const size_t column) const { return m_scalar * m_expression.At(row, column); }
+
+        const ValueType& GetScalar() const { return m_scalar; }
+        const ScaledOperand& GetScaledOperand() const { return m_expression; }
+
+    private:
+        ValueType m_scalar;
+        ExpressionOperandType<E> m_expression;
+    };
+
+    template <LinearExpression Lhs, LinearExpression Rhs>
+        requires std::same_as<typename Lhs::ResultType, typename Rhs::ResultType>
+    BinaryExpression<Lhs, Rhs, AddOperation> operator+(const Lhs& lhs, const Rhs& rhs)
+    {
+        return BinaryExpression<Lhs, Rhs, AddOperation>(lhs, rhs);
+    }
+
+    template <LinearExpression Lhs, LinearExpression Rhs>
+        requires std::same_as<typename Lhs::ResultType, typename Rhs::ResultType>
+    BinaryExpression<Lhs, Rhs, SubtractOperation> operator-(const Lhs& lhs, const Rhs& rhs)
+    {
+        return BinaryExpression<Lhs, Rhs, SubtractOperation>(lhs, rhs);
+    }
+
+    template <LinearExpression E>
+    ScalarProductExpression<E> operator*(const E& expression, const typename E::ValueType& scalar)
+    {
+        return ScalarProductExpression<E>(scalar, expression);
+    }
+
+    template <LinearExpression E>
+    ScalarProductExpression<E> operator*(const typename E::ValueType& scalar, const E& expression)
+    {
+        return ScalarProductExpression<E>(scalar, expression);
+    }
+
+    template <typename Operand>
+    concept DenseTerminal = requires(const Operand& operand) { operand.Row(size_t(0)); };
+
+    template <typename Operand, typename Operation>
+    concept DenseBinaryExpression = requires { typename Operand::OperationType; } &&
+                                    std::same_as<typename Operand::OperationType, Operation> &&
+                                    DenseTerminal<typename Operand::LhsOperand> && DenseTerminal<typename Operand::RhsOperand>;
+
+    template <typename Operand>
+    concept DenseScalarProductExpression = requires { typename Operand::ScaledOperand; } &&
+                                           DenseTerminal<typename Operand::ScaledOperand>;
+
+    /// <summary>
+    /// Whether destination = Operation(destination, operand) maps onto one SimdOps kernel per contiguous row. This
+    /// covers A + B, A - B and s * A assigned, and A and s * A added or subtracted, for float and double containers.
+    /// </summary>
+    template <typename Operation, typename Operand>
+    constexpr bool HasRowKernel = SimdOps::IsAccelerated<typename Operand::ValueType> &&
+                                  (std::same_as<Operation, AssignOperation>
+                                       ? (DenseBinaryExpression<Operand, AddOperation> || DenseBinaryExpression<Operand, SubtractOperation> ||
+                                          DenseScalarProductExpression<Operand>)
+                                       : (DenseTerminal<Operand> || DenseScalarProductExpression<Operand>));
+
+    /// <summary>
+    /// Evaluates the first length entries of row row of operand into destination with a SimdOps kernel, see HasRowKernel.
+    /// </summary>
+    template <typename Operation, typename Operand>
+        requires HasRowKernel<Operation, Operand>
+    void EvaluateRowKernel(const Operand& operand, const size_t row, const size_t length, typename Operand::ValueType* destination)
+    {
+        if constexpr (std::same_as<Operation, AssignOperation>)
+        {
+            if constexpr (DenseBinaryExpression<Operand, AddOperation>)
+                SimdOps::Sum(operand.GetLhs().Row(row), operand.GetRhs().Row(row), length, destination);
+            else if constexpr (DenseBinaryExpression<Operand, SubtractOperation>)
+                SimdOps::Subtract(operand.GetLhs().Row(row), operand.GetRhs().Row(row), length, destination);
+            else
+                SimdOps::Scale(operand.GetScaledOperand().Row(row), operand.GetScalar(), length, destination);
+        }
+        else if constexpr (DenseTerminal<Operand>)
+        {
+            if constexpr (std::same_as<Operation, AddOperation>)
+                SimdOps::Sum(destination, operand.Row(row), length, destination);
+            else
+                SimdOps::Subtract(destination, operand.Row(row), length, destination);
+        }
+        else
+        {
+            const typename Operand::ValueType alpha = std::same_as<Operation, AddOperation> ? operand.GetScalar() : -operand.GetScalar();
+            SimdOps::Axpy(alpha, operand.GetScaledOperand().Row(row), length, destination);
+        }
+    }
+
+    template <typename Operand>
+    bool OperandReadsOtherEntries(const Operand& operand, const typename Operand::ValueType* destination, const size_t rowStride,
+                                  const size_t columnStride)
+    {
+        if constexpr (requires { operand.GetLhs(); })
+            return OperandReadsOtherEntries(operand.GetLhs(), destination, rowStride, columnStride)
+                   || OperandReadsOtherEntries(operand.GetRhs(), destination, rowStride, columnStride);
+        else if constexpr (requires { operand.GetScaledOperand(); })
+            return OperandReadsOtherEntries(operand.GetScaledOperand(), destination, rowStride, columnStride);
+        else
+            return operand.ReadsOtherEntries(destination, rowStride, columnStride);
+    }
+
+    /// <summary>
+    /// Whether a matrix expression reads entries of the strided destination other than the entry it writes, e.g.
+    /// A = A.TransposedView() + A, or a block of A that overlaps A. Evaluated in place, it would read entries that were
+    /// already overwritten, thus it has to be evaluated into a temporary first.
+    /// </summary>
+    template <LinearExpression E>
+    bool ExpressionReadsOtherEntries(const E& expression, const typename E::ValueType* destination, const size_t rowStride, const size_t columnStride)
+    {
+        const ExpressionOperandType<E> operand(expression);
+        return OperandReadsOtherEntries(operand, destination, rowStride, columnStride);
+    }
+
+    /// <summary>
+    /// Evaluates a vector expression into destination, in one loop.
+    /// </summary>
+    template <LinearExpression E>
+    void EvaluateExpression(const E& expression, typename E::ValueType* destination)
+    {
+        const ExpressionOperandType<E> operand(expression);
+        const size_t length = operand.GetLength();
+        if constexpr (HasRowKernel<AssignOperation, ExpressionOperandType<E>>)
+        {
+            EvaluateRowKernel<AssignOperation>(operand, 0, length, destination);
+            return;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            destination[i] = operand.At(i);
+        }
+    }
+
+    /// <summary>
+    /// Evaluates a matrix expression into row-major destination with leading dimension leadingDimension.
+    /// </summary>
+    template <LinearExpression E>
+    void EvaluateExpression(const E& expression, typename E::ValueType* destination, const size_t leadingDimension)
+    {
+        const ExpressionOperandType<E> operand(expression);
+        const size_t rowCount = operand.GetRowCount();
+        const size_t columnCount = operand.GetColumnCount();
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            typename E::ValueType* row = destination + i * leadingDimension;
+            if constexpr (HasRowKernel<AssignOperation, ExpressionOperandType<E>>)
+            {
+                EvaluateRowKernel<AssignOperation>(operand, i, columnCount, row);
+                continue;
+            }
+
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                row[j] = operand.At(i, j);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Evaluates destination[i] = Operation(destination[i], expression[i]) for a vector expression, in one loop.
+    /// </summary>
+    template <typename Operation, LinearExpression E>
+    void CompoundAssignExpression(const E& expression, typename E::ValueType* destination)
+    {
+        const ExpressionOperandType<E> operand(expression);
+        const size_t length = operand.GetLength();
+        if constexpr (HasRowKernel<Operation, ExpressionOperandType<E>>)
+        {
+            EvaluateRowKernel<Operation>(operand, 0, length, destination);
+            return;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            destination[i] = Operation::Apply(destination[i], operand.At(i));
+        }
+    }
+
+    /// <summary>
+    /// Matrix variant of CompoundAssignExpression, on row-major destination with leading dimension leadingDimension.
+    /// </summary>
+    template <typename Operation, LinearExpression E>
+    void CompoundAssignExpression(const E& expression, typename E::ValueType* destination, const size_t leadingDimension)
+    {
+        const ExpressionOperandType<E> operand(expression);
+        const size_t rowCount = operand.GetRowCount();
+        const size_t columnCount = operand.GetColumnCount();
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            typename E::ValueType* row = destination + i * leadingDimension;
+            if constexpr (HasRowKernel<Operation, ExpressionOperandType<E>>)
+            {
+                EvaluateRowKernel<Operation>(operand, i, columnCount, row);
+                continue;
+            }
+
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                row[j] = Operation::Apply(row[j], operand.At(i, j));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Evaluates destination[i * stride] = Operation(destination[i * stride], expression[i]) for a vector expression.
+    /// </summary>
+    template <typename Operation, LinearExpression E>
+    void StridedAssignExpression(const E& expression, typename E::ValueType* destination, const size_t stride)
+    {
+        if (stride == 1)
+        {
+            CompoundAssignExpression<Operation>(expression, destination);
+            return;
+        }
+
+        const ExpressionOperandType<E> operand(expression);
+        const size_t length = operand.GetLength();
+        for (size_t i = 0; i < length; i++)
+        {
+            destination[i * stride] = Operation::Apply(destination[i * stride], operand.At(i));
+        }
+    }
+
+    /// <summary>
+    /// Matrix variant of StridedAssignExpression, entry (i, j) is stored at destination[i * rowStride + j * columnStride].
+    /// </summary>
+    template <typename Operation, LinearExpression E>
+    void StridedAssignExpression(const E& expression, typename E::ValueType* destination, const size_t rowStride, const size_t columnStride)
+    {
+        if (columnStride == 1)
+        {
+            CompoundAssignExpression<Operation>(expression, destination, rowStride);
+            return;
+        }
+
+        const ExpressionOperandType<E> operand(expression);
+        const size_t rowCount = operand.GetRowCount();
+        const size_t columnCount = operand.GetColumnCount();
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                typename E::ValueType& entry = destination[i * rowStride + j * columnStride];
+                entry = Operation::Apply(entry, operand.At(i, j));
+            }
+        }
+    }
+}
@@ -0,0 +1,369 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "BandMatrix.hpp"
+#include "Blas1.hpp"
+#include "FactorizationCholesky.hpp"
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Factorization
+{
+    /// <summary>
+    /// PLU factorization of a band matrix with lower bandwidth kl and upper bandwidth ku, with partial pivoting,
+    /// computed once and reused for any number of right-hand sides. The pivot of column j is chosen from the kl rows
+    /// below it, and the row swaps widen U to ku + kl diagonals, thus the factor is a BandMatrix(n, kl, ku + kl).
+    ///
+    /// As in LAPACK's gbtrf, the multipliers of column j stay in the rows in which they were computed, the later
+    /// swaps are only applied to the columns to the right. The solve applies every swap just before the multipliers
+    /// of its column, which amounts to P^T L as an interleaved sequence of swaps and Gauss transforms.
+    /// </summary>
+    template <typename T>
+    class BandLUFactorization
+    {
+    public:
+        BandLUFactorization(const BandMatrix<T>& matrix, T tolerance);
+
+        /// <summary>
+        /// Factorization of a square sparse matrix in its band, e.g. an assembled FEM matrix.
+        /// </summary>
+        BandLUFactorization(const SparseMatrix<T>& matrix, T tolerance);
+
+        size_t GetSize() const { return m_factor.GetSize(); }
+
+        /// <summary>
+        /// The multipliers of L below, and U on and above the diagonal.
+        /// </summary>
+        const BandMatrix<T>& GetFactor() const { return m_factor; }
+
+        /// <summary>
+        /// Row swapped with row j when column j was eliminated.
+        /// </summary>
+        const std::vector<size_t>& GetRowSwaps() const { return m_rowSwaps; }
+
+        T Determinant() const;
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        Matrix<T> Solve(const Matrix<T>& rhs) const;
+
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+        void SolveInPlace(Matrix<T>& rhs) const;
+
+    private:
+        void Factorize(T tolerance);
+
+        static size_t AssertSquare(const SparseMatrix<T>& matrix);
+
+        /// <summary>
+        /// Upper bandwidth of the factor of a square sparse matrix, ku + kl.
+        /// </summary>
+        static size_t GetFactorUpperBandwidth(const SparseMatrix<T>& matrix);
+
+    private:
+        BandMatrix<T> m_factor;
+        std::vector<size_t> m_rowSwaps;
+        int m_permutationCount = 0;
+    };
+
+    /// <summary>
+    /// Cholesky factorization A = L L^T of a symmetric positive definite band matrix with bandwidth b, computed once
+    /// and reused for any number of right-hand sides. L has the band of A, no pivoting is needed, thus it takes half
+    /// the memory and flops of a BandLUFactorization of the same matrix, and its band is not widened.
+    /// </summary>
+    template <typename T>
+    class BandCholeskyFactorization
+    {
+    public:
+        /// <summary>
+        /// Factorization of the lower band of matrix, the upper band is ignored.
+        /// </summary>
+        BandCholeskyFactorization(const BandMatrix<T>& matrix, T tolerance);
+
+        /// <summary>
+        /// Factorization of a symmetric sparse matrix in its band, e.g. an assembled FEM matrix. Only the lower
+        /// triangle is read.
+        /// </summary>
+        BandCholeskyFactorization(const SparseMatrix<T>& matrix, T tolerance);
+
+        size_t GetSize() const { return m_factor.GetSize(); }
+
+        /// <summary>
+        /// L, a BandMatrix without upper band.
+        /// </summary>
+        const BandMatrix<T>& GetFactor() const { return m_factor; }
+
+        T Determinant() const;
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        Matrix<T> Solve(const Matrix<T>& rhs) const;
+
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+        void SolveInPlace(Matrix<T>& rhs) const;
+
+    private:
+        void Factorize(T tolerance);
+
+        static size_t AssertSquare(const SparseMatrix<T>& matrix);
+
+    private:
+        BandMatrix<T> m_factor;
+    };
+
+    template <typename T>
+    BandLUFactorization<T>::BandLUFactorization(const BandMatrix<T>& matrix, const T tolerance)
+        : m_factor(matrix.GetSize(), matrix.GetLowerBandwidth(), matrix.GetUpperBandwidth() + matrix.GetLowerBandwidth())
+    {
+        for (size_t i = 0; i < matrix.GetSize(); i++)
+        {
+            const size_t first = i > matrix.GetLowerBandwidth() ? i - matrix.GetLowerBandwidth() : 0;
+            const size_t last = std::min(matrix.GetSize() - 1, i + matrix.GetUpperBandwidth());
+            std::copy(matrix.At(i, first), matrix.At(i, last) + 1, m_factor.At(i, first));
+        }
+        Factorize(tolerance);
+    }
+
+    template <typename T>
+    BandLUFactorization<T>::BandLUFactorization(const SparseMatrix<T>& matrix, const T tolerance)
+        : m_factor(matrix, 0, GetFactorUpperBandwidth(matrix))
+    {
+        Factorize(tolerance);
+    }
+
+    template <typename T>
+    size_t BandLUFactorization<T>::AssertSquare(const SparseMatrix<T>& matrix)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+        return matrix.GetRowCount();
+    }
+
+    template <typename T>
+    size_t BandLUFactorization<T>::GetFactorUpperBandwidth(const SparseMatrix<T>& matrix)
+    {
+        AssertSquare(matrix);
+        const auto [lower, upper] = GetBandwidths(matrix);
+        return upper + lower;
+    }
+
+    template <typename T>
+    void BandLUFactorization<T>::Factorize(const T tolerance)
+    {
+        const size_t n = m_factor.GetSize();
+        const size_t lower = m_factor.GetLowerBandwidth();
+        const size_t width = m_factor.GetUpperBandwidth() + 1;
+        m_rowSwaps.resize(n);
+        m_permutationCount = 0;
+
+        for (size_t j = 0; j < n; j++)
+        {
+            const size_t last = std::min(n - 1, j + lower);
+            size_t pivot = j;
+            for (size_t i = j + 1; i <= last; i++)
+            {
+                if (std::abs(*m_factor.At(i, j)) > std::abs(*m_factor.At(pivot, j)))
+                    pivot = i;
+            }
+            if (std::abs(*m_factor.At(pivot, j)) <= tolerance)
+                throw std::invalid_argument("Degenerate matrix");
+
+            // Both rows hold the columns j up to j + width - 1, the upper band of row j after the swaps
+            m_rowSwaps[j] = pivot;
+            if (pivot != j)
+            {
+                std::swap_ranges(m_factor.At(j, j), m_factor.At(j, j) + width, m_factor.At(pivot, j));
+                ++m_permutationCount;
+            }
+
+            const T* rowJ = m_factor.At(j, j);
+            for (size_t i = j + 1; i <= last; i++)
+            {
+                T* rowI = m_factor.At(i, j);
+                rowI[0] /= rowJ[0];
+                Blas::Axpy(width - 1, -rowI[0], rowJ + 1, rowI + 1);
+            }
+        }
+    }
+
+    template <typename T>
+    T BandLUFactorization<T>::Determinant() const
+    {
+        T determinant = m_permutationCount % 2 == 0 ? 1 : -1;
+        for (size_t i = 0; i < GetSize(); i++)
+        {
+            determinant *= *m_factor.At(i, i);
+        }
+        return determinant;
+    }
+
+    template <typename T>
+    ColumnVector<T> BandLUFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    Matrix<T> BandLUFactorization<T>::Solve(const Matrix<T>& rhs) const
+    {
+        Matrix<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    void BandLUFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
+    {
+        const size_t n = GetSize();
+        if (n != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        const size_t lower = m_factor.GetLowerBandwidth();
+        const size_t upper = m_factor.GetUpperBandwidth();
+        T* x = rhs.Data();
+
+        // L y = P b, the multipliers of column j are in the rows below j
+        for (size_t j = 0; j < n; j++)
+        {
+            std::swap(x[j], x[m_rowSwaps[j]]);
+            const size_t last = std::min(n - 1, j + lower);
+            for (size_t i = j + 1; i <= last; i++)
+                x[i] -= *m_factor.At(i, j) * x[j];
+        }
+
+        // U x = y, as inner products of the rows of U
+        for (size_t i = n; i-- > 0;)
+        {
+            const size_t count = std::min(n - 1, i + upper) - i;
+            const T* row = m_factor.At(i, i);
+            x[i] = (x[i] - Blas::Dot(count, row + 1, x + i + 1)) / row[0];
+        }
+    }
+
+    template <typename T>
+    void BandLUFactorization<T>::SolveInPlace(Matrix<T>& rhs) const
+    {
+        SolveColumnsInPlace(rhs, GetSize(), [this](ColumnVector<T>& column)
+                            { SolveInPlace(column); });
+    }
+
+    template <typename T>
+    BandCholeskyFactorization<T>::BandCholeskyFactorization(const BandMatrix<T>& matrix, const T tolerance)
+        : m_factor(matrix.GetSize(), matrix.GetLowerBandwidth(), 0)
+    {
+        for (size_t i = 0; i < matrix.GetSize(); i++)
+        {
+            const size_t first = i > matrix.GetLowerBandwidth() ? i - matrix.GetLowerBandwidth() : 0;
+            std::copy(matrix.At(i, first), matrix.At(i, i) + 1, m_factor.At(i, first));
+        }
+        Factorize(tolerance);
+    }
+
+    template <typename T>
+    BandCholeskyFactorization<T>::BandCholeskyFactorization(const SparseMatrix<T>& matrix, const T tolerance)
+        : m_factor(AssertSquare(matrix), GetBandwidths(matrix).first, 0)
+    {
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            for (size_t k = matrix.RowOffsets()[i]; k < matrix.RowOffsets()[i + 1] && matrix.ColumnIndices()[k] <= i; k++)
+                *m_factor.At(i, matrix.ColumnIndices()[k]) = matrix.Values()[k];
+        }
+        Factorize(tolerance);
+    }
+
+    template <typename T>
+    size_t BandCholeskyFactorization<T>::AssertSquare(const SparseMatrix<T>& matrix)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+        return matrix.GetRowCount();
+    }
+
+    template <typename T>
+    void BandCholeskyFactorization<T>::Factorize(const T tolerance)
+    {
+        // Row by row, as CholeskyTileInPlace. The band of a previous row j starts before that of row i, thus both rows
+        // are contiguous from the first column of row i on
+        const size_t bandwidth = m_factor.GetLowerBandwidth();
+        for (size_t i = 0; i < m_factor.GetSize(); i++)
+        {
+            const size_t first = i > bandwidth ? i - bandwidth : 0;
+            T* rowI = m_factor.At(i, first);
+            for (size_t j = first; j < i; j++)
+            {
+                const T* rowJ = m_factor.At(j, first);
+                rowI[j - first] = (rowI[j - first] - Blas::Dot(j - first, rowI, rowJ)) / rowJ[j - first];
+            }
+
+            const T pivot = rowI[i - first] - Blas::Dot(i - first, rowI, rowI);
+            if (pivot <= tolerance)
+                throw std::invalid_argument("Matrix is not positive definite");
+            rowI[i - first] = std::sqrt(pivot);
+        }
+    }
+
+    template <typename T>
+    T BandCholeskyFactorization<T>::Determinant() const
+    {
+        T determinant = 1;
+        for (size_t i = 0; i < GetSize(); i++)
+        {
+            determinant *= *m_factor.At(i, i) * *m_factor.At(i, i);
+        }
+        return determinant;
+    }
+
+    template <typename T>
+    ColumnVector<T> BandCholeskyFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    Matrix<T> BandCholeskyFactorization<T>::Solve(const Matrix<T>& rhs) const
+    {
+        Matrix<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    void BandCholeskyFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
+    {
+        const size_t n = GetSize();
+        if (n != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        const size_t bandwidth = m_factor.GetLowerBandwidth();
+        T* x = rhs.Data();
+
+        // L y = b, followed by L^T x = y, both by the rows of L
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t first = i > bandwidth ? i - bandwidth : 0;
+            const T* row = m_factor.At(i, first);
+            x[i] = (x[i] - Blas::Dot(i - first, row, x + first)) / row[i - first];
+        }
+        for (size_t i = n; i-- > 0;)
+        {
+            const size_t first = i > bandwidth ? i - bandwidth : 0;
+            const T* row = m_factor.At(i, first);
+            x[i] /= row[i - first];
+            Blas::Axpy(i - first, -x[i], row, x + first);
+        }
+    }
+
+    template <typename T>
+    void BandCholeskyFactorization<T>::SolveInPlace(Matrix<T>& rhs) const
+    {
+        SolveColumnsInPlace(rhs, GetSize(), [this](ColumnVector<T>& column)
+                            { SolveInPlace(column); });
+    }
+}
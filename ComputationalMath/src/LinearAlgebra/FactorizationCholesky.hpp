@@ -0,0 +1,396 @@
+#pragma once
+
+#include "Blas1.hpp"
+#include "Gemm.hpp"
+#include "Matrix.hpp"
+#include "SymmetricMatrix.hpp"
+#include "ThreadPool.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace LinearAlgebra::Factorization
+{
+    /// <summary>
+    /// Unblocked Cholesky factorization of the lower triangle of a diagonal tile of length x length, with leading
+    /// dimension ld, in place. Throws when a pivot is not larger than tolerance, thus the matrix is not positive definite.
+    /// </summary>
+    template <typename T>
+    void CholeskyTileInPlace(T* tile, const size_t length, const size_t ld, const T tolerance)
+    {
+        for (size_t j = 0; j < length; j++)
+        {
+            T* rowJ = tile + j * ld;
+            const T pivot = rowJ[j] - Blas::Dot(j, rowJ, rowJ);
+            if (pivot <= tolerance)
+                throw std::invalid_argument("Matrix is not positive definite");
+
+            rowJ[j] = std::sqrt(pivot);
+            for (size_t i = j + 1; i < length; i++)
+            {
+                T* rowI = tile + i * ld;
+                rowI[j] = (rowI[j] - Blas::Dot(j, rowI, rowJ)) / rowJ[j];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Unblocked LDL^T factorization of the lower triangle of a diagonal tile, in place. The unit lower triangle L
+    /// is stored below the diagonal and D on the diagonal. Throws when |D_j| is not larger than tolerance.
+    /// </summary>
+    template <typename T>
+    void LdltTileInPlace(T* tile, const size_t length, const size_t ld, const T tolerance)
+    {
+        std::vector<T> scaledRow(length);
+        for (size_t j = 0; j < length; j++)
+        {
+            T* rowJ = tile + j * ld;
+            for (size_t p = 0; p < j; p++)
+            {
+                scaledRow[p] = rowJ[p] * tile[p * ld + p];
+            }
+
+            rowJ[j] -= Blas::Dot(j, rowJ, scaledRow.data());
+            if (std::abs(rowJ[j]) <= tolerance)
+                throw std::invalid_argument("Degenerate matrix");
+
+            for (size_t i = j + 1; i < length; i++)
+            {
+                T* rowI = tile + i * ld;
+                rowI[j] = (rowI[j] - Blas::Dot(j, rowI, scaledRow.data())) / rowJ[j];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Blocked right-looking factorization of a SymmetricMatrix in place, A = L L^T (Cholesky) or, with
+    /// UnitDiagonal, A = L D L^T. Per tile column k:
+    ///  1. the diagonal tile is factorized unblocked,
+    ///  2. the tiles below are solved with the transposed diagonal tile, W_ik = A_ik L_kk^-T, in parallel,
+    ///     for LDL^T W_ik = L_ik D_k and L_ik = W_ik D_k^-1,
+    ///  3. the trailing lower triangle is updated tile by tile in parallel, A_ij -= L_ik W_jk^T.
+    /// Only the lower tiles are updated, thus this takes about half the flops of the PLU factorization.
+    /// </summary>
+    template <typename T, bool UnitDiagonal>
+    void BlockedSymmetricFactorizationInPlace(SymmetricMatrix<T>& matrix, const T tolerance)
+    {
+        constexpr size_t ts = SymmetricMatrix<T>::TileSize;
+        const size_t tileCount = matrix.GetTileCount();
+
+        // W_jk^T of the current tile column, such that the update is a plain row-major product
+        std::vector<T> transposedPanel(tileCount * ts * ts);
+
+        for (size_t k = 0; k < tileCount; k++)
+        {
+            const size_t kLength = matrix.GetTileLength(k);
+            T* diagonal = matrix.Tile(k, k);
+            if constexpr (UnitDiagonal)
+                LdltTileInPlace(diagonal, kLength, ts, tolerance);
+            else
+                CholeskyTileInPlace(diagonal, kLength, ts, tolerance);
+
+            const size_t panelCount = tileCount - k - 1;
+            Parallel::ParallelFor(panelCount, [&](const size_t panel)
+                                  {
+                                      const size_t i = k + 1 + panel;
+                                      T* tile = matrix.Tile(i, k);
+                                      T* transposed = transposedPanel.data() + panel * ts * ts;
+                                      for (size_t r = 0; r < matrix.GetTileLength(i); r++)
+                                      {
+                                          T* row = tile + r * ts;
+                                          for (size_t c = 0; c < kLength; c++)
+                                          {
+                                              row[c] -= Blas::Dot(c, row, diagonal + c * ts);
+                                              if constexpr (!UnitDiagonal)
+                                                  row[c] /= diagonal[c * ts + c];
+                                              transposed[c * ts + r] = row[c];
+                                          }
+                                          if constexpr (UnitDiagonal)
+                                          {
+                                              for (size_t c = 0; c < kLength; c++)
+                                              {
+                                                  row[c] /= diagonal[c * ts + c];
+                                              }
+                                          }
+                                      } });
+
+            // Tile pairs (i, j) with k < j <= i, enumerated row by row of the trailing lower triangle
+            Parallel::ParallelFor(panelCount * (panelCount + 1) / 2, [&](const size_t pair)
+                                  {
+                                      size_t i = 0;
+                                      while ((i + 1) * (i + 2) / 2 <= pair)
+                                          i++;
+                                      const size_t j = pair - i * (i + 1) / 2;
+                                      Blas::Gemm(matrix.GetTileLength(k + 1 + i), matrix.GetTileLength(k + 1 + j), kLength,
+                                                 T(-1), matrix.Tile(k + 1 + i, k), ts,
+                                                 transposedPanel.data() + j * ts * ts, ts,
+                                                 T(1), matrix.Tile(k + 1 + i, k + 1 + j), ts); });
+        }
+    }
+
+    /// <summary>
+    /// Solves L x = b in place, for the lower triangle L of a factorized SymmetricMatrix, optionally with a unit diagonal.
+    /// </summary>
+    template <typename T>
+    void LowerSolveInPlace(const SymmetricMatrix<T>& factor, T* x, const bool unitDiagonal)
+    {
+        constexpr size_t ts = SymmetricMatrix<T>::TileSize;
+        for (size_t I = 0; I < factor.GetTileCount(); I++)
+        {
+            const size_t length = factor.GetTileLength(I);
+            T* xI = x + I * ts;
+            for (size_t J = 0; J < I; J++)
+            {
+                const T* tile = factor.Tile(I, J);
+                for (size_t r = 0; r < length; r++)
+                {
+                    xI[r] -= Blas::Dot(ts, tile + r * ts, x + J * ts);
+                }
+            }
+
+            const T* diagonal = factor.Tile(I, I);
+            for (size_t r = 0; r < length; r++)
+            {
+                xI[r] -= Blas::Dot(r, diagonal + r * ts, xI);
+                if (!unitDiagonal)
+                    xI[r] /= diagonal[r * ts + r];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Solves L^T x = b in place, for the lower triangle L of a factorized SymmetricMatrix, optionally with a unit diagonal.
+    /// </summary>
+    template <typename T>
+    void LowerTransposedSolveInPlace(const SymmetricMatrix<T>& factor, T* x, const bool unitDiagonal)
+    {
+        constexpr size_t ts = SymmetricMatrix<T>::TileSize;
+        for (size_t I = factor.GetTileCount(); I-- > 0;)
+        {
+            const size_t length = factor.GetTileLength(I);
+            T* xI = x + I * ts;
+            for (size_t J = I + 1; J < factor.GetTileCount(); J++)
+            {
+                const T* tile = factor.Tile(J, I);
+                for (size_t r = 0; r < factor.GetTileLength(J); r++)
+                {
+                    Blas::Axpy(length, -x[J * ts + r], tile + r * ts, xI);
+                }
+            }
+
+            const T* diagonal = factor.Tile(I, I);
+            for (size_t r = length; r-- > 0;)
+            {
+                if (!unitDiagonal)
+                    xI[r] /= diagonal[r * ts + r];
+                Blas::Axpy(r, -xI[r], diagonal + r * ts, xI);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Cholesky factorization A = L L^T of a symmetric positive definite matrix, computed once and reused for any
+    /// number of right-hand sides. L is stored in a SymmetricMatrix, in about half the memory of an LUFactorization.
+    /// </summary>
+    template <typename T>
+    class CholeskyFactorization
+    {
+    public:
+        CholeskyFactorization(SymmetricMatrix<T> matrix, T tolerance);
+        CholeskyFactorization(const Matrix<T>& matrix, T tolerance);
+
+        size_t GetSize() const { return m_factor.GetSize(); }
+
+        /// <summary>
+        /// L in the lower triangle, the (implicit) upper triangle is not part of the factor.
+        /// </summary>
+        const SymmetricMatrix<T>& GetFactor() const { return m_factor; }
+
+        T Determinant() const;
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        Matrix<T> Solve(const Matrix<T>& rhs) const;
+
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+        void SolveInPlace(Matrix<T>& rhs) const;
+
+    private:
+        SymmetricMatrix<T> m_factor;
+    };
+
+    /// <summary>
+    /// LDL^T factorization A = L D L^T of a symmetric matrix without pivoting, computed once and reused for any number of
+    /// right-hand sides. Unlike Cholesky it needs no square roots and D may have negative entries, but without pivoting
+    /// it is only stable for definite (or quasi-definite) matrices. L has a unit diagonal, D is stored on the diagonal.
+    /// </summary>
+    template <typename T>
+    class LdltFactorization
+    {
+    public:
+        LdltFactorization(SymmetricMatrix<T> matrix, T tolerance);
+        LdltFactorization(const Matrix<T>& matrix, T tolerance);
+
+        size_t GetSize() const { return m_factor.GetSize(); }
+
+        /// <summary>
+        /// The unit lower triangle L below the diagonal and D on the diagonal.
+        /// </summary>
+        const SymmetricMatrix<T>& GetFactor() const { return m_factor; }
+
+        T Determinant() const;
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        Matrix<T> Solve(const Matrix<T>& rhs) const;
+
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+        void SolveInPlace(Matrix<T>& rhs) const;
+
+    private:
+        SymmetricMatrix<T> m_factor;
+    };
+
+    /// <summary>
+    /// Solves every column of rhs in place with solveColumn, which solves a contiguous vector in place.
+    /// </summary>
+    template <typename T, typename SolveColumn>
+    void SolveColumnsInPlace(Matrix<T>& rhs, const size_t size, const SolveColumn& solveColumn)
+    {
+        if (size != rhs.GetRowCount())
+            throw std::invalid_argument("Matrix Matrix mismatch");
+
+        ColumnVector<T> column(size);
+        for (size_t j = 0; j < rhs.GetColumnCount(); j++)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                column[i] = rhs(i, j);
+            }
+            solveColumn(column);
+            for (size_t i = 0; i < size; i++)
+            {
+                rhs(i, j) = column[i];
+            }
+        }
+    }
+
+    template <typename T>
+    CholeskyFactorization<T>::CholeskyFactorization(SymmetricMatrix<T> matrix, const T tolerance)
+        : m_factor(std::move(matrix))
+    {
+        BlockedSymmetricFactorizationInPlace<T, false>(m_factor, tolerance);
+    }
+
+    template <typename T>
+    CholeskyFactorization<T>::CholeskyFactorization(const Matrix<T>& matrix, const T tolerance)
+        : CholeskyFactorization(SymmetricMatrix<T>(matrix), tolerance)
+    {
+    }
+
+    template <typename T>
+    T CholeskyFactorization<T>::Determinant() const
+    {
+        T determinant = 1;
+        for (size_t i = 0; i < GetSize(); i++)
+        {
+            determinant *= m_factor(i, i) * m_factor(i, i);
+        }
+        return determinant;
+    }
+
+    template <typename T>
+    ColumnVector<T> CholeskyFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    Matrix<T> CholeskyFactorization<T>::Solve(const Matrix<T>& rhs) const
+    {
+        Matrix<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    void CholeskyFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
+    {
+        if (GetSize() != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        // L y = b, followed by L^T x = y
+        LowerSolveInPlace(m_factor, rhs.Data(), false);
+        LowerTransposedSolveInPlace(m_factor, rhs.Data(), false);
+    }
+
+    template <typename T>
+    void CholeskyFactorization<T>::SolveInPlace(Matrix<T>& rhs) const
+    {
+        SolveColumnsInPlace(rhs, GetSize(), [this](ColumnVector<T>& column)
+                            { SolveInPlace(column); });
+    }
+
+    template <typename T>
+    LdltFactorization<T>::LdltFactorization(SymmetricMatrix<T> matrix, const T tolerance)
+        : m_factor(std::move(matrix))
+    {
+        BlockedSymmetricFactorizationInPlace<T, true>(m_factor, tolerance);
+    }
+
+    template <typename T>
+    LdltFactorization<T>::LdltFactorization(const Matrix<T>& matrix, const T tolerance)
+        : LdltFactorization(SymmetricMatrix<T>(matrix), tolerance)
+    {
+    }
+
+    template <typename T>
+    T LdltFactorization<T>::Determinant() const
+    {
+        T determinant = 1;
+        for (size_t i = 0; i < GetSize(); i++)
+        {
+            determinant *= m_factor(i, i);
+        }
+        return determinant;
+    }
+
+    template <typename T>
+    ColumnVector<T> LdltFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    Matrix<T> LdltFactorization<T>::Solve(const Matrix<T>& rhs) const
+    {
+        Matrix<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    void LdltFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
+    {
+        if (GetSize() != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        // L z = b, D y = z, followed by L^T x = y
+        T* x = rhs.Data();
+        LowerSolveInPlace(m_factor, x, true);
+        for (size_t i = 0; i < GetSize(); i++)
+        {
+            x[i] /= m_factor(i, i);
+        }
+        LowerTransposedSolveInPlace(m_factor, x, true);
+    }
+
+    template <typename T>
+    void LdltFactorization<T>::SolveInPlace(Matrix<T>& rhs) const
+    {
+        SolveColumnsInPlace(rhs, GetSize(), [this](ColumnVector<T>& column)
+                            { SolveInPlace(column); });
+    }
+}
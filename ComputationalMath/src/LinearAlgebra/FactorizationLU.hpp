@@ -1,7 +1,15 @@
 #pragma once
 
+#include "Blas1.hpp"
+#include "Gemm.hpp"
 #include "Matrix.hpp"
+#include "TaskGraph.hpp"
+#include "Trsm.hpp"
 #include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace LinearAlgebra::Factorization
 {
@@ -14,20 +22,73 @@ namespace LinearAlgebra::Factorization
         T Value;
     };
 
+    /// <summary>
+    /// Index of an IndexedExtremeValue of which no value is found.
+    /// </summary>
+    constexpr size_t NoIndex = std::numeric_limits<size_t>::max();
+
+    /// <summary>
+    /// Factors and pivots of a PLU factorization. Owns Pivots, with one pivot per column, which is copied on copy and
+    /// handed over on move.
+    /// </summary>
     template <typename T>
     struct FactorizationResult
     {
+        FactorizationResult(Matrix<T> factorization, int permutationCount, size_t* pivots)
+            : Factorization(std::move(factorization)), PermutationCount(permutationCount), Pivots(pivots) {}
+
+        FactorizationResult(const FactorizationResult& other)
+            : Factorization(other.Factorization), PermutationCount(other.PermutationCount), Pivots(new size_t[other.Factorization.GetColumnCount()])
+        {
+            std::copy(other.Pivots, other.Pivots + other.Factorization.GetColumnCount(), Pivots);
+        }
+
+        FactorizationResult& operator=(const FactorizationResult& other)
+        {
+            if (this != &other)
+                *this = FactorizationResult(other);
+            return *this;
+        }
+
+        FactorizationResult(FactorizationResult&& other) noexcept
+            : Factorization(std::move(other.Factorization)), PermutationCount(other.PermutationCount), Pivots(std::exchange(other.Pivots, nullptr)) {}
+
+        FactorizationResult& operator=(FactorizationResult&& other) noexcept
+        {
+            if (this != &other)
+            {
+                delete[] Pivots;
+                Factorization = std::move(other.Factorization);
+                PermutationCount = other.PermutationCount;
+                Pivots = std::exchange(other.Pivots, nullptr);
+            }
+            return *this;
+        }
+
+        ~FactorizationResult() { delete[] Pivots; }
+
         Matrix<T> Factorization;
         int PermutationCount;
         size_t* Pivots;
-        ~FactorizationResult() { delete[] Pivots; }
+    };
+
+    /// <summary>
+    /// Block size of BlockedPluFactorization and the panels within a tile of TiledPluFactorization. PluFactorization
+    /// only switches to the blocked algorithm for square matrices larger than one block.
+    /// TileSize is the default tile size of TiledPluFactorization.
+    /// </summary>
+    template <typename T>
+    struct LuBlocking
+    {
+        static constexpr size_t BlockSize = 64;
+        static constexpr size_t TileSize = 256;
     };
 
     template <typename T>
     IndexedExtremeValue<T> FindNextPivotRow(const Matrix<T>& matrix, size_t column)
     {
         IndexedExtremeValue<T> result;
-        result.Index = -1;
+        result.Index = NoIndex;
         result.Value = 0;
         for (size_t i = column; i < matrix.GetRowCount(); i++)
         {
@@ -47,17 +108,19 @@ namespace LinearAlgebra::Factorization
     /// LU matrix where LU = L + U - I. Since the diagonal of the lower triangle matrix L only contains ones, it is not necessary to store it. We can just store both triangular matrices in 1 matrix.
     /// Pivots contains the vector with the pivot row for each column, A[i, P[i]]
     /// Permutations is the number of row swaps,  used for computing the determinant (det(A) = det(P)det(L)det(U) = (-1)^{Permutations} * prod(diag(U))</returns
+    ///
+    /// Element-at-a-time right-looking algorithm, every column updates the whole trailing matrix. See PluFactorization.
     /// </summary>
     template <typename T>
-    FactorizationResult<T> PluFactorization(const Matrix<T>& A, T tolerance)
+    FactorizationResult<T> UnblockedPluFactorization(const Matrix<T>& A, T tolerance)
     {
         FactorizationResult<T> factorization{Matrix<T>(A), 0, IntRange(A.GetColumnCount())};
 
-        for (int i = 0; i < A.GetColumnCount(); i++)
+        for (size_t i = 0; i < A.GetColumnCount(); i++)
         {
             IndexedExtremeValue<T> result = FindNextPivotRow(factorization.Factorization, i);
 
-            if (result.Value <= tolerance || result.Index == -1) // No pivot column found in column i
+            if (result.Value <= tolerance || result.Index == NoIndex) // No pivot column found in column i
                 throw std::invalid_argument("Degenerate matrix");
 
             if (result.Index != i)
@@ -80,6 +143,231 @@ namespace LinearAlgebra::Factorization
         return factorization;
     }
 
+    /// <summary>
+    /// Unblocked factorization of the columns [panelBegin, panelEnd) of lu, from row panelBegin down to the last row.
+    /// The row swaps are applied to the columns [swapBegin, swapEnd), which include the panel, and are recorded in
+    /// the pivots of factorization and in rowSwaps, where rowSwaps[j] is the row swapped with row j.
+    /// </summary>
+    template <typename T>
+    void FactorizePanel(FactorizationResult<T>& factorization, const size_t panelBegin, const size_t panelEnd,
+                        const size_t swapBegin, const size_t swapEnd, const T tolerance, size_t* rowSwaps)
+    {
+        Matrix<T>& lu = factorization.Factorization;
+        const size_t n = lu.GetRowCount();
+        const size_t ld = lu.GetLeadingDimension();
+        T* data = lu.Data();
+
+        for (size_t j = panelBegin; j < panelEnd; j++)
+        {
+            IndexedExtremeValue<T> result = FindNextPivotRow(lu, j);
+
+            if (result.Value <= tolerance || result.Index == NoIndex) // No pivot column found in column j
+                throw std::invalid_argument("Degenerate matrix");
+
+            rowSwaps[j] = result.Index;
+            if (result.Index != j)
+            {
+                std::swap(factorization.Pivots[j], factorization.Pivots[result.Index]);
+                std::swap_ranges(data + j * ld + swapBegin, data + j * ld + swapEnd, data + result.Index * ld + swapBegin);
+                ++factorization.PermutationCount;
+            }
+
+            const T* pivotRow = data + j * ld;
+            for (size_t i = j + 1; i < n; i++)
+            {
+                T* row = data + i * ld;
+                row[j] /= pivotRow[j];
+                for (size_t c = j + 1; c < panelEnd; c++)
+                {
+                    row[c] -= row[j] * pivotRow[c];
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Solves the block row, rows [rowBegin, rowEnd) and columns [columnBegin, columnEnd), in place with the unit
+    /// lower triangle of the diagonal block at rows and columns [rowBegin, rowEnd), U = L^-1 A.
+    /// </summary>
+    template <typename T>
+    void SolveUnitLowerBlockRow(T* data, const size_t ld, const size_t rowBegin, const size_t rowEnd,
+                                const size_t columnBegin, const size_t columnEnd)
+    {
+        for (size_t i = rowBegin + 1; i < rowEnd; i++)
+        {
+            for (size_t p = rowBegin; p < i; p++)
+            {
+                Blas::Axpy(columnEnd - columnBegin, -data[i * ld + p], data + p * ld + columnBegin, data + i * ld + columnBegin);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Applies the row swaps of rows [rowBegin, rowEnd), in increasing order, to the columns [columnBegin, columnEnd).
+    /// </summary>
+    template <typename T>
+    void ApplyRowSwaps(T* data, const size_t ld, const size_t* rowSwaps, const size_t rowBegin, const size_t rowEnd,
+                       const size_t columnBegin, const size_t columnEnd)
+    {
+        for (size_t j = rowBegin; j < rowEnd; j++)
+        {
+            if (rowSwaps[j] != j)
+                std::swap_ranges(data + j * ld + columnBegin, data + j * ld + columnEnd, data + rowSwaps[j] * ld + columnBegin);
+        }
+    }
+
+    /// <summary>
+    /// Blocked right-looking PLU factorization with partial pivoting, in the style of LAPACK getrf, with the same
+    /// result as UnblockedPluFactorization up to rounding. Per block column of blockSize columns:
+    ///  1. the n x blockSize panel is factorized unblocked, the row swaps are applied to the full rows,
+    ///  2. the block row right of the panel is solved with the unit lower triangle of the diagonal block, U12 = L11^-1 A12,
+    ///  3. the trailing matrix is updated by a single GEMM, A22 -= L21 * U12.
+    /// Nearly all flops are in step 3, which runs at GEMM speed instead of being bound by memory bandwidth.
+    /// </summary>
+    template <typename T>
+    FactorizationResult<T> BlockedPluFactorization(const Matrix<T>& A, T tolerance, const size_t blockSize = LuBlocking<T>::BlockSize)
+    {
+        if (A.GetColumnCount() != A.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (blockSize == 0)
+            throw std::invalid_argument("Block size should be positive");
+
+        FactorizationResult<T> factorization{Matrix<T>(A), 0, IntRange(A.GetColumnCount())};
+        Matrix<T>& lu = factorization.Factorization;
+        const size_t n = lu.GetRowCount();
+        const size_t ld = lu.GetLeadingDimension();
+        T* data = lu.Data();
+        std::vector<size_t> rowSwaps(n);
+
+        for (size_t k = 0; k < n; k += blockSize)
+        {
+            const size_t panelEnd = std::min(k + blockSize, n);
+            const size_t trailing = n - panelEnd;
+
+            FactorizePanel(factorization, k, panelEnd, 0, n, tolerance, rowSwaps.data());
+
+            if (trailing == 0)
+                break;
+
+            SolveUnitLowerBlockRow(data, ld, k, panelEnd, panelEnd, n);
+
+            Blas::Gemm(trailing, trailing, panelEnd - k,
+                       T(-1), data + panelEnd * ld + k, ld,
+                       data + k * ld + panelEnd, ld,
+                       T(1), data + panelEnd * ld + panelEnd, ld);
+        }
+
+        return factorization;
+    }
+
+    /// <summary>
+    /// Tiled PLU factorization with partial pivoting, with the same result as UnblockedPluFactorization up to rounding.
+    /// The matrix is split in tiles of tileSize x tileSize, and every step k of the right-looking algorithm becomes
+    /// a set of tasks of a TaskGraph, executed by Parallel::GlobalThreadPool():
+    ///  - Getrf(k) factorizes tile column k from the diagonal down, blocked by LuBlocking<T>::BlockSize, swapping rows within the tile column,
+    ///  - Trsm(k, j) applies the row swaps of step k to tile column j and solves tile (k, j) with the unit lower triangle of tile (k, k),
+    ///  - Gemm(k, i, j) updates tile (i, j) with the product of tiles (i, k) and (k, j),
+    ///  - Laswp(j) finally applies the row swaps of the later steps to the lower triangle of tile column j.
+    /// Tasks only wait for the tiles they read, thus the panel of step k + 1 starts while the updates of step k to the
+    /// tiles further to the right are still running, unlike the bulk synchronous steps of BlockedPluFactorization.
+    /// The per task timing of the execution is copied to profile, when given.
+    /// </summary>
+    template <typename T>
+    FactorizationResult<T> TiledPluFactorization(const Matrix<T>& A, T tolerance, const size_t tileSize = LuBlocking<T>::TileSize,
+                                                 TaskGraphProfile* profile = nullptr)
+    {
+        if (A.GetColumnCount() != A.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (tileSize == 0)
+            throw std::invalid_argument("Tile size should be positive");
+
+        FactorizationResult<T> factorization{Matrix<T>(A), 0, IntRange(A.GetColumnCount())};
+        const size_t n = factorization.Factorization.GetRowCount();
+        const size_t ld = factorization.Factorization.GetLeadingDimension();
+        T* data = factorization.Factorization.Data();
+        std::vector<size_t> rowSwaps(n);
+
+        const size_t tileCount = (n + tileSize - 1) / tileSize;
+        const auto tileBegin = [tileSize](const size_t tile)
+        { return tile * tileSize; };
+        const auto tileEnd = [tileSize, n](const size_t tile)
+        { return std::min((tile + 1) * tileSize, n); };
+
+        TaskGraph graph;
+        // The tasks of the previous step that updated a tile column, which have to finish before it is swapped
+        std::vector<std::vector<TaskGraph::TaskId>> columnUpdates(tileCount);
+        TaskGraph::TaskId panel = 0;
+        for (size_t k = 0; k < tileCount; k++)
+        {
+            panel = graph.AddTask("Getrf(" + std::to_string(k) + ")", [&, k]()
+                                  {
+                                      const size_t begin = tileBegin(k);
+                                      const size_t end = tileEnd(k);
+                                      for (size_t j = begin; j < end; j += LuBlocking<T>::BlockSize)
+                                      {
+                                          const size_t blockEnd = std::min(j + LuBlocking<T>::BlockSize, end);
+                                          FactorizePanel(factorization, j, blockEnd, begin, end, tolerance, rowSwaps.data());
+                                          if (blockEnd == end)
+                                              break;
+
+                                          SolveUnitLowerBlockRow(data, ld, j, blockEnd, blockEnd, end);
+                                          Blas::BlockedGemm(n - blockEnd, end - blockEnd, blockEnd - j,
+                                                            T(-1), data + blockEnd * ld + j, ld,
+                                                            data + j * ld + blockEnd, ld,
+                                                            data + blockEnd * ld + blockEnd, ld);
+                                      } },
+                                  columnUpdates[k]);
+
+            for (size_t j = k + 1; j < tileCount; j++)
+            {
+                std::vector<TaskGraph::TaskId> dependencies = columnUpdates[j];
+                dependencies.push_back(panel);
+                const TaskGraph::TaskId solve = graph.AddTask("Trsm(" + std::to_string(k) + "," + std::to_string(j) + ")", [&, k, j]()
+                                                              {
+                                                                  ApplyRowSwaps(data, ld, rowSwaps.data(), tileBegin(k), tileEnd(k), tileBegin(j), tileEnd(j));
+                                                                  SolveUnitLowerBlockRow(data, ld, tileBegin(k), tileEnd(k), tileBegin(j), tileEnd(j)); },
+                                                              dependencies);
+
+                columnUpdates[j].clear();
+                for (size_t i = k + 1; i < tileCount; i++)
+                {
+                    columnUpdates[j].push_back(graph.AddTask("Gemm(" + std::to_string(k) + "," + std::to_string(i) + "," + std::to_string(j) + ")", [&, k, i, j]()
+                                                             { Blas::BlockedGemm(tileEnd(i) - tileBegin(i), tileEnd(j) - tileBegin(j), tileEnd(k) - tileBegin(k),
+                                                                                 T(-1), data + tileBegin(i) * ld + tileBegin(k), ld,
+                                                                                 data + tileBegin(k) * ld + tileBegin(j), ld,
+                                                                                 data + tileBegin(i) * ld + tileBegin(j), ld); },
+                                                             {solve}));
+                }
+            }
+        }
+
+        // Every task is a predecessor of the last panel, after which the lower triangle is no longer read
+        for (size_t j = 0; j + 1 < tileCount; j++)
+        {
+            graph.AddTask("Laswp(" + std::to_string(j) + ")", [&, j]()
+                          { ApplyRowSwaps(data, ld, rowSwaps.data(), tileEnd(j), n, tileBegin(j), tileEnd(j)); },
+                          {panel});
+        }
+
+        graph.Execute(Parallel::GlobalThreadPool());
+        if (profile)
+            *profile = graph.GetProfile();
+
+        return factorization;
+    }
+
+    /// <summary>
+    /// PLU factorization with partial pivoting, see UnblockedPluFactorization for the layout of the result.
+    /// Square matrices larger than LuBlocking<T>::BlockSize are factorized by BlockedPluFactorization.
+    /// </summary>
+    template <typename T>
+    FactorizationResult<T> PluFactorization(const Matrix<T>& A, T tolerance)
+    {
+        if (A.GetRowCount() == A.GetColumnCount() && A.GetRowCount() > LuBlocking<T>::BlockSize)
+            return BlockedPluFactorization(A, tolerance);
+        return UnblockedPluFactorization(A, tolerance);
+    }
+
     template <typename T>
     Matrix<T> ExtractUpperMatrix(const Matrix<T>& matrix)
     {
@@ -94,8 +382,8 @@ namespace LinearAlgebra::Factorization
         {
             std::fill(destination, destination + i, 0);
             std::copy(source + i, source + columnCount, destination + i);
-            source += columnCount;
-            destination += columnCount;
+            source += matrix.GetLeadingDimension();
+            destination += result.GetLeadingDimension();
         }
 
         return result;
@@ -119,8 +407,8 @@ namespace LinearAlgebra::Factorization
             destination[i] = 1;
             std::fill(destination + i + 1, destination + columnCount, 0);
 
-            source += columnCount;
-            destination += columnCount;
+            source += matrix.GetLeadingDimension();
+            destination += result.GetLeadingDimension();
         }
 
         return result;
@@ -182,7 +470,7 @@ namespace LinearAlgebra::Factorization
         for (size_t i = 0; i < columnCount; i++)
         {
             T sum = 0;
-            for (int k = 0; k < i; k++)
+            for (size_t k = 0; k < i; k++)
             {
                 sum += matrix(i, k) * rhs[k];
             }
@@ -193,7 +481,8 @@ namespace LinearAlgebra::Factorization
     }
 
     /// <summary>
-    /// Forward substitution for solving the system Ly=b, where L is a lower triangular matrix where the diagonal is 1. y and b are column vectors.
+    /// Forward substitution for solving the system LY=B, where L is a lower triangular matrix where the diagonal is 1.
+    /// All columns of B are solved at once by the blocked Blas::Trsm.
     /// </summary>
     template <typename T>
     void ForwardSubstitutionInPlace(const Matrix<T>& matrix, Matrix<T>& rhs)
@@ -205,21 +494,8 @@ namespace LinearAlgebra::Factorization
         if (columnCount != rhs.GetColumnCount() || rowCount != rhs.GetRowCount())
             throw std::invalid_argument("Matrix Matrix mismatch");
 
-        // const T* matrixData = matrix.Data();
-        // T* rhsData = rhs.Data();
-
-        for (size_t i = 0; i < rowCount; i++)
-        {
-            for (size_t j = 0; j < columnCount; j++)
-            {
-                T sum = 0;
-                for (int k = 0; k < i; k++)
-                {
-                    sum += matrix(i, k) * rhs(k, j);
-                }
-                rhs(i, j) -= sum;
-            }
-        }
+        Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::Unit, rowCount, rhs.GetColumnCount(),
+                   matrix.Data(), matrix.GetLeadingDimension(), rhs.Data(), rhs.GetLeadingDimension());
     }
 
     /// <summary>
@@ -248,7 +524,8 @@ namespace LinearAlgebra::Factorization
     }
 
     /// <summary>
-    /// Backwards substitution for solving Ux=y, where U is an upper triangular matrix. x and y are column matrices.
+    /// Backwards substitution for solving UX=Y, where U is an upper triangular matrix.
+    /// All columns of Y are solved at once by the blocked Blas::Trsm.
     /// </summary>
     template <typename T>
     void BackwardSubstitutionInPlace(const Matrix<T>& matrix, Matrix<T>& rhs)
@@ -260,84 +537,175 @@ namespace LinearAlgebra::Factorization
         if (columnCount != rhs.GetColumnCount() || rowCount != rhs.GetRowCount())
             throw std::invalid_argument("Matrix Matrix mismatch");
 
-        // Sweeping backwards, starting at last row
-        for (size_t i = rowCount - 1; i < rowCount; --i) // unsigned i overflow > rowCount
-        {
-            for (size_t j = 0; j < columnCount; j++)
-            {
-                T sum = 0;
-                for (size_t k = i + 1; k < rowCount; ++k)
-                {
-                    sum += matrix(i, k) * rhs(k, j);
-                }
-                rhs(i, j) = (rhs(i, j) - sum) / matrix(i, i);
-            }
-        }
+        Blas::Trsm(Blas::Triangle::Upper, Blas::Diagonal::NonUnit, rowCount, rhs.GetColumnCount(),
+                   matrix.Data(), matrix.GetLeadingDimension(), rhs.Data(), rhs.GetLeadingDimension());
     }
 
+    /// <summary>
+    /// PLU factorization that is computed once and reused for any number of right-hand sides, every solve only costs
+    /// the O(n^2) triangular substitutions per column. The permutation is stored as the sequence of row swaps that
+    /// reorders b into Pb, such that the in place solves do not need a copy of the right-hand side.
+    /// </summary>
     template <typename T>
-    ColumnVector<T> LUSolve(const Matrix<T>& matrix, const ColumnVector<T>& rhs, T tolerance)
+    class LUFactorization
     {
-        if (matrix.GetColumnCount() != matrix.GetRowCount())
-            throw std::invalid_argument("Non-square matrix");
-        if (matrix.GetColumnCount() != rhs.GetLength())
-            throw std::invalid_argument("Matrix Column mismatch");
+    public:
+        LUFactorization(const Matrix<T>& matrix, T tolerance);
+        explicit LUFactorization(FactorizationResult<T>&& factorization);
 
-        // LU decomposition: P A = L U
-        FactorizationResult<T> results = PluFactorization(matrix, tolerance);
+        size_t GetSize() const { return m_factorization.Factorization.GetRowCount(); }
+        const FactorizationResult<T>& GetFactorization() const { return m_factorization; }
 
-        // Ax = b <=> PAx = Pb = LUx
-        ColumnVector<T> Pb(rhs.GetLength());
-        for (size_t i = 0; i < rhs.GetLength(); i++)
+        T Determinant() const;
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        Matrix<T> Solve(const Matrix<T>& rhs) const;
+
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+        void SolveInPlace(Matrix<T>& rhs) const;
+
+    private:
+        FactorizationResult<T> m_factorization;
+        std::vector<size_t> m_rowSwaps;
+    };
+
+    template <typename T>
+    LUFactorization<T>::LUFactorization(const Matrix<T>& matrix, const T tolerance)
+        // The pivots only cover the columns, thus a non-square matrix is rejected before it is factorized
+        : LUFactorization(matrix.GetColumnCount() == matrix.GetRowCount()
+                              ? PluFactorization(matrix, tolerance)
+                              : throw std::invalid_argument("Non-square matrix"))
+    {
+    }
+
+    template <typename T>
+    LUFactorization<T>::LUFactorization(FactorizationResult<T>&& factorization)
+        : m_factorization(std::move(factorization)), m_rowSwaps(m_factorization.Factorization.GetRowCount())
+    {
+        if (m_factorization.Factorization.GetColumnCount() != m_factorization.Factorization.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        // Row j of Pb is row Pivots[j] of b, position tracks where each row of b is moved by the preceding swaps
+        const size_t n = GetSize();
+        std::vector<size_t> row(n);
+        std::vector<size_t> position(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            row[i] = i;
+            position[i] = i;
+        }
+        for (size_t j = 0; j < n; j++)
         {
-            Pb[i] = rhs[results.Pivots[i]];
+            const size_t swap = position[m_factorization.Pivots[j]];
+            m_rowSwaps[j] = swap;
+            std::swap(row[j], row[swap]);
+            position[row[j]] = j;
+            position[row[swap]] = swap;
         }
+    }
 
-        // Solve Ly=b
-        ForwardSubstitutionInPlace(results.Factorization, Pb);
+    template <typename T>
+    T LUFactorization<T>::Determinant() const
+    {
+        return Factorization::Determinant(m_factorization);
+    }
 
-        // Solve Ux=y
-        BackwardSubstitutionInPlace(results.Factorization, Pb);
+    template <typename T>
+    ColumnVector<T> LUFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
 
-        return Pb;
+    template <typename T>
+    Matrix<T> LUFactorization<T>::Solve(const Matrix<T>& rhs) const
+    {
+        Matrix<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
     }
 
     template <typename T>
-    Matrix<T> LUSolve(const Matrix<T>& matrix, const Matrix<T>& rhs, T tolerance)
+    void LUFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
     {
-        if (matrix.GetColumnCount() != matrix.GetRowCount())
-            throw std::invalid_argument("Non-square matrix");
-        if (matrix.GetColumnCount() != rhs.GetColumnCount() || matrix.GetRowCount() != rhs.GetRowCount())
+        const size_t n = GetSize();
+        if (n != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        const Matrix<T>& lu = m_factorization.Factorization;
+        const size_t ld = lu.GetLeadingDimension();
+        const T* data = lu.Data();
+        T* x = rhs.Data();
+
+        for (size_t j = 0; j < n; j++)
+        {
+            std::swap(x[j], x[m_rowSwaps[j]]);
+        }
+
+        // Ly = Pb, followed by Ux = y, as inner products of the rows of the factors
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] -= Blas::Dot(i, data + i * ld, x);
+        }
+        for (size_t i = n; i-- > 0;)
+        {
+            x[i] = (x[i] - Blas::Dot(n - i - 1, data + i * ld + i + 1, x + i + 1)) / data[i * ld + i];
+        }
+    }
+
+    template <typename T>
+    void LUFactorization<T>::SolveInPlace(Matrix<T>& rhs) const
+    {
+        const size_t n = GetSize();
+        if (n != rhs.GetRowCount())
             throw std::invalid_argument("Matrix Matrix mismatch");
 
-        // LU decomposition: P A = L U
-        FactorizationResult<T> results = PluFactorization(matrix, tolerance);
+        const Matrix<T>& lu = m_factorization.Factorization;
+        const size_t ld = lu.GetLeadingDimension();
+        const T* data = lu.Data();
+        const size_t columnCount = rhs.GetColumnCount();
 
-        // Ax = b <=> PAx = Pb = LUx
-        Matrix<T> Pb(rhs.GetRowCount(), rhs.GetColumnCount());
-        for (size_t i = 0; i < rhs.GetRowCount(); i++)
+        for (size_t j = 0; j < n; j++)
         {
-            for (size_t j = 0; j < rhs.GetColumnCount(); j++)
-            {
-                Pb(i, j) = rhs(results.Pivots[i], j);
-            }
+            if (m_rowSwaps[j] != j)
+                rhs.SwapRows(j, m_rowSwaps[j]);
         }
 
-        // Solve Ly=b
-        ForwardSubstitutionInPlace(results.Factorization, Pb);
+        // LY = PB, followed by UX = Y, blocked over rows and right-hand side columns
+        Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::Unit, n, columnCount, data, ld, rhs.Data(), rhs.GetLeadingDimension());
+        Blas::Trsm(Blas::Triangle::Upper, Blas::Diagonal::NonUnit, n, columnCount, data, ld, rhs.Data(), rhs.GetLeadingDimension());
+    }
+
+    template <typename T>
+    ColumnVector<T> LUSolve(const Matrix<T>& matrix, const ColumnVector<T>& rhs, T tolerance)
+    {
+        if (matrix.GetColumnCount() != matrix.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (matrix.GetColumnCount() != rhs.GetLength())
+            throw std::invalid_argument("Matrix Column mismatch");
+
+        // LU decomposition: P A = L U, Ax = b <=> PAx = Pb = LUx
+        return LUFactorization<T>(matrix, tolerance).Solve(rhs);
+    }
 
-        // Solve Ux=y
-        BackwardSubstitutionInPlace(results.Factorization, Pb);
+    template <typename T>
+    Matrix<T> LUSolve(const Matrix<T>& matrix, const Matrix<T>& rhs, T tolerance)
+    {
+        if (matrix.GetColumnCount() != matrix.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (matrix.GetColumnCount() != rhs.GetColumnCount() || matrix.GetRowCount() != rhs.GetRowCount())
+            throw std::invalid_argument("Matrix Matrix mismatch");
 
-        return Pb;
+        // LU decomposition: P A = L U, AX = B <=> PAX = PB = LUX
+        return LUFactorization<T>(matrix, tolerance).Solve(rhs);
     }
 
     template <typename T>
     Matrix<T> Identity(size_t N)
     {
         Matrix<T> identity(N, N);
-        T* data = identity.Data();
-        std::fill(data, data + N * N, 0);
+        identity.Fill(0);
         for (size_t i = 0; i < N; i++)
         {
             identity(i, i) = 1;
@@ -354,4 +722,36 @@ namespace LinearAlgebra::Factorization
         Matrix<float> identity = Identity<float>(matrix.GetColumnCount());
         return LUSolve(matrix, identity, tolerance);
     }
+
+    // The factorizations work on a private copy of their input, thus views are copied into a matrix once.
+
+    template <typename T>
+    FactorizationResult<std::remove_const_t<T>> PluFactorization(const MatrixView<T>& A, std::remove_const_t<T> tolerance)
+    {
+        return PluFactorization(Matrix<std::remove_const_t<T>>(A), tolerance);
+    }
+
+    template <typename T>
+    std::remove_const_t<T> Determinant(const MatrixView<T>& matrix, std::remove_const_t<T> tolerance)
+    {
+        return Determinant(Matrix<std::remove_const_t<T>>(matrix), tolerance);
+    }
+
+    template <typename T>
+    ColumnVector<std::remove_const_t<T>> LUSolve(const MatrixView<T>& matrix, const ColumnVector<std::remove_const_t<T>>& rhs, std::remove_const_t<T> tolerance)
+    {
+        return LUSolve(Matrix<std::remove_const_t<T>>(matrix), rhs, tolerance);
+    }
+
+    template <typename T>
+    Matrix<std::remove_const_t<T>> LUSolve(const MatrixView<T>& matrix, const Matrix<std::remove_const_t<T>>& rhs, std::remove_const_t<T> tolerance)
+    {
+        return LUSolve(Matrix<std::remove_const_t<T>>(matrix), rhs, tolerance);
+    }
+
+    template <typename T>
+    Matrix<float> InverseMatrix(const MatrixView<T>& matrix, std::remove_const_t<T> tolerance)
+    {
+        return InverseMatrix(Matrix<std::remove_const_t<T>>(matrix), tolerance);
+    }
 }
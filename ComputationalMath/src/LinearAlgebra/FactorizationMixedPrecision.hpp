@@ -0,0 +1,189 @@
+#pragma once
+
+#include "Blas1.hpp"
+#include "Conversion.hpp"
+#include "FactorizationLU.hpp"
+#include "Gemv.hpp"
+#include "Matrix.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+namespace LinearAlgebra::Factorization
+{
+    /// <summary>
+    /// Convergence of an iterative refinement. ResidualNorms holds the normwise backward error
+    /// |b - Ax|_inf / (|A|_inf |x|_inf + |b|_inf) of the initial solution and after every correction, thus
+    /// Iterations + 1 entries. Converged is false when the iteration limit was hit or the residual stagnated,
+    /// which happens when A is too ill-conditioned for the precision of the factorization. The solution is then
+    /// the iterate of the smallest backward error, which may still be far from TRefine accuracy, thus callers
+    /// should check Converged.
+    /// </summary>
+    struct RefinementReport
+    {
+        std::vector<double> ResidualNorms;
+        size_t Iterations = 0;
+        bool Converged = false;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const RefinementReport& report)
+    {
+        os << (report.Converged ? "Converged" : "Not converged") << " after " << report.Iterations << " iterations, residuals:";
+        for (const double residual : report.ResidualNorms)
+        {
+            os << " " << residual;
+        }
+        return os << std::endl;
+    }
+
+    /// <summary>
+    /// Stopping criteria of the iterative refinement. Like LAPACK's dsgesv, the refinement converged once the
+    /// normwise backward error is at most sqrt(n) * Tolerance, and it stops early when a correction does not at
+    /// least halve the backward error.
+    /// </summary>
+    struct RefinementSettings
+    {
+        size_t MaxIterations = 30;
+        double Tolerance = std::numeric_limits<double>::epsilon();
+    };
+
+    /// <summary>
+    /// PLU factorization in the low precision TFactor, refined to the accuracy of TRefine. Every solve starts from
+    /// the low precision solution, and repeatedly computes the residual r = b - Ax in TRefine, solves the correction
+    /// A d = r with the low precision factors and updates x += d in TRefine. The O(n^3) work stays in TFactor, the
+    /// refinement only costs O(n^2) per iteration, and converges to TRefine accuracy as long as the condition number
+    /// of A is well below 1 / epsilon of TFactor.
+    /// </summary>
+    template <typename TFactor = float, typename TRefine = double>
+    class MixedPrecisionLUFactorization
+    {
+    public:
+        MixedPrecisionLUFactorization(const Matrix<TRefine>& matrix, TFactor tolerance);
+
+        size_t GetSize() const { return m_matrix.GetRowCount(); }
+        const LUFactorization<TFactor>& GetFactorization() const { return m_factorization; }
+
+        /// <summary>
+        /// Refined solution of Ax = b. Like dsgesv, a refinement that does not converge returns its iterate of the
+        /// smallest backward error, rather than the last one, which a stagnating correction may have worsened.
+        /// Whether the solution reached TRefine accuracy is only reported by report->Converged.
+        /// </summary>
+        ColumnVector<TRefine> Solve(const ColumnVector<TRefine>& rhs, RefinementReport* report = nullptr,
+                                    const RefinementSettings& settings = RefinementSettings()) const;
+
+    private:
+        double BackwardError(const ColumnVector<TRefine>& rhs, const ColumnVector<TRefine>& solution, const ColumnVector<TRefine>& residual) const;
+
+    private:
+        Matrix<TRefine> m_matrix;
+        TRefine m_matrixNorm;
+        LUFactorization<TFactor> m_factorization;
+    };
+
+    template <typename TFactor, typename TRefine>
+    MixedPrecisionLUFactorization<TFactor, TRefine>::MixedPrecisionLUFactorization(const Matrix<TRefine>& matrix, const TFactor tolerance)
+        : m_matrix(matrix), m_matrixNorm(0), m_factorization(ConvertMatrix<TFactor>(matrix), tolerance)
+    {
+        for (size_t i = 0; i < m_matrix.GetRowCount(); i++)
+        {
+            TRefine rowSum = 0;
+            for (size_t j = 0; j < m_matrix.GetColumnCount(); j++)
+            {
+                rowSum += std::abs(m_matrix(i, j));
+            }
+            m_matrixNorm = std::max(m_matrixNorm, rowSum);
+        }
+    }
+
+    template <typename TFactor, typename TRefine>
+    double MixedPrecisionLUFactorization<TFactor, TRefine>::BackwardError(const ColumnVector<TRefine>& rhs, const ColumnVector<TRefine>& solution,
+                                                                          const ColumnVector<TRefine>& residual) const
+    {
+        const double denominator = static_cast<double>(m_matrixNorm * Blas::MaxAbs(solution.GetLength(), solution.Data()) + Blas::MaxAbs(rhs.GetLength(), rhs.Data()));
+        const double residualNorm = static_cast<double>(Blas::MaxAbs(residual.GetLength(), residual.Data()));
+        return denominator == 0 ? residualNorm : residualNorm / denominator;
+    }
+
+    template <typename TFactor, typename TRefine>
+    ColumnVector<TRefine> MixedPrecisionLUFactorization<TFactor, TRefine>::Solve(const ColumnVector<TRefine>& rhs, RefinementReport* report,
+                                                                                 const RefinementSettings& settings) const
+    {
+        const size_t n = GetSize();
+        if (n != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        RefinementReport localReport;
+        RefinementReport& result = report ? *report : localReport;
+        result = RefinementReport();
+
+        ColumnVector<TRefine> solution = ConvertVector<TRefine>(m_factorization.Solve(ConvertVector<TFactor>(rhs)));
+        ColumnVector<TRefine> bestSolution(n);
+        double bestBackwardError = std::numeric_limits<double>::infinity();
+        ColumnVector<TRefine> residual(n);
+        ColumnVector<TFactor> correction(n);
+        while (true)
+        {
+            // r = b - Ax, in the refinement precision
+            std::copy(rhs.Data(), rhs.Data() + n, residual.Data());
+            Blas::Gemv(n, n, TRefine(-1), m_matrix.Data(), m_matrix.GetLeadingDimension(), solution.Data(), TRefine(1), residual.Data());
+
+            const double backwardError = BackwardError(rhs, solution, residual);
+            const bool stagnated = !result.ResidualNorms.empty() && backwardError > 0.5 * result.ResidualNorms.back();
+            result.ResidualNorms.push_back(backwardError);
+            if (backwardError <= std::sqrt(static_cast<double>(n)) * settings.Tolerance)
+            {
+                result.Converged = true;
+                return solution;
+            }
+            if (backwardError < bestBackwardError)
+            {
+                bestBackwardError = backwardError;
+                std::copy(solution.Data(), solution.Data() + n, bestSolution.Data());
+            }
+            if (stagnated || result.Iterations == settings.MaxIterations)
+                return bestSolution;
+
+            // The residual is scaled to unit size before it is rounded, such that it cannot underflow in TFactor
+            const TRefine scale = Blas::MaxAbs(n, residual.Data());
+            for (size_t i = 0; i < n; i++)
+            {
+                correction[i] = static_cast<TFactor>(residual[i] / scale);
+            }
+            m_factorization.SolveInPlace(correction);
+            for (size_t i = 0; i < n; i++)
+            {
+                solution[i] += scale * static_cast<TRefine>(correction[i]);
+            }
+            result.Iterations++;
+        }
+    }
+
+    /// <summary>
+    /// Solves Ax = b with a TFactor factorization and iterative refinement in TRefine, see MixedPrecisionLUFactorization.
+    /// Pass a report and check Converged, a system too ill-conditioned for TFactor is solved to lower accuracy.
+    /// </summary>
+    template <typename TFactor = float, typename TRefine>
+    ColumnVector<TRefine> MixedPrecisionLUSolve(const Matrix<TRefine>& matrix, const ColumnVector<TRefine>& rhs, TFactor tolerance,
+                                                RefinementReport* report = nullptr)
+    {
+        if (matrix.GetColumnCount() != matrix.GetRowCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (matrix.GetColumnCount() != rhs.GetLength())
+            throw std::invalid_argument("Matrix Column mismatch");
+
+        return MixedPrecisionLUFactorization<TFactor, TRefine>(matrix, tolerance).Solve(rhs, report);
+    }
+
+    /// <summary>
+    /// Solves the float system Ax = b with a float factorization and iterative refinement in double. The result is
+    /// the double precision solution of the float system rounded to float, which is more accurate than LUSolve for
+    /// ill-conditioned systems, such as those of fine meshes.
+    /// </summary>
+    inline ColumnVector<float> MixedPrecisionLUSolve(const Matrix<float>& matrix, const ColumnVector<float>& rhs, const float tolerance,
+                                                     RefinementReport* report = nullptr)
+    {
+        return ConvertVector<float>(MixedPrecisionLUSolve<float>(ConvertMatrix<double>(matrix), ConvertVector<double>(rhs), tolerance, report));
+    }
+}
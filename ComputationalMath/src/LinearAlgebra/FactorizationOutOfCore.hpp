@@ -0,0 +1,415 @@
+#pragma once
+
+#include "FactorizationLU.hpp"
+#include "Gemm.hpp"
+#include "Gemv.hpp"
+#include "MappedFile.hpp"
+#include "Matrix.hpp"
+#include "Trsm.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Square matrix stored in a memory-mapped file, for matrices that do not fit in memory. The matrix is padded to a
+    /// whole number of tiles, and stored as strips of one tile column: strip J holds the columns [J * tileSize,
+    /// (J + 1) * tileSize) of all padded rows, row-major with leading dimension tileSize. Thus tile (I, J) is a
+    /// contiguous tileSize x tileSize block, and so is every range of tiles in one strip. The padding is the identity,
+    /// such that factorizations of the padded matrix leave the original matrix unaffected.
+    /// </summary>
+    template <typename T>
+    class OutOfCoreMatrix
+    {
+    public:
+        /// <summary>
+        /// Zero initialized size x size matrix in an anonymous temporary file.
+        /// </summary>
+        explicit OutOfCoreMatrix(size_t size, size_t tileSize = Factorization::LuBlocking<T>::TileSize);
+
+        /// <summary>
+        /// Zero initialized size x size matrix in the file at path, which is created or overwritten.
+        /// </summary>
+        OutOfCoreMatrix(const std::string& path, size_t size, size_t tileSize = Factorization::LuBlocking<T>::TileSize);
+
+        /// <summary>
+        /// Copy of an in-memory square matrix in an anonymous temporary file.
+        /// </summary>
+        explicit OutOfCoreMatrix(const Matrix<T>& matrix, size_t tileSize = Factorization::LuBlocking<T>::TileSize);
+
+        size_t GetSize() const { return m_size; }
+        size_t GetTileSize() const { return m_tileSize; }
+        size_t GetTileCount() const { return m_tileCount; }
+        size_t GetPaddedSize() const { return m_tileCount * m_tileSize; }
+        size_t GetTileBytes() const { return m_tileSize * m_tileSize * sizeof(T); }
+
+        T* Strip(size_t tileColumn) { return reinterpret_cast<T*>(m_file.Data()) + tileColumn * GetPaddedSize() * m_tileSize; }
+        const T* Strip(size_t tileColumn) const { return reinterpret_cast<const T*>(m_file.Data()) + tileColumn * GetPaddedSize() * m_tileSize; }
+        T* Tile(size_t tileRow, size_t tileColumn) { return Strip(tileColumn) + tileRow * m_tileSize * m_tileSize; }
+        const T* Tile(size_t tileRow, size_t tileColumn) const { return Strip(tileColumn) + tileRow * m_tileSize * m_tileSize; }
+
+        T& operator()(size_t row, size_t column) { return Strip(column / m_tileSize)[row * m_tileSize + column % m_tileSize]; }
+        const T& operator()(size_t row, size_t column) const { return Strip(column / m_tileSize)[row * m_tileSize + column % m_tileSize]; }
+
+        /// <summary>
+        /// Starts reading the tiles [tileRowBegin, tileRowEnd) of the strip in the background.
+        /// </summary>
+        void Prefetch(size_t tileColumn, size_t tileRowBegin, size_t tileRowEnd) const;
+
+        /// <summary>
+        /// Writes back and releases the tiles [tileRowBegin, tileRowEnd) of the strip from memory.
+        /// </summary>
+        void Evict(size_t tileColumn, size_t tileRowBegin, size_t tileRowEnd);
+
+        Matrix<T> ToMatrix() const;
+
+    private:
+        void InitializePadding();
+        size_t TileOffset(size_t tileRow, size_t tileColumn) const { return reinterpret_cast<const char*>(Tile(tileRow, tileColumn)) - m_file.Data(); }
+
+    private:
+        size_t m_size;
+        size_t m_tileSize;
+        size_t m_tileCount;
+        MappedFile m_file;
+    };
+
+    template <typename T>
+    size_t OutOfCoreTileCount(const size_t size, const size_t tileSize)
+    {
+        if (tileSize == 0)
+            throw std::invalid_argument("Tile size should be positive");
+
+        const size_t tileCount = (size + tileSize - 1) / tileSize;
+        const size_t paddedSize = tileCount * tileSize;
+        if (paddedSize != 0 && paddedSize > std::numeric_limits<size_t>::max() / sizeof(T) / paddedSize)
+            throw std::overflow_error("NxN count size overflow");
+        return tileCount;
+    }
+
+    template <typename T>
+    OutOfCoreMatrix<T>::OutOfCoreMatrix(const size_t size, const size_t tileSize)
+        : m_size(size), m_tileSize(tileSize), m_tileCount(OutOfCoreTileCount<T>(size, tileSize)),
+          m_file(m_tileCount * m_tileCount * tileSize * tileSize * sizeof(T))
+    {
+        InitializePadding();
+    }
+
+    template <typename T>
+    OutOfCoreMatrix<T>::OutOfCoreMatrix(const std::string& path, const size_t size, const size_t tileSize)
+        : m_size(size), m_tileSize(tileSize), m_tileCount(OutOfCoreTileCount<T>(size, tileSize)),
+          m_file(path, m_tileCount * m_tileCount * tileSize * tileSize * sizeof(T))
+    {
+        InitializePadding();
+    }
+
+    template <typename T>
+    OutOfCoreMatrix<T>::OutOfCoreMatrix(const Matrix<T>& matrix, const size_t tileSize)
+        : OutOfCoreMatrix(matrix.GetRowCount(), tileSize)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t j = 0; j < m_size; j++)
+            {
+                (*this)(i, j) = matrix(i, j);
+            }
+        }
+    }
+
+    template <typename T>
+    void OutOfCoreMatrix<T>::InitializePadding()
+    {
+        // The file starts out zero, thus only the diagonal of the padding is set
+        for (size_t i = m_size; i < GetPaddedSize(); i++)
+        {
+            (*this)(i, i) = T(1);
+        }
+    }
+
+    template <typename T>
+    void OutOfCoreMatrix<T>::Prefetch(const size_t tileColumn, const size_t tileRowBegin, const size_t tileRowEnd) const
+    {
+        if (tileColumn < m_tileCount && tileRowBegin < tileRowEnd)
+            m_file.Prefetch(TileOffset(tileRowBegin, tileColumn), (tileRowEnd - tileRowBegin) * GetTileBytes());
+    }
+
+    template <typename T>
+    void OutOfCoreMatrix<T>::Evict(const size_t tileColumn, const size_t tileRowBegin, const size_t tileRowEnd)
+    {
+        if (tileColumn < m_tileCount && tileRowBegin < tileRowEnd)
+            m_file.Evict(TileOffset(tileRowBegin, tileColumn), (tileRowEnd - tileRowBegin) * GetTileBytes());
+    }
+
+    template <typename T>
+    Matrix<T> OutOfCoreMatrix<T>::ToMatrix() const
+    {
+        Matrix<T> result(m_size, m_size);
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t j = 0; j < m_size; j++)
+            {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+}
+
+namespace LinearAlgebra::Factorization
+{
+    /// <summary>
+    /// Tile traffic of an out-of-core factorization, the bytes that are read from and written to the file when only
+    /// the working set of the schedule is kept in memory, and the floating point operations of the factorization.
+    /// </summary>
+    struct OutOfCoreStatistics
+    {
+        size_t BytesRead = 0;
+        size_t BytesWritten = 0;
+        double Flops = 0;
+    };
+
+    /// <summary>
+    /// Unblocked partial pivoting of the columns [columnBegin, columnEnd) of a strip of width ld, over the rows
+    /// [rowBegin, rowEnd). Pivot rows are swapped over the whole width of the strip, and only the columns of the
+    /// block are updated. The strip holds all rows of the matrix, thus its rows are the rows of rowSwaps.
+    /// </summary>
+    template <typename T>
+    void FactorizeStripBlock(T* strip, const size_t ld, const size_t rowBegin, const size_t rowEnd,
+                             const size_t columnBegin, const size_t columnEnd, const size_t size, const T tolerance,
+                             std::vector<size_t>& rowSwaps)
+    {
+        for (size_t c = columnBegin; c < columnEnd; c++)
+        {
+            const size_t pivotRow = rowBegin + c - columnBegin;
+            size_t best = pivotRow;
+            for (size_t r = pivotRow + 1; r < rowEnd; r++)
+            {
+                if (std::abs(strip[r * ld + c]) > std::abs(strip[best * ld + c]))
+                    best = r;
+            }
+
+            // The padding, beyond size, has an identity diagonal that is always accepted
+            if (pivotRow < size && std::abs(strip[best * ld + c]) <= tolerance)
+                throw std::invalid_argument("Degenerate matrix");
+
+            rowSwaps[pivotRow] = best;
+            if (best != pivotRow)
+                std::swap_ranges(strip + pivotRow * ld, strip + pivotRow * ld + ld, strip + best * ld);
+
+            const T* pivot = strip + pivotRow * ld;
+            for (size_t r = pivotRow + 1; r < rowEnd; r++)
+            {
+                T* row = strip + r * ld;
+                row[c] /= pivot[c];
+                for (size_t j = c + 1; j < columnEnd; j++)
+                {
+                    row[j] -= row[c] * pivot[j];
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// PLU factorization of an OutOfCoreMatrix in place in its file, that streams the tile columns through memory.
+    ///
+    /// The schedule is left-looking: tile column k is read once, updated with all factored columns j < k, factorized
+    /// and written once. Each update reads tile column j below row block j, and the solve and product on it are a TRSM
+    /// and a single tall GEMM. Compared with the right-looking order of BlockedPluFactorization, which rewrites the
+    /// whole trailing matrix every step, this writes every tile only once, plus one final pass that applies the later
+    /// row swaps to the L part. The working set is two tile columns, and the next tile column is prefetched while
+    /// the current one is processed, used tile columns are evicted to keep the resident memory bounded.
+    ///
+    /// The factors are stored like PluFactorization, with the unit L below and U on and above the diagonal.
+    /// </summary>
+    template <typename T>
+    class OutOfCoreLUFactorization
+    {
+    public:
+        OutOfCoreLUFactorization(OutOfCoreMatrix<T>&& matrix, T tolerance);
+
+        size_t GetSize() const { return m_factorization.GetSize(); }
+        const OutOfCoreMatrix<T>& GetFactorization() const { return m_factorization; }
+
+        /// <summary>
+        /// Row i of the matrix was swapped with row GetRowSwaps()[i] >= i, applied in order of i.
+        /// </summary>
+        const std::vector<size_t>& GetRowSwaps() const { return m_rowSwaps; }
+        const OutOfCoreStatistics& GetStatistics() const { return m_statistics; }
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+
+    private:
+        void Factorize(T tolerance);
+        void UpdateTileColumn(size_t column);
+        void FactorizeTileColumn(size_t column, T tolerance);
+
+    private:
+        OutOfCoreMatrix<T> m_factorization;
+        std::vector<size_t> m_rowSwaps;
+        OutOfCoreStatistics m_statistics;
+    };
+
+    // Width of the unblocked column blocks within the panel of a tile column
+    constexpr size_t OutOfCorePanelBlock = 32;
+
+    template <typename T>
+    OutOfCoreLUFactorization<T>::OutOfCoreLUFactorization(OutOfCoreMatrix<T>&& matrix, const T tolerance)
+        : m_factorization(std::move(matrix)), m_rowSwaps(m_factorization.GetPaddedSize())
+    {
+        Factorize(tolerance);
+    }
+
+    template <typename T>
+    void OutOfCoreLUFactorization<T>::Factorize(const T tolerance)
+    {
+        const size_t tileCount = m_factorization.GetTileCount();
+        const size_t tileBytes = m_factorization.GetTileBytes();
+        for (size_t i = 0; i < m_rowSwaps.size(); i++)
+        {
+            m_rowSwaps[i] = i;
+        }
+
+        m_factorization.Prefetch(0, 0, tileCount);
+        for (size_t k = 0; k < tileCount; k++)
+        {
+            m_statistics.BytesRead += tileCount * tileBytes;
+            UpdateTileColumn(k);
+            FactorizeTileColumn(k, tolerance);
+            m_factorization.Evict(k, 0, tileCount);
+            m_statistics.BytesWritten += tileCount * tileBytes;
+        }
+
+        // The row swaps of the later panels still have to be applied to the L part of the earlier tile columns
+        const size_t ts = m_factorization.GetTileSize();
+        for (size_t j = 0; j + 1 < tileCount; j++)
+        {
+            m_factorization.Prefetch(j + 1, j + 2, tileCount);
+            T* strip = m_factorization.Strip(j);
+            for (size_t r = (j + 1) * ts; r < m_rowSwaps.size(); r++)
+            {
+                if (m_rowSwaps[r] != r)
+                    std::swap_ranges(strip + r * ts, strip + r * ts + ts, strip + m_rowSwaps[r] * ts);
+            }
+            m_factorization.Evict(j, j + 1, tileCount);
+            m_statistics.BytesRead += (tileCount - j - 1) * tileBytes;
+            m_statistics.BytesWritten += (tileCount - j - 1) * tileBytes;
+        }
+    }
+
+    template <typename T>
+    void OutOfCoreLUFactorization<T>::UpdateTileColumn(const size_t k)
+    {
+        const size_t ts = m_factorization.GetTileSize();
+        const size_t tileCount = m_factorization.GetTileCount();
+        const size_t paddedSize = m_factorization.GetPaddedSize();
+        T* column = m_factorization.Strip(k);
+
+        if (k > 0)
+            m_factorization.Prefetch(0, 0, tileCount);
+        for (size_t j = 0; j < k; j++)
+        {
+            // Tile column j is only needed from its diagonal tile down
+            if (j + 1 < k)
+                m_factorization.Prefetch(j + 1, j + 1, tileCount);
+            else
+                m_factorization.Prefetch(k + 1, 0, tileCount);
+
+            // The L part of tile column j has the row order after the swaps of panels [0, j], thus the swaps of
+            // panel j are applied right before its update, like the right-looking order would
+            for (size_t r = j * ts; r < (j + 1) * ts; r++)
+            {
+                if (m_rowSwaps[r] != r)
+                    std::swap_ranges(column + r * ts, column + r * ts + ts, column + m_rowSwaps[r] * ts);
+            }
+
+            const T* strip = m_factorization.Strip(j);
+            T* tile = column + j * ts * ts;
+            const size_t belowRows = paddedSize - (j + 1) * ts;
+
+            // U_jk = L_jj^-1 A_jk, followed by A_ik -= L_ij U_jk for all tile rows i > j at once
+            Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::Unit, ts, ts, m_factorization.Tile(j, j), ts, tile, ts);
+            Blas::Gemm(belowRows, ts, ts, T(-1), strip + (j + 1) * ts * ts, ts, tile, ts, T(1), tile + ts * ts, ts);
+
+            m_factorization.Evict(j, j, tileCount);
+            m_statistics.BytesRead += (tileCount - j) * m_factorization.GetTileBytes();
+            m_statistics.Flops += static_cast<double>(ts) * ts * ts + 2.0 * belowRows * ts * ts;
+        }
+        if (k == 0)
+            m_factorization.Prefetch(1, 0, tileCount);
+    }
+
+    template <typename T>
+    void OutOfCoreLUFactorization<T>::FactorizeTileColumn(const size_t k, const T tolerance)
+    {
+        const size_t ts = m_factorization.GetTileSize();
+        const size_t paddedSize = m_factorization.GetPaddedSize();
+        T* strip = m_factorization.Strip(k);
+        const size_t diagonal = k * ts;
+
+        // Blocked panel: unblocked pivoting on narrow column blocks, and a TRSM and GEMM for the rest of the panel
+        for (size_t c = 0; c < ts; c += OutOfCorePanelBlock)
+        {
+            const size_t width = std::min(OutOfCorePanelBlock, ts - c);
+            const size_t top = diagonal + c;
+            FactorizeStripBlock(strip, ts, top, paddedSize, c, c + width, m_factorization.GetSize(), tolerance, m_rowSwaps);
+
+            const size_t rightColumns = ts - c - width;
+            const size_t belowRows = paddedSize - top - width;
+            Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::Unit, width, rightColumns, strip + top * ts + c, ts, strip + top * ts + c + width, ts);
+            Blas::Gemm(belowRows, rightColumns, width, T(-1), strip + (top + width) * ts + c, ts,
+                       strip + top * ts + c + width, ts, T(1), strip + (top + width) * ts + c + width, ts);
+
+            const double rows = static_cast<double>(paddedSize - top);
+            m_statistics.Flops += rows * width * width + static_cast<double>(width) * width * rightColumns + 2.0 * belowRows * rightColumns * width;
+        }
+    }
+
+    template <typename T>
+    ColumnVector<T> OutOfCoreLUFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        const size_t n = GetSize();
+        if (n != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        const size_t ts = m_factorization.GetTileSize();
+        const size_t tileCount = m_factorization.GetTileCount();
+        const size_t paddedSize = m_factorization.GetPaddedSize();
+
+        std::vector<T> x(paddedSize, T(0));
+        std::copy(rhs.Data(), rhs.Data() + n, x.begin());
+        for (size_t r = 0; r < paddedSize; r++)
+        {
+            std::swap(x[r], x[m_rowSwaps[r]]);
+        }
+
+        // Column oriented substitutions, every tile column is streamed once per sweep
+        for (size_t j = 0; j < tileCount; j++)
+        {
+            m_factorization.Prefetch(j + 1, j + 1, tileCount);
+            const T* strip = m_factorization.Strip(j);
+            T* xj = x.data() + j * ts;
+            Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::Unit, ts, 1, strip + j * ts * ts, ts, xj, 1);
+            Blas::Gemv(paddedSize - (j + 1) * ts, ts, T(-1), strip + (j + 1) * ts * ts, ts, xj, T(1), xj + ts);
+        }
+        for (size_t j = tileCount; j-- > 0;)
+        {
+            if (j > 0)
+                m_factorization.Prefetch(j - 1, 0, j);
+            const T* strip = m_factorization.Strip(j);
+            T* xj = x.data() + j * ts;
+            Blas::Trsm(Blas::Triangle::Upper, Blas::Diagonal::NonUnit, ts, 1, strip + j * ts * ts, ts, xj, 1);
+            Blas::Gemv(j * ts, ts, T(-1), strip, ts, xj, T(1), x.data());
+        }
+
+        ColumnVector<T> solution(n);
+        std::copy(x.begin(), x.begin() + n, solution.Data());
+        return solution;
+    }
+}
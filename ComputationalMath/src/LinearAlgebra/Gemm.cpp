@@ -0,0 +1,154 @@
+#include "Gemm.hpp"
+#include "SimdOps.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GEMM_X86
+#include <immintrin.h>
+#endif
+
+namespace LinearAlgebra::Blas
+{
+#ifdef GEMM_X86
+    // The AVX2 micro-kernels are compiled for AVX2 regardless of the target of the build and only called when
+    // SimdOps selected AVX2 or wider at runtime
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+    static_assert(GemmBlocking<float>::MR == 6 && GemmBlocking<float>::NR == 16, "Micro-kernel is written for 6x16 float tiles");
+    static_assert(GemmBlocking<double>::MR == 6 && GemmBlocking<double>::NR == 8, "Micro-kernel is written for 6x8 double tiles");
+
+    static void Avx2GemmMicroKernel(const size_t kc, const float* a, const float* b, float* c, const size_t ldc)
+    {
+        // 12 accumulators + 2 B registers + 1 broadcast register fit in the 16 ymm registers
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (size_t p = 0; p < kc; p++)
+        {
+            const __m256 b0 = _mm256_loadu_ps(b);
+            const __m256 b1 = _mm256_loadu_ps(b + 8);
+            __m256 ai;
+
+            ai = _mm256_broadcast_ss(a + 0);
+            c00 = _mm256_fmadd_ps(ai, b0, c00);
+            c01 = _mm256_fmadd_ps(ai, b1, c01);
+            ai = _mm256_broadcast_ss(a + 1);
+            c10 = _mm256_fmadd_ps(ai, b0, c10);
+            c11 = _mm256_fmadd_ps(ai, b1, c11);
+            ai = _mm256_broadcast_ss(a + 2);
+            c20 = _mm256_fmadd_ps(ai, b0, c20);
+            c21 = _mm256_fmadd_ps(ai, b1, c21);
+            ai = _mm256_broadcast_ss(a + 3);
+            c30 = _mm256_fmadd_ps(ai, b0, c30);
+            c31 = _mm256_fmadd_ps(ai, b1, c31);
+            ai = _mm256_broadcast_ss(a + 4);
+            c40 = _mm256_fmadd_ps(ai, b0, c40);
+            c41 = _mm256_fmadd_ps(ai, b1, c41);
+            ai = _mm256_broadcast_ss(a + 5);
+            c50 = _mm256_fmadd_ps(ai, b0, c50);
+            c51 = _mm256_fmadd_ps(ai, b1, c51);
+
+            a += 6;
+            b += 16;
+        }
+
+        const __m256 accumulators[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; i++)
+        {
+            float* row = c + i * ldc;
+            _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), accumulators[i][0]));
+            _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), accumulators[i][1]));
+        }
+    }
+
+    static void Avx2GemmMicroKernel(const size_t kc, const double* a, const double* b, double* c, const size_t ldc)
+    {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (size_t p = 0; p < kc; p++)
+        {
+            const __m256d b0 = _mm256_loadu_pd(b);
+            const __m256d b1 = _mm256_loadu_pd(b + 4);
+            __m256d ai;
+
+            ai = _mm256_broadcast_sd(a + 0);
+            c00 = _mm256_fmadd_pd(ai, b0, c00);
+            c01 = _mm256_fmadd_pd(ai, b1, c01);
+            ai = _mm256_broadcast_sd(a + 1);
+            c10 = _mm256_fmadd_pd(ai, b0, c10);
+            c11 = _mm256_fmadd_pd(ai, b1, c11);
+            ai = _mm256_broadcast_sd(a + 2);
+            c20 = _mm256_fmadd_pd(ai, b0, c20);
+            c21 = _mm256_fmadd_pd(ai, b1, c21);
+            ai = _mm256_broadcast_sd(a + 3);
+            c30 = _mm256_fmadd_pd(ai, b0, c30);
+            c31 = _mm256_fmadd_pd(ai, b1, c31);
+            ai = _mm256_broadcast_sd(a + 4);
+            c40 = _mm256_fmadd_pd(ai, b0, c40);
+            c41 = _mm256_fmadd_pd(ai, b1, c41);
+            ai = _mm256_broadcast_sd(a + 5);
+            c50 = _mm256_fmadd_pd(ai, b0, c50);
+            c51 = _mm256_fmadd_pd(ai, b1, c51);
+
+            a += 6;
+            b += 8;
+        }
+
+        const __m256d accumulators[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (size_t i = 0; i < 6; i++)
+        {
+            double* row = c + i * ldc;
+            _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), accumulators[i][0]));
+            _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), accumulators[i][1]));
+        }
+    }
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+    static bool UseAvx2GemmMicroKernel()
+    {
+        return SimdOps::GetInstructionSet() >= SimdOps::InstructionSet::Avx2;
+    }
+#endif
+
+    template <>
+    void GemmMicroKernel<float>(const size_t kc, const float* a, const float* b, float* c, const size_t ldc)
+    {
+#ifdef GEMM_X86
+        if (UseAvx2GemmMicroKernel())
+        {
+            Avx2GemmMicroKernel(kc, a, b, c, ldc);
+            return;
+        }
+#endif
+        GenericGemmMicroKernel(kc, a, b, c, ldc);
+    }
+
+    template <>
+    void GemmMicroKernel<double>(const size_t kc, const double* a, const double* b, double* c, const size_t ldc)
+    {
+#ifdef GEMM_X86
+        if (UseAvx2GemmMicroKernel())
+        {
+            Avx2GemmMicroKernel(kc, a, b, c, ldc);
+            return;
+        }
+#endif
+        GenericGemmMicroKernel(kc, a, b, c, ldc);
+    }
+}
@@ -0,0 +1,328 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace LinearAlgebra::Blas
+{
+    /// <summary>
+    /// Blocking parameters of the packed GEMM. The micro-tile MR x NR is kept in registers, a KC x NR panel of B
+    /// should stay in L1, the MC x KC block of A in L2 and the KC x NC panel of B in L3.
+    /// </summary>
+    template <typename T>
+    struct GemmBlocking
+    {
+        static constexpr size_t MR = 4;
+        static constexpr size_t NR = 4;
+        static constexpr size_t MC = 64;
+        static constexpr size_t KC = 256;
+        static constexpr size_t NC = 2048;
+    };
+
+    template <>
+    struct GemmBlocking<float>
+    {
+        static constexpr size_t MR = 6;
+        static constexpr size_t NR = 16;
+        static constexpr size_t MC = 144;
+        static constexpr size_t KC = 256;
+        static constexpr size_t NC = 4096;
+    };
+
+    template <>
+    struct GemmBlocking<double>
+    {
+        static constexpr size_t MR = 6;
+        static constexpr size_t NR = 8;
+        static constexpr size_t MC = 72;
+        static constexpr size_t KC = 256;
+        static constexpr size_t NC = 2048;
+    };
+
+    // Below this amount of multiply-adds, packing costs more than it gains
+    constexpr size_t SmallGemmThreshold = 32 * 32 * 32;
+
+    // Below this amount of multiply-adds, the product stays on the calling thread
+    constexpr size_t ParallelGemmThreshold = 128 * 128 * 128;
+
+    /// <summary>
+    /// Computes the MR x NR tile C += A * B, where A is a packed MR x kc panel (column by column)
+    /// and B a packed kc x NR panel (row by row).
+    /// </summary>
+    template <typename T>
+    void GenericGemmMicroKernel(const size_t kc, const T* a, const T* b, T* c, const size_t ldc)
+    {
+        constexpr size_t MR = GemmBlocking<T>::MR;
+        constexpr size_t NR = GemmBlocking<T>::NR;
+
+        T accumulator[MR][NR] = {};
+        for (size_t p = 0; p < kc; p++)
+        {
+            for (size_t i = 0; i < MR; i++)
+            {
+                for (size_t j = 0; j < NR; j++)
+                {
+                    accumulator[i][j] += a[i] * b[j];
+                }
+            }
+            a += MR;
+            b += NR;
+        }
+
+        for (size_t i = 0; i < MR; i++)
+        {
+            for (size_t j = 0; j < NR; j++)
+            {
+                c[i * ldc + j] += accumulator[i][j];
+            }
+        }
+    }
+
+    template <typename T>
+    void GemmMicroKernel(const size_t kc, const T* a, const T* b, T* c, const size_t ldc)
+    {
+        GenericGemmMicroKernel(kc, a, b, c, ldc);
+    }
+
+    // SIMD micro-kernels, see Gemm.cpp
+    template <>
+    void GemmMicroKernel<float>(size_t kc, const float* a, const float* b, float* c, size_t ldc);
+
+    template <>
+    void GemmMicroKernel<double>(size_t kc, const double* a, const double* b, double* c, size_t ldc);
+
+    /// <summary>
+    /// Packs the mc x kc block of A into row panels of MR rows, scaled by alpha. Rows beyond mc are zero padded.
+    /// </summary>
+    template <typename T>
+    void PackA(const size_t mc, const size_t kc, const T* A, const size_t lda, const T& alpha, T* packed)
+    {
+        constexpr size_t MR = GemmBlocking<T>::MR;
+        for (size_t ir = 0; ir < mc; ir += MR)
+        {
+            const size_t mr = std::min(MR, mc - ir);
+            for (size_t p = 0; p < kc; p++)
+            {
+                for (size_t i = 0; i < mr; i++)
+                {
+                    packed[i] = alpha * A[(ir + i) * lda + p];
+                }
+                std::fill(packed + mr, packed + MR, T(0));
+                packed += MR;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Packs the kc x nc block of B into column panels of NR columns. Columns beyond nc are zero padded.
+    /// </summary>
+    template <typename T>
+    void PackB(const size_t kc, const size_t nc, const T* B, const size_t ldb, T* packed)
+    {
+        constexpr size_t NR = GemmBlocking<T>::NR;
+        for (size_t jr = 0; jr < nc; jr += NR)
+        {
+            const size_t nr = std::min(NR, nc - jr);
+            for (size_t p = 0; p < kc; p++)
+            {
+                const T* row = B + p * ldb + jr;
+                std::copy(row, row + nr, packed);
+                std::fill(packed + nr, packed + NR, T(0));
+                packed += NR;
+            }
+        }
+    }
+
+    template <typename T>
+    void GemmMacroKernel(const size_t mc, const size_t nc, const size_t kc, const T* packedA, const T* packedB, T* C, const size_t ldc)
+    {
+        constexpr size_t MR = GemmBlocking<T>::MR;
+        constexpr size_t NR = GemmBlocking<T>::NR;
+
+        for (size_t jr = 0; jr < nc; jr += NR)
+        {
+            const size_t nr = std::min(NR, nc - jr);
+            for (size_t ir = 0; ir < mc; ir += MR)
+            {
+                const size_t mr = std::min(MR, mc - ir);
+                const T* a = packedA + ir * kc;
+                const T* b = packedB + jr * kc;
+                T* c = C + ir * ldc + jr;
+
+                if (mr == MR && nr == NR)
+                {
+                    GemmMicroKernel(kc, a, b, c, ldc);
+                    continue;
+                }
+
+                // Edge tile, compute the full tile on the stack and only write back the valid part
+                T tile[MR * NR] = {};
+                GemmMicroKernel(kc, a, b, tile, NR);
+                for (size_t i = 0; i < mr; i++)
+                {
+                    for (size_t j = 0; j < nr; j++)
+                    {
+                        c[i * ldc + j] += tile[i * NR + j];
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    void ScaleMatrix(const size_t m, const size_t n, const T& beta, T* C, const size_t ldc)
+    {
+        if (beta == T(1))
+            return;
+
+        for (size_t i = 0; i < m; i++)
+        {
+            T* row = C + i * ldc;
+            if (beta == T(0))
+            {
+                std::fill(row, row + n, T(0));
+                continue;
+            }
+            for (size_t j = 0; j < n; j++)
+            {
+                row[j] *= beta;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Unpacked i-k-j product for small matrices, C += alpha * A * B.
+    /// </summary>
+    template <typename T>
+    void SmallGemm(const size_t m, const size_t n, const size_t k, const T& alpha, const T* A, const size_t lda, const T* B, const size_t ldb, T* C, const size_t ldc)
+    {
+        for (size_t i = 0; i < m; i++)
+        {
+            T* cRow = C + i * ldc;
+            for (size_t p = 0; p < k; p++)
+            {
+                const T a = alpha * A[i * lda + p];
+                const T* bRow = B + p * ldb;
+                for (size_t j = 0; j < n; j++)
+                {
+                    cRow[j] += a * bRow[j];
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Serial blocked product C += alpha * A * B, following the Goto/BLIS scheme: B is packed per KC x NC panel,
+    /// A per MC x KC block, and a register-tiled micro-kernel computes MR x NR tiles of C.
+    /// </summary>
+    template <typename T>
+    void BlockedGemm(const size_t m, const size_t n, const size_t k,
+                     const T& alpha, const T* A, const size_t lda,
+                     const T* B, const size_t ldb,
+                     T* C, const size_t ldc)
+    {
+        using Blocking = GemmBlocking<T>;
+
+        // Packing buffers are reused between calls on the same thread
+        thread_local std::vector<T> packedA;
+        thread_local std::vector<T> packedB;
+        packedA.resize((Blocking::MC + Blocking::MR) * Blocking::KC);
+        packedB.resize((Blocking::NC + Blocking::NR) * Blocking::KC);
+
+        for (size_t jc = 0; jc < n; jc += Blocking::NC)
+        {
+            const size_t nc = std::min(Blocking::NC, n - jc);
+            for (size_t pc = 0; pc < k; pc += Blocking::KC)
+            {
+                const size_t kc = std::min(Blocking::KC, k - pc);
+                PackB(kc, nc, B + pc * ldb + jc, ldb, packedB.data());
+
+                for (size_t ic = 0; ic < m; ic += Blocking::MC)
+                {
+                    const size_t mc = std::min(Blocking::MC, m - ic);
+                    PackA(mc, kc, A + ic * lda + pc, lda, alpha, packedA.data());
+                    GemmMacroKernel(mc, nc, kc, packedA.data(), packedB.data(), C + ic * ldc + jc, ldc);
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Splits C into independent tiles of whole MC row blocks and NR column multiples, each tile is computed
+    /// by BlockedGemm on one thread of the pool. Aims for a few tiles per thread to balance the load.
+    /// </summary>
+    template <typename T>
+    void ParallelGemm(const size_t m, const size_t n, const size_t k,
+                      const T& alpha, const T* A, const size_t lda,
+                      const T* B, const size_t ldb,
+                      T* C, const size_t ldc, ThreadPool& pool)
+    {
+        using Blocking = GemmBlocking<T>;
+
+        const size_t targetTileCount = 4 * pool.GetThreadCount();
+        const size_t tileRows = std::min(Blocking::MC, ((m + targetTileCount - 1) / targetTileCount + Blocking::MR - 1) / Blocking::MR * Blocking::MR);
+        const size_t rowTileCount = (m + tileRows - 1) / tileRows;
+        const size_t columnTileTarget = (targetTileCount + rowTileCount - 1) / rowTileCount;
+        const size_t tileColumns = std::min(Blocking::NC, ((n + columnTileTarget - 1) / columnTileTarget + Blocking::NR - 1) / Blocking::NR * Blocking::NR);
+        const size_t columnTileCount = (n + tileColumns - 1) / tileColumns;
+
+        pool.ParallelFor(rowTileCount * columnTileCount, [&](const size_t tile)
+                         {
+                             const size_t row = (tile / columnTileCount) * tileRows;
+                             const size_t column = (tile % columnTileCount) * tileColumns;
+                             BlockedGemm(std::min(tileRows, m - row), std::min(tileColumns, n - column), k,
+                                         alpha, A + row * lda, lda,
+                                         B + column, ldb,
+                                         C + row * ldc + column, ldc); });
+    }
+
+    /// <summary>
+    /// C += alpha * A * B on the calling thread, for callers that distribute the work themselves, such as the column
+    /// blocks of the TRSM. Small products use an unpacked loop, larger ones the packed BlockedGemm.
+    /// </summary>
+    template <typename T>
+    void SerialGemm(const size_t m, const size_t n, const size_t k,
+                    const T& alpha, const T* A, const size_t lda,
+                    const T* B, const size_t ldb,
+                    T* C, const size_t ldc)
+    {
+        if (m == 0 || n == 0 || k == 0)
+            return;
+
+        if (m * n * k <= SmallGemmThreshold)
+            SmallGemm(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+        else
+            BlockedGemm(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+    }
+
+    /// <summary>
+    /// General matrix-matrix product C = alpha * A * B + beta * C on row-major storage, where A is m x k, B is k x n and C is m x n.
+    /// lda, ldb and ldc are the distances between consecutive rows. C may not overlap A or B.
+    ///
+    /// Small products use an unpacked loop, large products are distributed over Parallel::GlobalThreadPool().
+    /// </summary>
+    template <typename T>
+    void Gemm(const size_t m, const size_t n, const size_t k,
+              const T& alpha, const T* A, const size_t lda,
+              const T* B, const size_t ldb,
+              const T& beta, T* C, const size_t ldc)
+    {
+        ScaleMatrix(m, n, beta, C, ldc);
+        if (m == 0 || n == 0 || k == 0 || alpha == T(0))
+            return;
+
+        if (m * n * k >= ParallelGemmThreshold)
+        {
+            ThreadPool& pool = Parallel::GlobalThreadPool();
+            if (pool.GetThreadCount() > 1)
+            {
+                ParallelGemm(m, n, k, alpha, A, lda, B, ldb, C, ldc, pool);
+                return;
+            }
+        }
+
+        SerialGemm(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+#include "ThreadPool.hpp"
+
+namespace LinearAlgebra::Blas
+{
+    // Below this amount of matrix entries, the product stays on the calling thread
+    constexpr size_t ParallelGemvThreshold = 256 * 1024;
+
+    // Minimal number of rows per parallel task
+    constexpr size_t GemvRowBlock = 32;
+
+    /// <summary>
+    /// Serial y = alpha * A * x + beta * y for the rows [0, m) of a row-major A with leading dimension lda.
+    /// </summary>
+    template <typename T>
+    void SerialGemv(const size_t m, const size_t n, const T& alpha, const T* A, const size_t lda, const T* x, const T& beta, T* y)
+    {
+        for (size_t i = 0; i < m; i++)
+        {
+            const T* row = A + i * lda;
+
+            // Independent partial sums break the dependency chain of the reduction
+            T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+            size_t j = 0;
+            for (; j + 4 <= n; j += 4)
+            {
+                sum0 += row[j] * x[j];
+                sum1 += row[j + 1] * x[j + 1];
+                sum2 += row[j + 2] * x[j + 2];
+                sum3 += row[j + 3] * x[j + 3];
+            }
+            for (; j < n; j++)
+            {
+                sum0 += row[j] * x[j];
+            }
+
+            const T dotProduct = (sum0 + sum1) + (sum2 + sum3);
+            y[i] = beta == T(0) ? alpha * dotProduct : alpha * dotProduct + beta * y[i];
+        }
+    }
+
+    /// <summary>
+    /// General matrix-vector product y = alpha * A * x + beta * y, where A is a row-major m x n matrix with leading dimension lda.
+    /// y may not overlap A or x. Large products are distributed over Parallel::GlobalThreadPool() in blocks of rows.
+    /// </summary>
+    template <typename T>
+    void Gemv(const size_t m, const size_t n, const T& alpha, const T* A, const size_t lda, const T* x, const T& beta, T* y)
+    {
+        if (m * n < ParallelGemvThreshold)
+        {
+            SerialGemv(m, n, alpha, A, lda, x, beta, y);
+            return;
+        }
+
+        ThreadPool& pool = Parallel::GlobalThreadPool();
+        const size_t blockCount = std::min(4 * pool.GetThreadCount(), (m + GemvRowBlock - 1) / GemvRowBlock);
+        const size_t blockRows = (m + blockCount - 1) / blockCount;
+        pool.ParallelFor(blockCount, [&](const size_t block)
+                         {
+                             const size_t row = block * blockRows;
+                             if (row < m)
+                                 SerialGemv(std::min(blockRows, m - row), n, alpha, A + row * lda, lda, x, beta, y + row); });
+    }
+}
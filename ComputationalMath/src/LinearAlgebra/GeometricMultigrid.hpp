@@ -0,0 +1,62 @@
+#pragma once
+#include <stdexcept>
+#include <vector>
+
+#include "Multigrid.hpp"
+#include "SparseMatrix.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Geometric multigrid on nested meshes, of which the prolongations interpolate the discrete functions of every
+    /// coarser mesh on the next finer one, prolongations[l] maps the unknowns of mesh l + 1 to those of mesh l. Unlike
+    /// AlgebraicMultigrid the setup only forms the coarse operators, and halving the mesh size keeps a quarter of the
+    /// unknowns in 2D, and the operator complexity is about 4 / 3.
+    ///
+    /// The coarse operators are either the Galerkin products R A P, which for nested P1 meshes equal the operators
+    /// assembled on the coarse meshes, or given, e.g. rediscretized with a coarser time step or coefficient.
+    /// </summary>
+    template <typename T>
+    class GeometricMultigrid : public MultigridHierarchy<T>
+    {
+    public:
+        GeometricMultigrid(const SparseMatrix<T>& matrix, const std::vector<SparseMatrix<T>>& prolongations, MultigridCycleSettings settings = {});
+
+        /// <summary>
+        /// Hierarchy of the operators of all meshes, operators[0] is A, and the prolongations between them.
+        /// </summary>
+        GeometricMultigrid(const std::vector<SparseMatrix<T>>& operators, const std::vector<SparseMatrix<T>>& prolongations,
+                           MultigridCycleSettings settings = {});
+
+    private:
+        static const SparseMatrix<T>& FinestOperator(const std::vector<SparseMatrix<T>>& operators)
+        {
+            if (operators.empty())
+                throw std::invalid_argument("Hierarchy should have at least one level");
+            return operators[0];
+        }
+    };
+
+    template <typename T>
+    GeometricMultigrid<T>::GeometricMultigrid(const SparseMatrix<T>& matrix, const std::vector<SparseMatrix<T>>& prolongations,
+                                              const MultigridCycleSettings settings)
+        : MultigridHierarchy<T>(matrix, settings)
+    {
+        for (const SparseMatrix<T>& prolongation : prolongations)
+            this->AddGalerkinLevel(prolongation);
+        this->Finalize();
+    }
+
+    template <typename T>
+    GeometricMultigrid<T>::GeometricMultigrid(const std::vector<SparseMatrix<T>>& operators, const std::vector<SparseMatrix<T>>& prolongations,
+                                              const MultigridCycleSettings settings)
+        : MultigridHierarchy<T>(FinestOperator(operators), settings)
+    {
+        if (operators.size() != prolongations.size() + 1)
+            throw std::invalid_argument("Hierarchy should have one prolongation less than operators");
+
+        for (size_t level = 0; level < prolongations.size(); level++)
+            this->AddLevel(prolongations[level], operators[level + 1]);
+        this->Finalize();
+    }
+}
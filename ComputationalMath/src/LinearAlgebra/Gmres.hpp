@@ -0,0 +1,188 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "IterativeSettings.hpp"
+#include "Preconditioners.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Restarted GMRES(m) for general non-singular A, including non-symmetric and indefinite matrices. Preconditioned
+    /// from the right, A M^-1 u = b with x = M^-1 u, such that the residual minimized, and reported, is the one of
+    /// the original system. The Krylov basis of m + 1 vectors and the Hessenberg matrix are allocated once, at
+    /// construction. Iteration j of a cycle costs one SpMV, one application of the preconditioner and j + 1
+    /// orthogonalizations, thus larger m converges in fewer iterations, at a higher cost and memory per iteration.
+    /// </summary>
+    template <typename T>
+    class GmresSolver
+    {
+    public:
+        explicit GmresSolver(size_t size, size_t restart = 30, IterativeSettings settings = {});
+
+        const IterativeSettings& GetSettings() const { return m_settings; }
+        size_t GetRestart() const { return m_restart; }
+
+        /// <summary>
+        /// Solves A x = b, starting from the initial guess in x. Every restart recomputes the true residual, which
+        /// replaces the estimate of the last iteration of the cycle in the report.
+        /// </summary>
+        template <Preconditioner<T> P>
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner);
+
+        IterativeReport Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x)
+        {
+            return Solve(A, b, x, IdentityPreconditioner<T>());
+        }
+
+    private:
+        IterativeSettings m_settings;
+        size_t m_restart;
+        std::vector<ColumnVector<T>> m_basis;
+        ColumnVector<T> m_preconditioned;
+
+        // Upper triangularized Hessenberg matrix, column j stores rows 0..j + 1 at offset j * (m + 1)
+        std::vector<T> m_hessenberg;
+        std::vector<T> m_cosines;
+        std::vector<T> m_sines;
+        std::vector<T> m_rotatedResidual;
+
+        T& Hessenberg(const size_t row, const size_t column) { return m_hessenberg[column * (m_restart + 1) + row]; }
+    };
+
+    template <typename T>
+    GmresSolver<T>::GmresSolver(const size_t size, const size_t restart, const IterativeSettings settings)
+        : m_settings(settings), m_restart(restart), m_preconditioned(size), m_hessenberg((restart + 1) * restart),
+          m_cosines(restart), m_sines(restart), m_rotatedResidual(restart + 1)
+    {
+        if (restart == 0)
+            throw std::invalid_argument("Restart length should be positive");
+
+        m_basis.reserve(restart + 1);
+        for (size_t i = 0; i <= restart; i++)
+            m_basis.emplace_back(size);
+    }
+
+    template <typename T>
+    template <Preconditioner<T> P>
+    IterativeReport GmresSolver<T>::Solve(const SparseMatrix<T>& A, const ColumnVector<T>& b, ColumnVector<T>& x, const P& preconditioner)
+    {
+        AssertSolverDimensions(m_preconditioned.GetLength(), A, b, x);
+
+        IterativeReport report;
+        report.ResidualNorms.reserve(m_settings.MaxIterations + 1);
+
+        const double rhsNorm = static_cast<double>(b.Norm2());
+        if (rhsNorm == 0.0)
+        {
+            x.Fill(T(0));
+            report.ResidualNorms.push_back(0.0);
+            report.Converged = true;
+            return report;
+        }
+
+        // v_0 = r = b - A x
+        ColumnVector<T>& residual = m_basis[0];
+        residual = b;
+        Spmv(T(-1), A, x, T(1), residual);
+        T beta = residual.Norm2();
+        report.ResidualNorms.push_back(static_cast<double>(beta) / rhsNorm);
+        report.Converged = report.ResidualNorms.back() <= m_settings.Tolerance;
+
+        bool breakdown = false;
+        while (!report.Converged && !breakdown && report.Iterations < m_settings.MaxIterations)
+        {
+            m_basis[0].Scale(T(1) / beta);
+            std::fill(m_rotatedResidual.begin(), m_rotatedResidual.end(), T(0));
+            m_rotatedResidual[0] = beta;
+
+            size_t j = 0;
+            while (j < m_restart && report.Iterations < m_settings.MaxIterations)
+            {
+                // Arnoldi, v_{j + 1} = A M^-1 v_j orthogonalized against v_0..v_j by modified Gram-Schmidt
+                preconditioner.Apply(m_basis[j], m_preconditioned);
+                ColumnVector<T>& next = m_basis[j + 1];
+                Spmv(T(1), A, m_preconditioned, T(0), next);
+                for (size_t i = 0; i <= j; i++)
+                {
+                    Hessenberg(i, j) = next.Dot(m_basis[i]);
+                    next.Axpy(-Hessenberg(i, j), m_basis[i]);
+                }
+                const T nextNorm = next.Norm2();
+                Hessenberg(j + 1, j) = nextNorm;
+
+                // Apply the previous Givens rotations to the new column, and eliminate its subdiagonal entry
+                for (size_t i = 0; i < j; i++)
+                {
+                    const T upper = Hessenberg(i, j);
+                    const T lower = Hessenberg(i + 1, j);
+                    Hessenberg(i, j) = m_cosines[i] * upper + m_sines[i] * lower;
+                    Hessenberg(i + 1, j) = m_cosines[i] * lower - m_sines[i] * upper;
+                }
+                const T diagonal = std::hypot(Hessenberg(j, j), Hessenberg(j + 1, j));
+                if (diagonal == T(0))
+                {
+                    breakdown = true; // A M^-1 is singular on the Krylov subspace
+                    break;
+                }
+                m_cosines[j] = Hessenberg(j, j) / diagonal;
+                m_sines[j] = Hessenberg(j + 1, j) / diagonal;
+                Hessenberg(j, j) = diagonal;
+                Hessenberg(j + 1, j) = T(0);
+                m_rotatedResidual[j + 1] = -m_sines[j] * m_rotatedResidual[j];
+                m_rotatedResidual[j] = m_cosines[j] * m_rotatedResidual[j];
+
+                j++;
+                report.Iterations++;
+                report.ResidualNorms.push_back(std::abs(static_cast<double>(m_rotatedResidual[j])) / rhsNorm);
+                if (report.ResidualNorms.back() <= m_settings.Tolerance || nextNorm == T(0))
+                    break;
+                next.Scale(T(1) / nextNorm);
+            }
+
+            // y = R^-1 g by back substitution, in place, and x += M^-1 V y with v_j as work vector
+            for (size_t i = j; i-- > 0;)
+            {
+                T sum = m_rotatedResidual[i];
+                for (size_t k = i + 1; k < j; k++)
+                    sum -= Hessenberg(i, k) * m_rotatedResidual[k];
+                m_rotatedResidual[i] = sum / Hessenberg(i, i);
+            }
+            ColumnVector<T>& update = m_basis[j];
+            update.Fill(T(0));
+            for (size_t i = 0; i < j; i++)
+                update.Axpy(m_rotatedResidual[i], m_basis[i]);
+            preconditioner.Apply(update, m_preconditioned);
+            x.Axpy(T(1), m_preconditioned);
+
+            // Restart from the true residual, which may differ from the estimate due to rounding
+            residual = b;
+            Spmv(T(-1), A, x, T(1), residual);
+            beta = residual.Norm2();
+            report.ResidualNorms.back() = static_cast<double>(beta) / rhsNorm;
+            report.Converged = report.ResidualNorms.back() <= m_settings.Tolerance;
+        }
+        return report;
+    }
+
+    /// <summary>
+    /// Solves A x = b with restarted, preconditioned GMRES(restart) from x = 0. The report, if given, receives the
+    /// residual history.
+    /// </summary>
+    template <typename T, Preconditioner<T> P>
+    ColumnVector<T> Gmres(const SparseMatrix<T>& A, const ColumnVector<T>& b, const P& preconditioner, const size_t restart = 30,
+                          const IterativeSettings& settings = {}, IterativeReport* report = nullptr)
+    {
+        ColumnVector<T> x(b.GetLength());
+        x.Fill(T(0));
+        GmresSolver<T> solver(b.GetLength(), restart, settings);
+        IterativeReport result = solver.Solve(A, b, x, preconditioner);
+        if (report != nullptr)
+            *report = std::move(result);
+        return x;
+    }
+}
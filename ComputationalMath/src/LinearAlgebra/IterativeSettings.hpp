@@ -0,0 +1,50 @@
+#pragma once
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Convergence of an iterative solve. ResidualNorms holds the relative residual |b - Ax|_2 / |b|_2 of the initial
+    /// guess and after every iteration, thus Iterations + 1 entries. Converged is false when the iteration limit was
+    /// hit, or the iteration broke down.
+    /// </summary>
+    struct IterativeReport
+    {
+        std::vector<double> ResidualNorms;
+        size_t Iterations = 0;
+        bool Converged = false;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const IterativeReport& report)
+    {
+        os << (report.Converged ? "Converged" : "Not converged") << " after " << report.Iterations << " iterations, residuals:";
+        for (const double residual : report.ResidualNorms)
+        {
+            os << " " << residual;
+        }
+        return os << std::endl;
+    }
+
+    /// <summary>
+    /// Stopping criteria of the iterative solvers, converged once |b - Ax|_2 <= Tolerance * |b|_2.
+    /// </summary>
+    struct IterativeSettings
+    {
+        size_t MaxIterations = 1000;
+        double Tolerance = 1e-8;
+    };
+
+    template <typename T>
+    void AssertSolverDimensions(const size_t size, const SparseMatrix<T>& A, const ColumnVector<T>& b, const ColumnVector<T>& x)
+    {
+        if (A.GetRowCount() != size || A.GetColumnCount() != size)
+            throw std::invalid_argument("Matrix dimensions differ from the solver");
+        if (b.GetLength() != size || x.GetLength() != size)
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+    }
+}
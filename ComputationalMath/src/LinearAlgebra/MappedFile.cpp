@@ -0,0 +1,312 @@
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LinearAlgebra
+{
+    namespace
+    {
+#ifdef _WIN32
+        [[noreturn]] void ThrowSystemError(const std::string& operation)
+        {
+            throw std::runtime_error(operation + " failed with error " + std::to_string(GetLastError()));
+        }
+
+        size_t PageSize()
+        {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return info.dwPageSize;
+        }
+#else
+        [[noreturn]] void ThrowSystemError(const std::string& operation)
+        {
+            throw std::runtime_error(operation + " failed: " + std::strerror(errno));
+        }
+
+        size_t PageSize()
+        {
+            return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+
+        // Widens [offset, offset + length) to whole pages, clipped to [0, byteCount)
+        void AlignToPages(size_t& offset, size_t& length, const size_t byteCount)
+        {
+            const size_t pageSize = PageSize();
+            const size_t end = std::min(byteCount, offset + length);
+            const size_t begin = std::min(offset, end) / pageSize * pageSize;
+            offset = begin;
+            length = end - begin;
+        }
+    }
+
+#ifdef _WIN32
+    MappedFile::MappedFile()
+        : m_data(nullptr), m_byteCount(0), m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+    {
+    }
+
+    MappedFile::MappedFile(const std::string& path, const size_t byteCount)
+        : MappedFile()
+    {
+        m_file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+            ThrowSystemError("Creating " + path);
+        Map(byteCount, false);
+    }
+
+    MappedFile::MappedFile(const size_t byteCount)
+        : MappedFile()
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        char path[MAX_PATH];
+        if (GetTempFileNameA(directory.string().c_str(), "cm", 0, path) == 0)
+            ThrowSystemError("Creating a temporary file");
+
+        m_file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+            ThrowSystemError("Creating a temporary file");
+        Map(byteCount, false);
+    }
+
+    MappedFile::MappedFile(const std::string& path)
+        : MappedFile()
+    {
+        m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER size;
+        if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size))
+        {
+            const DWORD error = GetLastError();
+            Close();
+            SetLastError(error);
+            ThrowSystemError("Opening " + path);
+        }
+        Map(static_cast<size_t>(size.QuadPart), true);
+    }
+
+    void MappedFile::Map(const size_t byteCount, const bool copyOnWrite)
+    {
+        m_byteCount = byteCount;
+        if (byteCount == 0)
+            return;
+
+        if (copyOnWrite)
+        {
+            m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            m_data = m_mapping ? static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, byteCount)) : nullptr;
+            if (!m_data)
+            {
+                const DWORD error = GetLastError();
+                Close();
+                SetLastError(error);
+                ThrowSystemError("Mapping the file");
+            }
+            return;
+        }
+
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(byteCount);
+        if (!SetFilePointerEx(m_file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(m_file))
+        {
+            const DWORD error = GetLastError();
+            Close();
+            SetLastError(error);
+            ThrowSystemError("Resizing the file");
+        }
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        m_data = m_mapping ? static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, byteCount)) : nullptr;
+        if (!m_data)
+        {
+            const DWORD error = GetLastError();
+            Close();
+            SetLastError(error);
+            ThrowSystemError("Mapping the file");
+        }
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+        m_data = nullptr;
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+        m_byteCount = 0;
+    }
+
+    void MappedFile::Prefetch(size_t offset, size_t length) const
+    {
+        AlignToPages(offset, length, m_byteCount);
+        if (length == 0)
+            return;
+
+        WIN32_MEMORY_RANGE_ENTRY range{m_data + offset, length};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+    void MappedFile::Flush(size_t offset, size_t length)
+    {
+        AlignToPages(offset, length, m_byteCount);
+        if (length != 0)
+            FlushViewOfFile(m_data + offset, length);
+    }
+
+    void MappedFile::Evict(size_t offset, size_t length)
+    {
+        // Unlocking pages that are not locked removes them from the working set, they stay in the file cache
+        AlignToPages(offset, length, m_byteCount);
+        if (length == 0)
+            return;
+        FlushViewOfFile(m_data + offset, length);
+        VirtualUnlock(m_data + offset, length);
+    }
+#else
+    MappedFile::MappedFile()
+        : m_data(nullptr), m_byteCount(0), m_file(-1)
+    {
+    }
+
+    MappedFile::MappedFile(const std::string& path, const size_t byteCount)
+        : MappedFile()
+    {
+        m_file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_file < 0)
+            ThrowSystemError("Creating " + path);
+        Map(byteCount, false);
+    }
+
+    MappedFile::MappedFile(const size_t byteCount)
+        : MappedFile()
+    {
+        // The file is removed right away, it lives on until the mapping and descriptor are closed
+        std::string path = (std::filesystem::temp_directory_path() / "ComputationalMath-XXXXXX").string();
+        m_file = mkstemp(path.data());
+        if (m_file < 0)
+            ThrowSystemError("Creating a temporary file");
+        unlink(path.c_str());
+        Map(byteCount, false);
+    }
+
+    MappedFile::MappedFile(const std::string& path)
+        : MappedFile()
+    {
+        m_file = open(path.c_str(), O_RDONLY);
+        struct stat status;
+        if (m_file < 0 || fstat(m_file, &status) != 0)
+        {
+            const int error = errno;
+            Close();
+            errno = error;
+            ThrowSystemError("Opening " + path);
+        }
+        Map(static_cast<size_t>(status.st_size), true);
+    }
+
+    void MappedFile::Map(const size_t byteCount, const bool copyOnWrite)
+    {
+        m_byteCount = byteCount;
+        if (byteCount == 0)
+            return;
+
+        if (!copyOnWrite && ftruncate(m_file, static_cast<off_t>(byteCount)) != 0)
+        {
+            const int error = errno;
+            Close();
+            errno = error;
+            ThrowSystemError("Resizing the file");
+        }
+
+        void* data = mmap(nullptr, byteCount, PROT_READ | PROT_WRITE, copyOnWrite ? MAP_PRIVATE : MAP_SHARED, m_file, 0);
+        if (data == MAP_FAILED)
+        {
+            const int error = errno;
+            Close();
+            errno = error;
+            ThrowSystemError("Mapping the file");
+        }
+        m_data = static_cast<char*>(data);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+            munmap(m_data, m_byteCount);
+        if (m_file >= 0)
+            close(m_file);
+        m_data = nullptr;
+        m_file = -1;
+        m_byteCount = 0;
+    }
+
+    void MappedFile::Prefetch(size_t offset, size_t length) const
+    {
+        AlignToPages(offset, length, m_byteCount);
+        if (length != 0)
+            madvise(m_data + offset, length, MADV_WILLNEED);
+    }
+
+    void MappedFile::Flush(size_t offset, size_t length)
+    {
+        AlignToPages(offset, length, m_byteCount);
+        if (length != 0)
+            msync(m_data + offset, length, MS_ASYNC);
+    }
+
+    void MappedFile::Evict(size_t offset, size_t length)
+    {
+        // The mapping is shared, thus dropping the pages keeps their contents in the file
+        AlignToPages(offset, length, m_byteCount);
+        if (length == 0)
+            return;
+        msync(m_data + offset, length, MS_ASYNC);
+        madvise(m_data + offset, length, MADV_DONTNEED);
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : MappedFile()
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        Close();
+        std::swap(m_data, other.m_data);
+        std::swap(m_byteCount, other.m_byteCount);
+        std::swap(m_file, other.m_file);
+#ifdef _WIN32
+        std::swap(m_mapping, other.m_mapping);
+#endif
+        return *this;
+    }
+}
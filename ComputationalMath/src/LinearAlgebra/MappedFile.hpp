@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Memory mapping of a whole file, which lets data larger than the RAM be addressed as memory and
+    /// paged in and out by the operating system. Prefetch, Flush and Evict give hints on the access pattern, such that
+    /// I/O overlaps computation and the resident set stays bounded. Their ranges are widened to whole pages.
+    /// Errors of the operating system are thrown as std::runtime_error.
+    /// </summary>
+    class MappedFile
+    {
+    public:
+        MappedFile();
+
+        /// <summary>
+        /// Creates the file at path, or truncates an existing one, with byteCount zero bytes.
+        /// </summary>
+        MappedFile(const std::string& path, size_t byteCount);
+
+        /// <summary>
+        /// Anonymous file of byteCount zero bytes in the temporary directory, removed once it is closed.
+        /// </summary>
+        explicit MappedFile(size_t byteCount);
+
+        /// <summary>
+        /// Maps the existing file at path copy-on-write: pages are read on first access, and writes through Data()
+        /// stay private to this mapping and never reach the file.
+        /// </summary>
+        explicit MappedFile(const std::string& path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        char* Data() { return m_data; }
+        const char* Data() const { return m_data; }
+        size_t GetByteCount() const { return m_byteCount; }
+
+        /// <summary>
+        /// Starts reading the range in the background, without waiting for it.
+        /// </summary>
+        void Prefetch(size_t offset, size_t length) const;
+
+        /// <summary>
+        /// Starts writing the modified pages of the range back to the file, without waiting for it.
+        /// </summary>
+        void Flush(size_t offset, size_t length);
+
+        /// <summary>
+        /// Flushes the range and releases its pages from memory, the next access reads them from the file again.
+        /// Private writes to a copy-on-write mapping are discarded.
+        /// </summary>
+        void Evict(size_t offset, size_t length);
+
+    private:
+        void Map(size_t byteCount, bool copyOnWrite);
+        void Close();
+
+    private:
+        char* m_data;
+        size_t m_byteCount;
+#ifdef _WIN32
+        void* m_file;
+        void* m_mapping;
+#else
+        int m_file;
+#endif
+    };
+}
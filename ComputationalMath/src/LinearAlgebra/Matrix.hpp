@@ -6,28 +6,76 @@
 #include <stdexcept>
 #include <vector>
 
+#include "AlignedStorage.hpp"
+#include "Blas1.hpp"
+#include "Gemm.hpp"
+#include "Gemv.hpp"
+#include "MatrixView.hpp"
+#include "SmallMatrix.hpp"
 #include "VectorBase.hpp"
 
-// #define SIMD_ACCELERATION
-
 namespace LinearAlgebra
 {
     template <typename T>
     class Matrix
     {
     public:
+        using ValueType = T;
+        using ResultType = Matrix<T>;
+
         Matrix();
         Matrix(size_t rowCount, size_t columnCount);
         Matrix(size_t rowCount, size_t columnCount, std::span<T> data);
         Matrix(size_t rowCount, size_t columnCount, const std::vector<T>& data);
+
+        /// <summary>
+        /// Adopts storage in the layout of this matrix without copying: rows of LeadingDimension<T>(columnCount)
+        /// elements with zero padding, PaddedLength<T>(rowCount * LeadingDimension<T>(columnCount)) elements in total,
+        /// aligned as in StorageTraits<T>. The storage is shared until the matrix is reassigned to different dimensions.
+        /// </summary>
+        Matrix(size_t rowCount, size_t columnCount, std::shared_ptr<T[]> storage);
         Matrix(const Matrix& mat);
+        Matrix(Matrix&& mat) noexcept;
         Matrix(const std::initializer_list<RowVector<T>>& values);
 
+        Matrix& operator=(const Matrix& mat);
+        Matrix& operator=(Matrix&& mat) noexcept;
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, Matrix<T>>
+        Matrix(const E& expression);
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, Matrix<T>>
+        Matrix& operator=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, Matrix<T>>
+        Matrix& operator+=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, Matrix<T>>
+        Matrix& operator-=(const E& expression);
+
+        Matrix& operator*=(const T& scalar);
+
         T GetValue(size_t row, size_t column) const;
         void SetValue(size_t row, size_t column, const T& value);
 
-        RowVector<T> GetRow(size_t row) const;
-        ColumnVector<T> GetColumn(size_t column) const;
+        /// <summary>
+        /// Zero-copy views on the storage of this matrix, see MatrixView and VectorView.
+        /// </summary>
+        VectorView<T, RowVector<T>> GetRow(size_t row);
+        VectorView<const T, RowVector<T>> GetRow(size_t row) const;
+        VectorView<T, ColumnVector<T>> GetColumn(size_t column);
+        VectorView<const T, ColumnVector<T>> GetColumn(size_t column) const;
+
+        MatrixView<T> View();
+        MatrixView<const T> View() const;
+        MatrixView<T> Block(size_t row, size_t column, size_t rowCount, size_t columnCount);
+        MatrixView<const T> Block(size_t row, size_t column, size_t rowCount, size_t columnCount) const;
+        MatrixView<T> TransposedView();
+        MatrixView<const T> TransposedView() const;
 
         T* Data();
         const T* Data() const;
@@ -35,12 +83,27 @@ namespace LinearAlgebra
         size_t GetRowCount() const;
         size_t GetColumnCount() const;
 
+        /// <summary>
+        /// Distance between consecutive rows in Data(), at least the column count. Rows may be padded to keep them
+        /// aligned, see StorageTraits.
+        /// </summary>
+        size_t GetLeadingDimension() const;
+
         bool ElementwiseEquals(const Matrix& mat) const;
         bool ElementwiseCompare(const Matrix& mat, float epsilon) const;
 
         void SwapRows(size_t row1, size_t row2);
         void Fill(const T& value);
 
+        /// <summary>
+        /// In-place BLAS-1 operations on all entries, these do not allocate. Axpy computes this = alpha * X + this,
+        /// Dot is the Frobenius inner product.
+        /// </summary>
+        void Axpy(const T& alpha, const Matrix& X);
+        void Scale(const T& alpha);
+        T Dot(const Matrix& mat) const;
+        T FrobeniusNorm() const;
+
         Matrix Transposed() const;
 
         static T Determinant(const T& m11, const T& m12,
@@ -53,43 +116,48 @@ namespace LinearAlgebra
     public:
         T& operator()(size_t row, size_t column);
         const T& operator()(size_t row, size_t column) const;
-        Matrix operator+(const Matrix& mat) const;
-        Matrix operator-(const Matrix& mat) const;
 
         Matrix operator*(const Matrix& mat) const;
         ColumnVector<T> operator*(const ColumnVector<T>& vector) const;
-        Matrix operator*(const T& scalar) const;
 
     private:
         void ThrowIfOutOfRange(size_t row, size_t column) const;
         void ThrowIfRowOutOfRange(size_t row) const;
         void ThrowIfColumnOutOfRange(size_t column) const;
         void AssertNoOverflow() const;
+        void ThrowIfDimensionsMismatch(const Matrix& mat) const;
 
-        std::span<T> AsSpan();
-        std::span<T> AsSpan() const;
+        void Allocate();
+        void CopyFromContiguous(const T* source);
 
     private:
         size_t m_length;
         size_t m_rowCount;
         size_t m_columnCount;
+        size_t m_leadingDimension;
 
         std::shared_ptr<T[]> m_storage;
     };
 
+    template <typename T>
+    struct ExpressionOperand<Matrix<T>>
+    {
+        using Type = DenseMatrixTerminal<T, Matrix<T>>;
+    };
+
     template <typename T>
     Matrix<T>::Matrix()
-        : m_length(0), m_rowCount(0), m_columnCount(0)
+        : m_length(0), m_rowCount(0), m_columnCount(0), m_leadingDimension(0)
     {
         m_storage.reset();
     }
 
     template <typename T>
     Matrix<T>::Matrix(size_t rowCount, size_t columnCount)
-        : m_length(rowCount * columnCount), m_rowCount(rowCount), m_columnCount(columnCount)
+        : m_length(rowCount * columnCount), m_rowCount(rowCount), m_columnCount(columnCount), m_leadingDimension(LeadingDimension<T>(columnCount))
     {
         AssertNoOverflow();
-        m_storage.reset(new T[m_length]);
+        Allocate();
     }
 
     template <typename T>
@@ -99,8 +167,7 @@ namespace LinearAlgebra
         if (rowCount * columnCount != data.size())
             throw std::out_of_range("Data length different then row x column");
 
-        T* destination = m_storage.get();
-        std::copy(data.begin(), data.end(), destination);
+        CopyFromContiguous(data.data());
     }
 
     template <typename T>
@@ -110,17 +177,74 @@ namespace LinearAlgebra
         if (rowCount * columnCount != data.size())
             throw std::out_of_range("Data length different then row x column");
 
-        T* destination = m_storage.get();
-        std::copy(data.begin(), data.end(), destination);
+        CopyFromContiguous(data.data());
+    }
+
+    template <typename T>
+    Matrix<T>::Matrix(size_t rowCount, size_t columnCount, std::shared_ptr<T[]> storage)
+        : m_length(rowCount * columnCount), m_rowCount(rowCount), m_columnCount(columnCount), m_leadingDimension(LeadingDimension<T>(columnCount)),
+          m_storage(std::move(storage))
+    {
+        AssertNoOverflow();
     }
 
     template <typename T>
     Matrix<T>::Matrix(const Matrix& mat)
         : Matrix(mat.m_rowCount, mat.m_columnCount)
     {
+        // Identical layout, the zero padding is copied along
         const T* source = mat.Data();
-        T* destination = Data();
-        std::copy(source, source + m_length, destination);
+        std::copy(source, source + m_rowCount * m_leadingDimension, Data());
+    }
+
+    template <typename T>
+    Matrix<T>::Matrix(Matrix&& mat) noexcept
+        : m_length(mat.m_length), m_rowCount(mat.m_rowCount), m_columnCount(mat.m_columnCount), m_leadingDimension(mat.m_leadingDimension),
+          m_storage(std::move(mat.m_storage))
+    {
+        mat.m_length = 0;
+        mat.m_rowCount = 0;
+        mat.m_columnCount = 0;
+        mat.m_leadingDimension = 0;
+    }
+
+    template <typename T>
+    Matrix<T>& Matrix<T>::operator=(const Matrix& mat)
+    {
+        if (this == &mat)
+            return *this;
+
+        // Reuse the current storage when possible, such that repeated assignments in a loop do not allocate
+        if (m_rowCount != mat.m_rowCount || m_columnCount != mat.m_columnCount)
+        {
+            m_length = mat.m_length;
+            m_rowCount = mat.m_rowCount;
+            m_columnCount = mat.m_columnCount;
+            m_leadingDimension = mat.m_leadingDimension;
+            Allocate();
+        }
+
+        const T* source = mat.Data();
+        std::copy(source, source + m_rowCount * m_leadingDimension, Data());
+        return *this;
+    }
+
+    template <typename T>
+    Matrix<T>& Matrix<T>::operator=(Matrix&& mat) noexcept
+    {
+        if (this == &mat)
+            return *this;
+
+        m_length = mat.m_length;
+        m_rowCount = mat.m_rowCount;
+        m_columnCount = mat.m_columnCount;
+        m_leadingDimension = mat.m_leadingDimension;
+        m_storage = std::move(mat.m_storage);
+        mat.m_length = 0;
+        mat.m_rowCount = 0;
+        mat.m_columnCount = 0;
+        mat.m_leadingDimension = 0;
+        return *this;
     }
 
     template <typename T>
@@ -131,6 +255,7 @@ namespace LinearAlgebra
             m_columnCount = 0;
             m_rowCount = 0;
             m_length = 0;
+            m_leadingDimension = 0;
             m_storage.reset();
             return;
         }
@@ -138,7 +263,8 @@ namespace LinearAlgebra
         m_rowCount = values.size();
         m_columnCount = values.begin()->GetLength();
         m_length = m_rowCount * m_columnCount;
-        m_storage.reset(new T[m_length]);
+        m_leadingDimension = LeadingDimension<T>(m_columnCount);
+        Allocate();
         T* matrixData = m_storage.get();
         for (const RowVector<T>& row : values)
         {
@@ -146,44 +272,148 @@ namespace LinearAlgebra
                 throw std::invalid_argument("Not all rows have identical lengths");
             const T* rowData = row.Data();
             std::copy(rowData, rowData + m_columnCount, matrixData);
-            matrixData += m_columnCount;
+            matrixData += m_leadingDimension;
         }
     }
 
+    template <typename T>
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, Matrix<T>>
+    Matrix<T>::Matrix(const E& expression)
+        : Matrix(expression.GetRowCount(), expression.GetColumnCount())
+    {
+        EvaluateExpression(expression, Data(), m_leadingDimension);
+    }
+
+    template <typename T>
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, Matrix<T>>
+    Matrix<T>& Matrix<T>::operator=(const E& expression)
+    {
+        if (m_rowCount != expression.GetRowCount() || m_columnCount != expression.GetColumnCount())
+            *this = Matrix(expression.GetRowCount(), expression.GetColumnCount());
+
+        // Expressions that read this matrix at (i, j) only are evaluated in place, any other view of its storage
+        // goes through a temporary, which is copied such that views of this matrix keep seeing its storage
+        if (ExpressionReadsOtherEntries(expression, Data(), m_leadingDimension, 1))
+        {
+            const Matrix evaluated(expression);
+            return *this = evaluated;
+        }
+
+        EvaluateExpression(expression, Data(), m_leadingDimension);
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, Matrix<T>>
+    Matrix<T>& Matrix<T>::operator+=(const E& expression)
+    {
+        if (m_rowCount != expression.GetRowCount() || m_columnCount != expression.GetColumnCount())
+            throw std::invalid_argument("Dimensions mismatch");
+
+        if (ExpressionReadsOtherEntries(expression, Data(), m_leadingDimension, 1))
+            return *this += Matrix(expression);
+
+        CompoundAssignExpression<AddOperation>(expression, Data(), m_leadingDimension);
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, Matrix<T>>
+    Matrix<T>& Matrix<T>::operator-=(const E& expression)
+    {
+        if (m_rowCount != expression.GetRowCount() || m_columnCount != expression.GetColumnCount())
+            throw std::invalid_argument("Dimensions mismatch");
+
+        if (ExpressionReadsOtherEntries(expression, Data(), m_leadingDimension, 1))
+            return *this -= Matrix(expression);
+
+        CompoundAssignExpression<SubtractOperation>(expression, Data(), m_leadingDimension);
+        return *this;
+    }
+
+    template <typename T>
+    Matrix<T>& Matrix<T>::operator*=(const T& scalar)
+    {
+        Scale(scalar);
+        return *this;
+    }
+
     template <typename T>
     T Matrix<T>::GetValue(const size_t row, const size_t column) const
     {
         ThrowIfOutOfRange(row, column);
-        return m_storage.get()[row * m_columnCount + column];
+        return m_storage.get()[row * m_leadingDimension + column];
     }
 
     template <typename T>
     void Matrix<T>::SetValue(const size_t row, const size_t column, const T& value)
     {
         ThrowIfOutOfRange(row, column);
-        m_storage.get()[row * m_columnCount + column] = value;
+        m_storage.get()[row * m_leadingDimension + column] = value;
     }
 
     template <typename T>
-    RowVector<T> Matrix<T>::GetRow(const size_t row) const
+    VectorView<T, RowVector<T>> Matrix<T>::GetRow(const size_t row)
     {
-        // TODO: implement view to avoid copies
-        ThrowIfRowOutOfRange(row);
-        return RowVector<T>(AsSpan().subspan(row * m_columnCount, m_columnCount));
+        return View().GetRow(row);
     }
 
     template <typename T>
-    ColumnVector<T> Matrix<T>::GetColumn(const size_t column) const
+    VectorView<const T, RowVector<T>> Matrix<T>::GetRow(const size_t row) const
     {
-        // TODO: implement view to avoid copies
-        ThrowIfColumnOutOfRange(column);
-        ColumnVector<T> result(m_rowCount);
-        T* start = m_storage.get() + column;
-        for (size_t i = 0; i < m_rowCount; i++)
-        {
-            result[i] = start[i * m_columnCount];
-        }
-        return result;
+        return View().GetRow(row);
+    }
+
+    template <typename T>
+    VectorView<T, ColumnVector<T>> Matrix<T>::GetColumn(const size_t column)
+    {
+        return View().GetColumn(column);
+    }
+
+    template <typename T>
+    VectorView<const T, ColumnVector<T>> Matrix<T>::GetColumn(const size_t column) const
+    {
+        return View().GetColumn(column);
+    }
+
+    template <typename T>
+    MatrixView<T> Matrix<T>::View()
+    {
+        return MatrixView<T>(m_storage, m_rowCount, m_columnCount, m_leadingDimension, 1);
+    }
+
+    template <typename T>
+    MatrixView<const T> Matrix<T>::View() const
+    {
+        return MatrixView<const T>(m_storage, m_rowCount, m_columnCount, m_leadingDimension, 1);
+    }
+
+    template <typename T>
+    MatrixView<T> Matrix<T>::Block(const size_t row, const size_t column, const size_t rowCount, const size_t columnCount)
+    {
+        return View().Block(row, column, rowCount, columnCount);
+    }
+
+    template <typename T>
+    MatrixView<const T> Matrix<T>::Block(const size_t row, const size_t column, const size_t rowCount, const size_t columnCount) const
+    {
+        return View().Block(row, column, rowCount, columnCount);
+    }
+
+    template <typename T>
+    MatrixView<T> Matrix<T>::TransposedView()
+    {
+        return View().Transposed();
+    }
+
+    template <typename T>
+    MatrixView<const T> Matrix<T>::TransposedView() const
+    {
+        return View().Transposed();
     }
 
     template <typename T>
@@ -210,21 +440,43 @@ namespace LinearAlgebra
         return m_columnCount;
     }
 
+    template <typename T>
+    size_t Matrix<T>::GetLeadingDimension() const
+    {
+        return m_leadingDimension;
+    }
+
     template <typename T>
     bool Matrix<T>::ElementwiseEquals(const Matrix& mat) const
     {
-        T* lhs = m_storage.get();
-        T* rhs = mat.m_storage.get();
-        return std::equal(lhs, lhs + m_length, rhs);
+        if (m_rowCount != mat.m_rowCount || m_columnCount != mat.m_columnCount)
+            return false;
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            const T* lhs = Data() + i * m_leadingDimension;
+            const T* rhs = mat.Data() + i * mat.m_leadingDimension;
+            if (!std::equal(lhs, lhs + m_columnCount, rhs))
+                return false;
+        }
+        return true;
     }
 
     template <typename T>
     bool Matrix<T>::ElementwiseCompare(const Matrix& mat, float epsilon) const
     {
-        T* lhs = m_storage.get();
-        T* rhs = mat.m_storage.get();
-        return std::equal(lhs, lhs + m_length, rhs, [epsilon](T& left, T& right)
-                          { return std::abs(left - right) < epsilon; });
+        if (m_rowCount != mat.m_rowCount || m_columnCount != mat.m_columnCount)
+            return false;
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            const T* lhs = Data() + i * m_leadingDimension;
+            const T* rhs = mat.Data() + i * mat.m_leadingDimension;
+            if (!std::equal(lhs, lhs + m_columnCount, rhs, [epsilon](const T& left, const T& right)
+                            { return std::abs(left - right) < epsilon; }))
+                return false;
+        }
+        return true;
     }
 
     template <typename T>
@@ -234,17 +486,59 @@ namespace LinearAlgebra
         ThrowIfRowOutOfRange(row2);
 
         T* data = m_storage.get();
-        size_t row1Start = row1 * m_columnCount;
+        size_t row1Start = row1 * m_leadingDimension;
         size_t row1End = row1Start + m_columnCount;
-        size_t row2Start = row2 * m_columnCount;
+        size_t row2Start = row2 * m_leadingDimension;
         std::swap_ranges(data + row1Start, data + row1End, data + row2Start);
     }
 
     template <typename T>
     void Matrix<T>::Fill(const T& value)
     {
-        T* destination = m_storage.get();
-        std::fill(destination, destination + m_length, value);
+        // Row by row, the padding stays zero
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            T* destination = Data() + i * m_leadingDimension;
+            std::fill(destination, destination + m_columnCount, value);
+        }
+    }
+
+    template <typename T>
+    void Matrix<T>::Axpy(const T& alpha, const Matrix& X)
+    {
+        ThrowIfDimensionsMismatch(X);
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            Blas::Axpy(m_columnCount, alpha, X.Data() + i * X.m_leadingDimension, Data() + i * m_leadingDimension);
+        }
+    }
+
+    template <typename T>
+    void Matrix<T>::Scale(const T& alpha)
+    {
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            Blas::Scal(m_columnCount, alpha, Data() + i * m_leadingDimension);
+        }
+    }
+
+    template <typename T>
+    T Matrix<T>::Dot(const Matrix& mat) const
+    {
+        ThrowIfDimensionsMismatch(mat);
+        T dotProduct = 0;
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            dotProduct += Blas::Dot(m_columnCount, Data() + i * m_leadingDimension, mat.Data() + i * mat.m_leadingDimension);
+        }
+        return dotProduct;
+    }
+
+    template <typename T>
+    T Matrix<T>::FrobeniusNorm() const
+    {
+        // The padding of the rows is zero
+        return Blas::Nrm2(m_rowCount * m_leadingDimension, Data());
     }
 
     template <typename T>
@@ -261,7 +555,7 @@ namespace LinearAlgebra
             {
                 for (size_t k = 0; k < block && i + k < m_rowCount; ++k)
                 {
-                    dst[j * m_rowCount + i + k] = src[(i + k) * m_columnCount + j];
+                    dst[j * transposedMat.m_leadingDimension + i + k] = src[(i + k) * m_leadingDimension + j];
                 }
             }
         }
@@ -272,7 +566,7 @@ namespace LinearAlgebra
     T Matrix<T>::Determinant(const T& m11, const T& m12,
                              const T& m21, const T& m22)
     {
-        return m11 * m22 - m21 * m12;
+        return SmallMatrix<T, 2, 2>::Determinant(m11, m12, m21, m22);
     }
 
     template <typename T>
@@ -280,19 +574,19 @@ namespace LinearAlgebra
                              const T& m21, const T& m22, const T& m23,
                              const T& m31, const T& m32, const T& m33)
     {
-        return m11 * Determinant(m22, m23, m32, m33) - m12 * Determinant(m21, m23, m31, m33) + m13 * Determinant(m21, m22, m31, m32);
+        return SmallMatrix<T, 3, 3>::Determinant(m11, m12, m13, m21, m22, m23, m31, m32, m33);
     }
 
     template <typename T>
     T& Matrix<T>::operator()(const size_t row, const size_t column)
     {
-        return m_storage.get()[row * m_columnCount + column];
+        return m_storage.get()[row * m_leadingDimension + column];
     }
 
     template <typename T>
     const T& Matrix<T>::operator()(const size_t row, const size_t column) const
     {
-        return m_storage.get()[row * m_columnCount + column];
+        return m_storage.get()[row * m_leadingDimension + column];
     }
 
     template <typename T>
@@ -321,72 +615,53 @@ namespace LinearAlgebra
         return out << ']';
     }
 
-#ifdef SIMD_ACCELERATION
-#include "SimdOps.h"
-    template <>
-    inline Matrix<int> Matrix<int>::operator+(const Matrix<int>& mat) const
-    {
-        if (m_columnCount != mat.m_columnCount || m_rowCount != mat.m_rowCount)
-            throw std::invalid_argument("Dimensions mismatch");
-
-        // Note, this operation is very simple, thus almost no time difference
-        Matrix<int> result(m_rowCount, m_columnCount);
-        LinearAlgebra::SimdOps::Sum(m_storage.get(), mat.m_storage.get(), m_length, result.m_storage.get());
-        return result;
-    }
-#endif
-
     template <typename T>
-    Matrix<T> Matrix<T>::operator+(const Matrix& mat) const
+    Matrix<T> Matrix<T>::operator*(const Matrix& mat) const
     {
-        if (m_columnCount != mat.m_columnCount || m_rowCount != mat.m_rowCount)
-            throw std::invalid_argument("Dimensions mismatch");
+        if (m_columnCount != mat.m_rowCount)
+            throw std::invalid_argument("Matrix mismatch");
 
-        T* lhs = m_storage.get();
-        T* rhs = mat.m_storage.get();
-        Matrix sum(m_rowCount, m_columnCount);
-        T* sumPointer = sum.m_storage.get();
-        std::transform(lhs, lhs + m_length, rhs, sumPointer, [](T& left, T& right)
-                       { return left + right; });
-        return sum;
+        Matrix product(m_rowCount, mat.m_columnCount);
+        Blas::Gemm(m_rowCount, mat.m_columnCount, m_columnCount,
+                   T(1), Data(), m_leadingDimension,
+                   mat.Data(), mat.m_leadingDimension,
+                   T(0), product.Data(), product.m_leadingDimension);
+        return product;
     }
 
+    /// <summary>
+    /// In-place general matrix product C = alpha * A * B + beta * C, reusing the storage of C. C may not share storage with A or B.
+    /// </summary>
     template <typename T>
-    Matrix<T> Matrix<T>::operator-(const Matrix& mat) const
+    void Gemm(const T& alpha, const Matrix<T>& A, const Matrix<T>& B, const T& beta, Matrix<T>& C)
     {
-        if (m_columnCount != mat.m_columnCount || m_rowCount != mat.m_rowCount)
-            throw std::invalid_argument("Dimensions mismatch");
-
-        T* lhs = m_storage.get();
-        T* rhs = mat.m_storage.get();
+        if (A.GetColumnCount() != B.GetRowCount())
+            throw std::invalid_argument("Matrix mismatch");
+        if (C.GetRowCount() != A.GetRowCount() || C.GetColumnCount() != B.GetColumnCount())
+            throw std::invalid_argument("Output matrix dimensions mismatch");
+        if (C.Data() != nullptr && (C.Data() == A.Data() || C.Data() == B.Data()))
+            throw std::invalid_argument("Output matrix may not alias an input matrix");
 
-        Matrix subtract(m_rowCount, m_columnCount);
-        T* subtractPointer = subtract.m_storage.get();
-        std::transform(lhs, lhs + m_length, rhs, subtractPointer, [](T& left, T& right)
-                       { return left - right; });
-        return subtract;
+        Blas::Gemm(A.GetRowCount(), B.GetColumnCount(), A.GetColumnCount(),
+                   alpha, A.Data(), A.GetLeadingDimension(),
+                   B.Data(), B.GetLeadingDimension(),
+                   beta, C.Data(), C.GetLeadingDimension());
     }
 
+    /// <summary>
+    /// In-place matrix-vector product y = alpha * A * x + beta * y, reusing the storage of y. y may not share storage with x.
+    /// </summary>
     template <typename T>
-    Matrix<T> Matrix<T>::operator*(const Matrix& mat) const
+    void Gemv(const T& alpha, const Matrix<T>& A, const ColumnVector<T>& x, const T& beta, ColumnVector<T>& y)
     {
-        if (m_columnCount != mat.m_rowCount)
-            throw std::invalid_argument("Matrix mismatch");
+        if (A.GetColumnCount() != x.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+        if (A.GetRowCount() != y.GetLength())
+            throw std::invalid_argument("Output vector dimensions mismatch");
+        if (y.Data() != nullptr && y.Data() == x.Data())
+            throw std::invalid_argument("Output vector may not alias the input vector");
 
-        Matrix product(m_rowCount, mat.m_columnCount);
-        for (size_t i = 0; i < m_rowCount; i++)
-        {
-            for (size_t j = 0; j < mat.m_columnCount; j++)
-            {
-                T dotProduct = 0;
-                for (size_t k = 0; k < m_columnCount; k++)
-                {
-                    dotProduct += GetValue(i, k) * mat.GetValue(k, j);
-                }
-                product.SetValue(i, j, dotProduct);
-            }
-        }
-        return product;
+        Blas::Gemv(A.GetRowCount(), A.GetColumnCount(), alpha, A.Data(), A.GetLeadingDimension(), x.Data(), beta, y.Data());
     }
 
     template <typename T>
@@ -414,32 +689,78 @@ namespace LinearAlgebra
             throw std::invalid_argument("Matrix Column multiplication mismatch");
 
         ColumnVector<T> result(m_rowCount);
-        for (size_t i = 0; i < m_rowCount; i++)
-        {
-            result[i] = 0;
-            for (size_t k = 0; k < m_columnCount; k++)
-            {
-                result[i] += this->GetValue(i, k) * vector.GetValue(k);
-            }
-        }
+        Blas::Gemv(m_rowCount, m_columnCount, T(1), Data(), m_leadingDimension, vector.Data(), T(0), result.Data());
         return result;
     }
 
+    /// <summary>
+    /// Matrix product of two views. The packed GEMM reads the operands with a unit column stride and an arbitrary row
+    /// stride, thus row-major blocks are multiplied without copies. Other views, e.g. transposed views, are copied once.
+    /// </summary>
     template <typename T>
-    Matrix<T> Matrix<T>::operator*(const T& scalar) const
+    Matrix<T> ViewProduct(const MatrixView<const T>& lhs, const MatrixView<const T>& rhs)
     {
-        Matrix result(m_rowCount, m_columnCount);
-        T* source = m_storage.get();
-        T* destination = result.m_storage.get();
-        std::transform(source, source + m_length, destination, [scalar](T& sourceElement)
-                       { return scalar * sourceElement; });
-        return result;
+        if (lhs.GetColumnCount() != rhs.GetRowCount())
+            throw std::invalid_argument("Matrix mismatch");
+
+        if (lhs.GetColumnStride() != 1)
+            return ViewProduct<T>(Matrix<T>(lhs).View(), rhs);
+        if (rhs.GetColumnStride() != 1)
+            return ViewProduct<T>(lhs, Matrix<T>(rhs).View());
+
+        Matrix<T> product(lhs.GetRowCount(), rhs.GetColumnCount());
+        Blas::Gemm(lhs.GetRowCount(), rhs.GetColumnCount(), lhs.GetColumnCount(),
+                   T(1), lhs.Data(), lhs.GetRowStride(),
+                   rhs.Data(), rhs.GetRowStride(),
+                   T(0), product.Data(), product.GetLeadingDimension());
+        return product;
+    }
+
+    template <typename T, typename U>
+        requires std::same_as<std::remove_const_t<T>, std::remove_const_t<U>>
+    Matrix<std::remove_const_t<T>> operator*(const MatrixView<T>& lhs, const MatrixView<U>& rhs)
+    {
+        return ViewProduct<std::remove_const_t<T>>(lhs, rhs);
+    }
+
+    template <typename T>
+    Matrix<std::remove_const_t<T>> operator*(const MatrixView<T>& lhs, const Matrix<std::remove_const_t<T>>& rhs)
+    {
+        return ViewProduct<std::remove_const_t<T>>(lhs, rhs.View());
+    }
+
+    template <typename T, typename U>
+        requires std::same_as<T, std::remove_const_t<U>>
+    Matrix<T> operator*(const Matrix<T>& lhs, const MatrixView<U>& rhs)
+    {
+        return ViewProduct<T>(lhs.View(), rhs);
     }
 
     template <typename T>
-    Matrix<T> operator*(const T& scalar, const Matrix<T>& mat)
+    ColumnVector<std::remove_const_t<T>> operator*(const MatrixView<T>& matrix, const ColumnVector<std::remove_const_t<T>>& vector)
     {
-        return mat * scalar;
+        using ValueType = std::remove_const_t<T>;
+        if (matrix.GetColumnCount() != vector.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+
+        ColumnVector<ValueType> result(matrix.GetRowCount());
+        if (matrix.GetColumnStride() == 1)
+        {
+            Blas::Gemv(matrix.GetRowCount(), matrix.GetColumnCount(), ValueType(1), matrix.Data(), matrix.GetRowStride(), vector.Data(), ValueType(0), result.Data());
+            return result;
+        }
+
+        // Column oriented product, which reads transposed row-major storage contiguously
+        result.Fill(0);
+        for (size_t j = 0; j < matrix.GetColumnCount(); j++)
+        {
+            const ValueType x = vector[j];
+            for (size_t i = 0; i < matrix.GetRowCount(); i++)
+            {
+                result[i] += matrix(i, j) * x;
+            }
+        }
+        return result;
     }
 
     template <typename T>
@@ -463,6 +784,13 @@ namespace LinearAlgebra
             throw std::out_of_range("Column out of range");
     }
 
+    template <typename T>
+    void Matrix<T>::ThrowIfDimensionsMismatch(const Matrix& mat) const
+    {
+        if (m_rowCount != mat.m_rowCount || m_columnCount != mat.m_columnCount)
+            throw std::invalid_argument("Dimensions mismatch");
+    }
+
     template <typename T>
     void Matrix<T>::AssertNoOverflow() const
     {
@@ -471,14 +799,25 @@ namespace LinearAlgebra
     }
 
     template <typename T>
-    std::span<T> Matrix<T>::AsSpan()
+    void Matrix<T>::Allocate()
     {
-        return std::span<T>{m_storage.get(), m_length};
+        m_storage = AllocateStorage<T>(m_rowCount * m_leadingDimension);
+        if (m_leadingDimension == m_columnCount)
+            return;
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            T* padding = m_storage.get() + i * m_leadingDimension + m_columnCount;
+            std::fill(padding, padding + m_leadingDimension - m_columnCount, T(0));
+        }
     }
 
     template <typename T>
-    std::span<T> Matrix<T>::AsSpan() const
+    void Matrix<T>::CopyFromContiguous(const T* source)
     {
-        return std::span<T>{m_storage.get(), m_length};
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            std::copy(source + i * m_columnCount, source + (i + 1) * m_columnCount, Data() + i * m_leadingDimension);
+        }
     }
 }
\ No newline at end of file
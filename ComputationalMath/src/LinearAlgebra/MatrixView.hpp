@@ -0,0 +1,279 @@
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Expression.hpp"
+#include "VectorBase.hpp"
+#include "VectorView.hpp"
+
+namespace LinearAlgebra
+{
+    template <typename T>
+    class Matrix;
+
+    /// <summary>
+    /// Non-owning strided view on the storage of a matrix, e.g. a block or the transpose. Entry (i, j) is stored at
+    /// Data()[i * rowStride + j * columnStride]. The view shares ownership of the storage of its parent, thus it stays
+    /// valid when the parent is destroyed or reassigned to a new buffer. T is const for read-only views.
+    ///
+    /// Like std::slice_array, assigning to a view writes the elements, it does not rebind the view. Assigned expressions
+    /// that read other entries of the viewed storage than the one they write are evaluated into a temporary first.
+    /// </summary>
+    template <typename T>
+    class MatrixView
+    {
+    public:
+        using ValueType = std::remove_const_t<T>;
+        using ResultType = Matrix<ValueType>;
+
+        MatrixView(std::shared_ptr<T[]> data, size_t rowCount, size_t columnCount, size_t rowStride, size_t columnStride);
+        MatrixView(const MatrixView& view) = default;
+
+        operator MatrixView<const T>() const
+            requires(!std::is_const_v<T>)
+        {
+            return MatrixView<const T>(m_data, m_rowCount, m_columnCount, m_rowStride, m_columnStride);
+        }
+
+        MatrixView& operator=(const MatrixView& view)
+            requires(!std::is_const_v<T>);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+        MatrixView& operator=(const E& expression);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+        MatrixView& operator+=(const E& expression);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+        MatrixView& operator-=(const E& expression);
+
+        MatrixView& operator*=(const ValueType& scalar)
+            requires(!std::is_const_v<T>);
+
+        T& operator()(size_t row, size_t column) const;
+        T& GetValue(size_t row, size_t column) const;
+
+        size_t GetRowCount() const;
+        size_t GetColumnCount() const;
+        size_t GetRowStride() const;
+        size_t GetColumnStride() const;
+        T* Data() const;
+
+        VectorView<T, RowVector<ValueType>> GetRow(size_t row) const;
+        VectorView<T, ColumnVector<ValueType>> GetColumn(size_t column) const;
+        MatrixView Block(size_t row, size_t column, size_t rowCount, size_t columnCount) const;
+        MatrixView Transposed() const;
+
+        bool ElementwiseEquals(const Matrix<ValueType>& mat) const;
+        bool ElementwiseCompare(const Matrix<ValueType>& mat, float epsilon) const;
+
+    private:
+        void ThrowIfDimensionsMismatch(size_t rowCount, size_t columnCount) const;
+
+    private:
+        std::shared_ptr<T[]> m_data;
+        size_t m_rowCount;
+        size_t m_columnCount;
+        size_t m_rowStride;
+        size_t m_columnStride;
+    };
+
+    template <typename T>
+    struct ExpressionOperand<MatrixView<T>>
+    {
+        using Type = StridedMatrixTerminal<std::remove_const_t<T>, Matrix<std::remove_const_t<T>>>;
+    };
+
+    template <typename T>
+    MatrixView<T>::MatrixView(std::shared_ptr<T[]> data, const size_t rowCount, const size_t columnCount, const size_t rowStride, const size_t columnStride)
+        : m_data(std::move(data)), m_rowCount(rowCount), m_columnCount(columnCount), m_rowStride(rowStride), m_columnStride(columnStride)
+    {
+    }
+
+    template <typename T>
+    MatrixView<T>& MatrixView<T>::operator=(const MatrixView& view)
+        requires(!std::is_const_v<T>)
+    {
+        ThrowIfDimensionsMismatch(view.m_rowCount, view.m_columnCount);
+        if (ExpressionReadsOtherEntries(view, Data(), m_rowStride, m_columnStride))
+            return *this = Matrix<ValueType>(view);
+
+        StridedAssignExpression<AssignOperation>(view, Data(), m_rowStride, m_columnStride);
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+    MatrixView<T>& MatrixView<T>::operator=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetRowCount(), expression.GetColumnCount());
+        if (ExpressionReadsOtherEntries(expression, Data(), m_rowStride, m_columnStride))
+            return *this = Matrix<ValueType>(expression);
+
+        StridedAssignExpression<AssignOperation>(expression, Data(), m_rowStride, m_columnStride);
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+    MatrixView<T>& MatrixView<T>::operator+=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetRowCount(), expression.GetColumnCount());
+        if (ExpressionReadsOtherEntries(expression, Data(), m_rowStride, m_columnStride))
+            return *this += Matrix<ValueType>(expression);
+
+        StridedAssignExpression<AddOperation>(expression, Data(), m_rowStride, m_columnStride);
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Matrix<std::remove_const_t<T>>>)
+    MatrixView<T>& MatrixView<T>::operator-=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetRowCount(), expression.GetColumnCount());
+        if (ExpressionReadsOtherEntries(expression, Data(), m_rowStride, m_columnStride))
+            return *this -= Matrix<ValueType>(expression);
+
+        StridedAssignExpression<SubtractOperation>(expression, Data(), m_rowStride, m_columnStride);
+        return *this;
+    }
+
+    template <typename T>
+    MatrixView<T>& MatrixView<T>::operator*=(const ValueType& scalar)
+        requires(!std::is_const_v<T>)
+    {
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t j = 0; j < m_columnCount; j++)
+            {
+                (*this)(i, j) *= scalar;
+            }
+        }
+        return *this;
+    }
+
+    template <typename T>
+    T& MatrixView<T>::operator()(const size_t row, const size_t column) const
+    {
+        return m_data.get()[row * m_rowStride + column * m_columnStride];
+    }
+
+    template <typename T>
+    T& MatrixView<T>::GetValue(const size_t row, const size_t column) const
+    {
+        if (row >= m_rowCount || column >= m_columnCount)
+            throw std::out_of_range("Index out of range");
+        return (*this)(row, column);
+    }
+
+    template <typename T>
+    size_t MatrixView<T>::GetRowCount() const
+    {
+        return m_rowCount;
+    }
+
+    template <typename T>
+    size_t MatrixView<T>::GetColumnCount() const
+    {
+        return m_columnCount;
+    }
+
+    template <typename T>
+    size_t MatrixView<T>::GetRowStride() const
+    {
+        return m_rowStride;
+    }
+
+    template <typename T>
+    size_t MatrixView<T>::GetColumnStride() const
+    {
+        return m_columnStride;
+    }
+
+    template <typename T>
+    T* MatrixView<T>::Data() const
+    {
+        return m_data.get();
+    }
+
+    template <typename T>
+    VectorView<T, RowVector<std::remove_const_t<T>>> MatrixView<T>::GetRow(const size_t row) const
+    {
+        if (row >= m_rowCount)
+            throw std::out_of_range("Row out of range");
+        return VectorView<T, RowVector<ValueType>>(std::shared_ptr<T[]>(m_data, m_data.get() + row * m_rowStride), m_columnCount, m_columnStride);
+    }
+
+    template <typename T>
+    VectorView<T, ColumnVector<std::remove_const_t<T>>> MatrixView<T>::GetColumn(const size_t column) const
+    {
+        if (column >= m_columnCount)
+            throw std::out_of_range("Column out of range");
+        return VectorView<T, ColumnVector<ValueType>>(std::shared_ptr<T[]>(m_data, m_data.get() + column * m_columnStride), m_rowCount, m_rowStride);
+    }
+
+    template <typename T>
+    MatrixView<T> MatrixView<T>::Block(const size_t row, const size_t column, const size_t rowCount, const size_t columnCount) const
+    {
+        if (row + rowCount > m_rowCount || column + columnCount > m_columnCount)
+            throw std::out_of_range("Block out of range");
+        return MatrixView(std::shared_ptr<T[]>(m_data, m_data.get() + row * m_rowStride + column * m_columnStride),
+                          rowCount, columnCount, m_rowStride, m_columnStride);
+    }
+
+    template <typename T>
+    MatrixView<T> MatrixView<T>::Transposed() const
+    {
+        return MatrixView(m_data, m_columnCount, m_rowCount, m_columnStride, m_rowStride);
+    }
+
+    template <typename T>
+    bool MatrixView<T>::ElementwiseEquals(const Matrix<ValueType>& mat) const
+    {
+        if (m_rowCount != mat.GetRowCount() || m_columnCount != mat.GetColumnCount())
+            return false;
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t j = 0; j < m_columnCount; j++)
+            {
+                if ((*this)(i, j) != mat(i, j))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool MatrixView<T>::ElementwiseCompare(const Matrix<ValueType>& mat, const float epsilon) const
+    {
+        if (m_rowCount != mat.GetRowCount() || m_columnCount != mat.GetColumnCount())
+            return false;
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t j = 0; j < m_columnCount; j++)
+            {
+                if (!(std::abs((*this)(i, j) - mat(i, j)) < epsilon))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    void MatrixView<T>::ThrowIfDimensionsMismatch(const size_t rowCount, const size_t columnCount) const
+    {
+        if (m_rowCount != rowCount || m_columnCount != columnCount)
+            throw std::invalid_argument("Dimensions mismatch");
+    }
+}
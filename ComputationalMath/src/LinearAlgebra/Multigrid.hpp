@@ -0,0 +1,466 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "FactorizationLU.hpp"
+#include "IterativeSettings.hpp"
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    enum class MultigridSmoother
+    {
+        /// <summary>
+        /// Damped Jacobi, x += JacobiWeight * D^-1 (b - Ax), one SpMV per step.
+        /// </summary>
+        Jacobi,
+
+        /// <summary>
+        /// Gauss-Seidel, forward sweeps before and backward sweeps after the coarse grid correction, which keeps the
+        /// V-cycle symmetric for symmetric A.
+        /// </summary>
+        GaussSeidel,
+
+        /// <summary>
+        /// Chebyshev polynomial of degree ChebyshevDegree in D^-1 A, which damps the eigenvalues in
+        /// [0.1, 1.1] * rho(D^-1 A). Costs ChebyshevDegree SpMVs per step, but unlike Gauss-Seidel only needs SpMVs
+        /// and vector updates, which are parallel.
+        /// </summary>
+        Chebyshev,
+    };
+
+    struct MultigridCycleSettings
+    {
+        MultigridSmoother Smoother = MultigridSmoother::GaussSeidel;
+        double JacobiWeight = 2.0 / 3.0;
+        size_t ChebyshevDegree = 3;
+        size_t PreSmoothingSteps = 1;
+        size_t PostSmoothingSteps = 1;
+    };
+
+    /// <summary>
+    /// Size of the hierarchy, and the wall time of its setup and of all V-cycles since, which tells how many cycles
+    /// (time steps, solves) it takes to amortize the setup.
+    /// </summary>
+    struct MultigridStatistics
+    {
+        std::vector<size_t> LevelSizes;
+        std::vector<size_t> LevelNonZeroCounts;
+        double SetupSeconds = 0;
+        double CycleSeconds = 0;
+        size_t CycleCount = 0;
+
+        /// <summary>
+        /// Nonzeros of all level operators relative to those of A, thus the memory and cost of a V-cycle relative to
+        /// a smoothing step on A.
+        /// </summary>
+        double OperatorComplexity() const
+        {
+            size_t total = 0;
+            for (const size_t count : LevelNonZeroCounts)
+                total += count;
+            return LevelNonZeroCounts.empty() ? 0.0 : static_cast<double>(total) / static_cast<double>(LevelNonZeroCounts[0]);
+        }
+    };
+
+    namespace Multigrid
+    {
+        template <typename T>
+        std::vector<T> InverseDiagonal(const SparseMatrix<T>& matrix)
+        {
+            std::vector<T> inverse(matrix.GetRowCount());
+            for (size_t i = 0; i < inverse.size(); i++)
+            {
+                const T diagonal = matrix(i, i);
+                if (diagonal == T(0))
+                    throw std::invalid_argument("Degenerate matrix");
+                inverse[i] = T(1) / diagonal;
+            }
+            return inverse;
+        }
+
+        /// <summary>
+        /// Estimate of the spectral radius of D^-1 A by power iteration.
+        /// </summary>
+        template <typename T>
+        double EstimateSpectralRadius(const SparseMatrix<T>& matrix, const std::vector<T>& inverseDiagonal, const size_t iterations = 15)
+        {
+            const size_t n = matrix.GetRowCount();
+            ColumnVector<T> x(n), y(n);
+            // Deterministic pseudo-random start, such that all modes, in particular the oscillatory ones, are present
+            uint64_t state = 0x9E3779B97F4A7C15ull;
+            for (size_t i = 0; i < n; i++)
+            {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                x[i] = static_cast<T>(static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5);
+            }
+
+            double radius = 0;
+            for (size_t iteration = 0; iteration < iterations; iteration++)
+            {
+                const double norm = static_cast<double>(x.Norm2());
+                if (norm == 0.0)
+                    break;
+                x.Scale(static_cast<T>(1.0 / norm));
+                Spmv(T(1), matrix, x, T(0), y);
+                for (size_t i = 0; i < n; i++)
+                    y[i] *= inverseDiagonal[i];
+                radius = static_cast<double>(y.Norm2());
+                std::swap(x, y);
+            }
+            return radius;
+        }
+    }
+
+    /// <summary>
+    /// Multigrid V-cycle over a hierarchy of levels, each with an operator, and the prolongation P from the next,
+    /// coarser, level and restriction R = P^T to it. The coarsest level is solved by a dense PLU. AlgebraicMultigrid
+    /// and GeometricMultigrid build the levels. The hierarchy owns a copy of A, and is copyable.
+    ///
+    /// Apply performs one V-cycle from a zero initial guess, thus it is a Preconditioner. With Gauss-Seidel or
+    /// Chebyshev smoothing and Galerkin coarse operators it is symmetric positive definite for symmetric positive
+    /// definite A, as conjugate gradients require. Solve iterates V-cycles standalone. Both use the work vectors of
+    /// the hierarchy, and are therefore not reentrant.
+    /// </summary>
+    template <typename T>
+    class MultigridHierarchy
+    {
+    public:
+        size_t GetLevelCount() const { return m_levels.size(); }
+        const MultigridCycleSettings& GetCycleSettings() const { return m_settings; }
+        const MultigridStatistics& GetStatistics() const { return m_statistics; }
+
+        /// <summary>
+        /// Operator of a level, level 0 is A.
+        /// </summary>
+        const SparseMatrix<T>& GetOperator(size_t level) const;
+
+        /// <summary>
+        /// Prolongation from level + 1 to level, for all but the coarsest level.
+        /// </summary>
+        const SparseMatrix<T>& GetProlongation(size_t level) const;
+
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const;
+
+        /// <summary>
+        /// Solves A x = b by V-cycles, starting from the initial guess in x.
+        /// </summary>
+        IterativeReport Solve(const ColumnVector<T>& b, ColumnVector<T>& x, const IterativeSettings& settings = {}) const;
+
+    protected:
+        struct Level
+        {
+            SparseMatrix<T> Operator;
+            SparseMatrix<T> Prolongation;
+            SparseMatrix<T> Restriction;
+            std::vector<T> InverseDiagonal;
+            double SpectralRadius = 0;
+            mutable ColumnVector<T> Rhs;
+            mutable ColumnVector<T> Solution;
+            mutable ColumnVector<T> Residual;
+            mutable ColumnVector<T> Correction;
+        };
+
+        /// <summary>
+        /// Single level hierarchy of A, to which the derived classes add the coarse levels before they Finalize. The
+        /// setup time is measured from here, thus it includes the fine level.
+        /// </summary>
+        MultigridHierarchy(SparseMatrix<T> matrix, MultigridCycleSettings settings);
+
+        const Level& GetCoarsestLevel() const { return m_levels.back(); }
+
+        /// <summary>
+        /// Adds the level with the Galerkin operator P^T A P of the current coarsest level A.
+        /// </summary>
+        void AddGalerkinLevel(SparseMatrix<T> prolongation);
+
+        /// <summary>
+        /// Adds a level with its own operator, e.g. one assembled on a coarser mesh.
+        /// </summary>
+        void AddLevel(SparseMatrix<T> prolongation, SparseMatrix<T> coarseOperator);
+
+        /// <summary>
+        /// Allocates the work vectors and factorizes the coarsest operator, which completes the setup.
+        /// </summary>
+        void Finalize();
+
+    private:
+        void Cycle(size_t level, const ColumnVector<T>& b, ColumnVector<T>& x) const;
+        void Smooth(size_t level, const ColumnVector<T>& b, ColumnVector<T>& x, size_t steps, bool forward) const;
+        void ChebyshevSmooth(const Level& level, const ColumnVector<T>& b, ColumnVector<T>& x) const;
+
+    private:
+        std::chrono::steady_clock::time_point m_setupStart;
+        MultigridCycleSettings m_settings;
+        std::vector<Level> m_levels;
+        std::optional<Factorization::LUFactorization<T>> m_coarseSolver;
+        mutable MultigridStatistics m_statistics;
+    };
+
+    template <typename T>
+    MultigridHierarchy<T>::MultigridHierarchy(SparseMatrix<T> matrix, const MultigridCycleSettings settings)
+        : m_setupStart(std::chrono::steady_clock::now()), m_settings(settings)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        Level level;
+        level.InverseDiagonal = Multigrid::InverseDiagonal(matrix);
+        level.SpectralRadius = Multigrid::EstimateSpectralRadius(matrix, level.InverseDiagonal);
+        level.Operator = std::move(matrix);
+        m_levels.push_back(std::move(level));
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::AddGalerkinLevel(SparseMatrix<T> prolongation)
+    {
+        const SparseMatrix<T>& fine = m_levels.back().Operator;
+        if (prolongation.GetRowCount() != fine.GetRowCount())
+            throw std::invalid_argument("Prolongation dimensions mismatch");
+
+        const SparseMatrix<T> restriction = prolongation.Transposed();
+        SparseMatrix<T> coarse = restriction * (fine * prolongation);
+        AddLevel(std::move(prolongation), std::move(coarse));
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::AddLevel(SparseMatrix<T> prolongation, SparseMatrix<T> coarseOperator)
+    {
+        if (prolongation.GetRowCount() != m_levels.back().Operator.GetRowCount() || prolongation.GetColumnCount() != coarseOperator.GetRowCount())
+            throw std::invalid_argument("Prolongation dimensions mismatch");
+        if (coarseOperator.GetRowCount() != coarseOperator.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        Level coarse;
+        coarse.InverseDiagonal = Multigrid::InverseDiagonal(coarseOperator);
+        coarse.SpectralRadius = Multigrid::EstimateSpectralRadius(coarseOperator, coarse.InverseDiagonal);
+        coarse.Operator = std::move(coarseOperator);
+
+        Level& fine = m_levels.back();
+        fine.Restriction = prolongation.Transposed();
+        fine.Prolongation = std::move(prolongation);
+        m_levels.push_back(std::move(coarse));
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::Finalize()
+    {
+        // Work vectors, the right-hand side and solution of level 0 are those passed to the cycle
+        m_statistics.LevelSizes.clear();
+        m_statistics.LevelNonZeroCounts.clear();
+        for (size_t index = 0; index < m_levels.size(); index++)
+        {
+            Level& level = m_levels[index];
+            const size_t n = level.Operator.GetRowCount();
+            level.Residual = ColumnVector<T>(n);
+            if (m_settings.Smoother == MultigridSmoother::Chebyshev)
+                level.Correction = ColumnVector<T>(n);
+            if (index > 0)
+            {
+                level.Rhs = ColumnVector<T>(n);
+                level.Solution = ColumnVector<T>(n);
+            }
+            m_statistics.LevelSizes.push_back(n);
+            m_statistics.LevelNonZeroCounts.push_back(level.Operator.GetNonZeroCount());
+        }
+
+        // Pivots below the rounding error of the coarse operator are degenerate
+        const Level& coarsest = m_levels.back();
+        T maxDiagonal = T(0);
+        for (const T inverse : coarsest.InverseDiagonal)
+            maxDiagonal = std::max(maxDiagonal, std::abs(T(1) / inverse));
+        const T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(coarsest.Operator.GetRowCount()) * maxDiagonal;
+        m_coarseSolver.emplace(coarsest.Operator.ToMatrix(), tolerance);
+
+        m_statistics.SetupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_setupStart).count();
+    }
+
+    template <typename T>
+    const SparseMatrix<T>& MultigridHierarchy<T>::GetOperator(const size_t level) const
+    {
+        if (level >= m_levels.size())
+            throw std::out_of_range("Level out of range");
+        return m_levels[level].Operator;
+    }
+
+    template <typename T>
+    const SparseMatrix<T>& MultigridHierarchy<T>::GetProlongation(const size_t level) const
+    {
+        if (level + 1 >= m_levels.size())
+            throw std::out_of_range("Level out of range");
+        return m_levels[level].Prolongation;
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::ChebyshevSmooth(const Level& level, const ColumnVector<T>& b, ColumnVector<T>& x) const
+    {
+        // Chebyshev iteration for the eigenvalues of D^-1 A in [lower, upper], see Saad, Iterative Methods for Sparse
+        // Linear Systems, algorithm 12.1
+        const size_t n = level.Operator.GetRowCount();
+        const double upper = 1.1 * level.SpectralRadius;
+        const double lower = 0.1 * level.SpectralRadius;
+        const double theta = (upper + lower) / 2;
+        const double delta = (upper - lower) / 2;
+        const double sigma = theta / delta;
+        double rho = 1 / sigma;
+
+        ColumnVector<T>& residual = level.Residual;
+        ColumnVector<T>& correction = level.Correction;
+        residual = b;
+        Spmv(T(-1), level.Operator, x, T(1), residual);
+        for (size_t i = 0; i < n; i++)
+            correction[i] = static_cast<T>(1 / theta) * level.InverseDiagonal[i] * residual[i];
+
+        for (size_t degree = 1;; degree++)
+        {
+            x.Axpy(T(1), correction);
+            if (degree >= m_settings.ChebyshevDegree)
+                break;
+
+            residual = b;
+            Spmv(T(-1), level.Operator, x, T(1), residual);
+            const double rhoNext = 1 / (2 * sigma - rho);
+            const T previousWeight = static_cast<T>(rhoNext * rho);
+            const T residualWeight = static_cast<T>(2 * rhoNext / delta);
+            for (size_t i = 0; i < n; i++)
+                correction[i] = previousWeight * correction[i] + residualWeight * level.InverseDiagonal[i] * residual[i];
+            rho = rhoNext;
+        }
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::Smooth(const size_t levelIndex, const ColumnVector<T>& b, ColumnVector<T>& x, const size_t steps,
+                                       const bool forward) const
+    {
+        const Level& level = m_levels[levelIndex];
+        const SparseMatrix<T>& A = level.Operator;
+        const std::vector<T>& inverseDiagonal = level.InverseDiagonal;
+        const size_t n = A.GetRowCount();
+
+        if (m_settings.Smoother == MultigridSmoother::Chebyshev)
+        {
+            for (size_t step = 0; step < steps; step++)
+                ChebyshevSmooth(level, b, x);
+            return;
+        }
+
+        if (m_settings.Smoother == MultigridSmoother::Jacobi)
+        {
+            ColumnVector<T>& residual = level.Residual;
+            const T weight = static_cast<T>(m_settings.JacobiWeight);
+            for (size_t step = 0; step < steps; step++)
+            {
+                residual = b;
+                Spmv(T(-1), A, x, T(1), residual);
+                for (size_t i = 0; i < n; i++)
+                    x[i] += weight * inverseDiagonal[i] * residual[i];
+            }
+            return;
+        }
+
+        const SparseIndex* rowOffsets = A.RowOffsets();
+        const SparseIndex* columnIndices = A.ColumnIndices();
+        const T* values = A.Values();
+        T* solution = x.Data();
+        const T* rhs = b.Data();
+        for (size_t step = 0; step < steps; step++)
+        {
+            for (size_t row = 0; row < n; row++)
+            {
+                // The diagonal term is included in the sum, and added back
+                const size_t i = forward ? row : n - 1 - row;
+                T sum = rhs[i];
+                for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++)
+                    sum -= values[k] * solution[columnIndices[k]];
+                solution[i] += sum * inverseDiagonal[i];
+            }
+        }
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::Cycle(const size_t level, const ColumnVector<T>& b, ColumnVector<T>& x) const
+    {
+        if (level + 1 == m_levels.size())
+        {
+            x = b;
+            m_coarseSolver->SolveInPlace(x);
+            return;
+        }
+
+        const Level& fine = m_levels[level];
+        const Level& coarse = m_levels[level + 1];
+        Smooth(level, b, x, m_settings.PreSmoothingSteps, true);
+
+        // Restrict the residual, solve the coarse error equation from zero, and prolongate the correction
+        fine.Residual = b;
+        Spmv(T(-1), fine.Operator, x, T(1), fine.Residual);
+        Spmv(T(1), fine.Restriction, fine.Residual, T(0), coarse.Rhs);
+        coarse.Solution.Fill(T(0));
+        Cycle(level + 1, coarse.Rhs, coarse.Solution);
+        Spmv(T(1), fine.Prolongation, coarse.Solution, T(1), x);
+
+        Smooth(level, b, x, m_settings.PostSmoothingSteps, false);
+    }
+
+    template <typename T>
+    void MultigridHierarchy<T>::Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+    {
+        const size_t n = m_levels[0].Operator.GetRowCount();
+        if (r.GetLength() != n || z.GetLength() != n)
+            throw std::invalid_argument("Dimensions mismatch");
+
+        const auto start = std::chrono::steady_clock::now();
+        z.Fill(T(0));
+        Cycle(0, r, z);
+        m_statistics.CycleSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        m_statistics.CycleCount++;
+    }
+
+    template <typename T>
+    IterativeReport MultigridHierarchy<T>::Solve(const ColumnVector<T>& b, ColumnVector<T>& x, const IterativeSettings& settings) const
+    {
+        const SparseMatrix<T>& A = m_levels[0].Operator;
+        if (b.GetLength() != A.GetRowCount() || x.GetLength() != A.GetRowCount())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        IterativeReport report;
+        report.ResidualNorms.reserve(settings.MaxIterations + 1);
+        const double rhsNorm = static_cast<double>(b.Norm2());
+        if (rhsNorm == 0.0)
+        {
+            x.Fill(T(0));
+            report.ResidualNorms.push_back(0.0);
+            report.Converged = true;
+            return report;
+        }
+
+        ColumnVector<T>& residual = m_levels[0].Residual;
+        residual = b;
+        Spmv(T(-1), A, x, T(1), residual);
+        report.ResidualNorms.push_back(static_cast<double>(residual.Norm2()) / rhsNorm);
+        report.Converged = report.ResidualNorms.back() <= settings.Tolerance;
+
+        while (!report.Converged && report.Iterations < settings.MaxIterations)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            Cycle(0, b, x);
+            m_statistics.CycleSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            m_statistics.CycleCount++;
+            report.Iterations++;
+
+            residual = b;
+            Spmv(T(-1), A, x, T(1), residual);
+            report.ResidualNorms.push_back(static_cast<double>(residual.Norm2()) / rhsNorm);
+            report.Converged = report.ResidualNorms.back() <= settings.Tolerance;
+        }
+        return report;
+    }
+}
@@ -0,0 +1,370 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "SparseMatrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    /// <summary>
+    /// Approximation M of a matrix A, which the Krylov solvers apply as z = M^-1 r once per iteration. Apply may not
+    /// allocate, and z does not alias r.
+    /// </summary>
+    template <typename P, typename T>
+    concept Preconditioner = requires(const P& preconditioner, const ColumnVector<T>& r, ColumnVector<T>& z) {
+        preconditioner.Apply(r, z);
+    };
+
+    /// <summary>
+    /// M = I, the unpreconditioned iteration.
+    /// </summary>
+    template <typename T>
+    class IdentityPreconditioner
+    {
+    public:
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+        {
+            std::copy(r.Data(), r.Data() + r.GetLength(), z.Data());
+        }
+    };
+
+    /// <summary>
+    /// M = diag(A). Cheap and trivially parallel, but only removes the scaling of the rows.
+    /// </summary>
+    template <typename T>
+    class JacobiPreconditioner
+    {
+    public:
+        explicit JacobiPreconditioner(const SparseMatrix<T>& matrix);
+
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const;
+
+    private:
+        std::vector<T> m_inverseDiagonal;
+    };
+
+    /// <summary>
+    /// Symmetric successive over-relaxation, M = (D + omega L) D^-1 (D + omega U) / (omega (2 - omega)) for
+    /// A = L + D + U, with 0 < omega < 2. Needs no setup besides the diagonal, applies a forward and a backward sweep
+    /// over A, and keeps M symmetric positive definite for symmetric positive definite A. A should outlive it.
+    /// </summary>
+    template <typename T>
+    class SsorPreconditioner
+    {
+    public:
+        explicit SsorPreconditioner(const SparseMatrix<T>& matrix, T omega = T(1));
+
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const;
+
+    private:
+        const SparseMatrix<T>& m_matrix;
+        T m_omega;
+        std::vector<T> m_diagonal;
+        std::vector<SparseIndex> m_diagonalSlots;
+    };
+
+    /// <summary>
+    /// Incomplete Cholesky factorization IC(0), M = L L^T where L has the sparsity pattern of the lower triangle of A,
+    /// and the fill-in outside of it is dropped. Throws when a pivot is not positive, which happens for matrices that
+    /// are not symmetric positive definite, or that are far from diagonally dominant.
+    /// </summary>
+    template <typename T>
+    class IncompleteCholeskyPreconditioner
+    {
+    public:
+        explicit IncompleteCholeskyPreconditioner(const SparseMatrix<T>& matrix);
+
+        /// <summary>
+        /// L in CSR format, the diagonal is the last element of every row.
+        /// </summary>
+        const SparseMatrix<T>& GetFactor() const { return m_factor; }
+
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const;
+
+    private:
+        SparseMatrix<T> m_factor;
+    };
+
+    /// <summary>
+    /// Incomplete LU factorization ILU(0), M = L U where L (unit lower) and U have the sparsity pattern of A, and the
+    /// fill-in outside of it is dropped. Also suits non-symmetric and indefinite A, but throws when a pivot vanishes,
+    /// thus every row should store its diagonal.
+    /// </summary>
+    template <typename T>
+    class IncompleteLUPreconditioner
+    {
+    public:
+        explicit IncompleteLUPreconditioner(const SparseMatrix<T>& matrix);
+
+        /// <summary>
+        /// L and U in the pattern of A, the unit diagonal of L is not stored.
+        /// </summary>
+        const SparseMatrix<T>& GetFactor() const { return m_factor; }
+
+        void Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const;
+
+    private:
+        SparseMatrix<T> m_factor;
+        std::vector<SparseIndex> m_diagonalSlots;
+    };
+
+    template <typename T>
+    void AssertPreconditionerDimensions(const size_t size, const ColumnVector<T>& r, const ColumnVector<T>& z)
+    {
+        if (r.GetLength() != size || z.GetLength() != size)
+            throw std::invalid_argument("Dimensions mismatch");
+    }
+
+    template <typename T>
+    JacobiPreconditioner<T>::JacobiPreconditioner(const SparseMatrix<T>& matrix)
+        : m_inverseDiagonal(matrix.GetRowCount())
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        for (size_t i = 0; i < m_inverseDiagonal.size(); i++)
+        {
+            const T diagonal = matrix(i, i);
+            if (diagonal == T(0))
+                throw std::invalid_argument("Degenerate matrix");
+            m_inverseDiagonal[i] = T(1) / diagonal;
+        }
+    }
+
+    template <typename T>
+    void JacobiPreconditioner<T>::Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+    {
+        AssertPreconditionerDimensions(m_inverseDiagonal.size(), r, z);
+        const T* source = r.Data();
+        T* destination = z.Data();
+        for (size_t i = 0; i < m_inverseDiagonal.size(); i++)
+            destination[i] = m_inverseDiagonal[i] * source[i];
+    }
+
+    template <typename T>
+    SsorPreconditioner<T>::SsorPreconditioner(const SparseMatrix<T>& matrix, const T omega)
+        : m_matrix(matrix), m_omega(omega), m_diagonal(matrix.GetRowCount()), m_diagonalSlots(matrix.GetRowCount())
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (!(omega > T(0) && omega < T(2)))
+            throw std::invalid_argument("Relaxation factor should be in (0, 2)");
+
+        for (size_t i = 0; i < m_diagonal.size(); i++)
+        {
+            const size_t slot = matrix.FindIndex(i, i);
+            if (slot == matrix.GetNonZeroCount() || matrix.Values()[slot] == T(0))
+                throw std::invalid_argument("Degenerate matrix");
+            m_diagonalSlots[i] = static_cast<SparseIndex>(slot);
+            m_diagonal[i] = matrix.Values()[slot];
+        }
+    }
+
+    template <typename T>
+    void SsorPreconditioner<T>::Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+    {
+        const size_t n = m_diagonal.size();
+        AssertPreconditionerDimensions(n, r, z);
+        const SparseIndex* rowOffsets = m_matrix.RowOffsets();
+        const SparseIndex* columnIndices = m_matrix.ColumnIndices();
+        const T* values = m_matrix.Values();
+        const T* source = r.Data();
+        T* y = z.Data();
+
+        // Forward sweep (D / omega + L) y = r, the columns of a row are sorted, thus L precedes the diagonal slot
+        for (size_t i = 0; i < n; i++)
+        {
+            T sum = source[i];
+            for (size_t k = rowOffsets[i]; k < m_diagonalSlots[i]; k++)
+                sum -= values[k] * y[columnIndices[k]];
+            y[i] = m_omega * sum / m_diagonal[i];
+        }
+
+        // Backward sweep (D / omega + U) z = (2 - omega) / omega D y, in place
+        const T scale = (T(2) - m_omega) / m_omega;
+        for (size_t i = n; i-- > 0;)
+        {
+            T sum = scale * m_diagonal[i] * y[i];
+            for (size_t k = m_diagonalSlots[i] + 1; k < rowOffsets[i + 1]; k++)
+                sum -= values[k] * y[columnIndices[k]];
+            y[i] = m_omega * sum / m_diagonal[i];
+        }
+    }
+
+    template <typename T>
+    IncompleteCholeskyPreconditioner<T>::IncompleteCholeskyPreconditioner(const SparseMatrix<T>& matrix)
+    {
+        const size_t n = matrix.GetRowCount();
+        if (n != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        // Lower triangle of A, including the diagonal
+        std::vector<SparseIndex> rowOffsets(n + 1, 0);
+        std::vector<SparseIndex> columnIndices;
+        std::vector<T> values;
+        columnIndices.reserve(matrix.GetNonZeroCount() / 2 + n);
+        values.reserve(matrix.GetNonZeroCount() / 2 + n);
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t k = matrix.RowOffsets()[i]; k < matrix.RowOffsets()[i + 1] && matrix.ColumnIndices()[k] <= i; k++)
+            {
+                columnIndices.push_back(matrix.ColumnIndices()[k]);
+                values.push_back(matrix.Values()[k]);
+            }
+            if (columnIndices.empty() || columnIndices.back() != i)
+                throw std::invalid_argument("Matrix is not positive definite");
+            rowOffsets[i + 1] = static_cast<SparseIndex>(columnIndices.size());
+        }
+
+        // Row-wise (left-looking) factorization, L(i, j) = (A(i, j) - L(i, :j) . L(j, :j)) / L(j, j) on the pattern
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t rowBegin = rowOffsets[i];
+            const size_t diagonal = rowOffsets[i + 1] - 1;
+            for (size_t k = rowBegin; k < diagonal; k++)
+            {
+                const size_t j = columnIndices[k];
+
+                // Sparse dot product of the rows i and j left of column j, merged over their sorted columns
+                T sum = values[k];
+                size_t left = rowBegin;
+                size_t right = rowOffsets[j];
+                const size_t rightEnd = rowOffsets[j + 1] - 1;
+                while (left < k && right < rightEnd)
+                {
+                    if (columnIndices[left] == columnIndices[right])
+                        sum -= values[left++] * values[right++];
+                    else if (columnIndices[left] < columnIndices[right])
+                        left++;
+                    else
+                        right++;
+                }
+                values[k] = sum / values[rightEnd];
+            }
+
+            T pivot = values[diagonal];
+            for (size_t k = rowBegin; k < diagonal; k++)
+                pivot -= values[k] * values[k];
+            if (!(pivot > T(0)))
+                throw std::invalid_argument("Matrix is not positive definite");
+            values[diagonal] = std::sqrt(pivot);
+        }
+
+        m_factor = SparseMatrix<T>(n, n, std::move(rowOffsets), std::move(columnIndices), std::move(values));
+    }
+
+    template <typename T>
+    void IncompleteCholeskyPreconditioner<T>::Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+    {
+        const size_t n = m_factor.GetRowCount();
+        AssertPreconditionerDimensions(n, r, z);
+        const SparseIndex* rowOffsets = m_factor.RowOffsets();
+        const SparseIndex* columnIndices = m_factor.ColumnIndices();
+        const T* values = m_factor.Values();
+        const T* source = r.Data();
+        T* y = z.Data();
+
+        // L y = r, by rows
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t diagonal = rowOffsets[i + 1] - 1;
+            T sum = source[i];
+            for (size_t k = rowOffsets[i]; k < diagonal; k++)
+                sum -= values[k] * y[columnIndices[k]];
+            y[i] = sum / values[diagonal];
+        }
+
+        // L^T z = y, row i of L is column i of L^T, thus its solved entry is scattered into the rows above
+        for (size_t i = n; i-- > 0;)
+        {
+            const size_t diagonal = rowOffsets[i + 1] - 1;
+            y[i] /= values[diagonal];
+            const T solved = y[i];
+            for (size_t k = rowOffsets[i]; k < diagonal; k++)
+                y[columnIndices[k]] -= values[k] * solved;
+        }
+    }
+
+    template <typename T>
+    IncompleteLUPreconditioner<T>::IncompleteLUPreconditioner(const SparseMatrix<T>& matrix)
+        : m_factor(matrix), m_diagonalSlots(matrix.GetRowCount())
+    {
+        const size_t n = matrix.GetRowCount();
+        if (n != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        const SparseIndex* rowOffsets = m_factor.RowOffsets();
+        const SparseIndex* columnIndices = m_factor.ColumnIndices();
+        T* values = m_factor.Values();
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t slot = m_factor.FindIndex(i, i);
+            if (slot == m_factor.GetNonZeroCount())
+                throw std::invalid_argument("Degenerate matrix");
+            m_diagonalSlots[i] = static_cast<SparseIndex>(slot);
+        }
+
+        // IKJ variant, row i is eliminated by the rows j < i of U, the slots of row i are looked up by column
+        constexpr SparseIndex absent = std::numeric_limits<SparseIndex>::max();
+        std::vector<SparseIndex> slots(n, absent);
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t rowEnd = rowOffsets[i + 1];
+            for (size_t k = rowOffsets[i]; k < rowEnd; k++)
+                slots[columnIndices[k]] = static_cast<SparseIndex>(k);
+
+            for (size_t k = rowOffsets[i]; k < m_diagonalSlots[i]; k++)
+            {
+                const size_t j = columnIndices[k];
+                values[k] /= values[m_diagonalSlots[j]];
+                const T multiplier = values[k];
+                for (size_t kk = m_diagonalSlots[j] + 1; kk < rowOffsets[j + 1]; kk++)
+                {
+                    const SparseIndex target = slots[columnIndices[kk]];
+                    if (target != absent)
+                        values[target] -= multiplier * values[kk];
+                }
+            }
+
+            if (values[m_diagonalSlots[i]] == T(0))
+                throw std::invalid_argument("Degenerate matrix");
+            for (size_t k = rowOffsets[i]; k < rowEnd; k++)
+                slots[columnIndices[k]] = absent;
+        }
+    }
+
+    template <typename T>
+    void IncompleteLUPreconditioner<T>::Apply(const ColumnVector<T>& r, ColumnVector<T>& z) const
+    {
+        const size_t n = m_diagonalSlots.size();
+        AssertPreconditionerDimensions(n, r, z);
+        const SparseIndex* rowOffsets = m_factor.RowOffsets();
+        const SparseIndex* columnIndices = m_factor.ColumnIndices();
+        const T* values = m_factor.Values();
+        const T* source = r.Data();
+        T* y = z.Data();
+
+        // L y = r, with unit diagonal
+        for (size_t i = 0; i < n; i++)
+        {
+            T sum = source[i];
+            for (size_t k = rowOffsets[i]; k < m_diagonalSlots[i]; k++)
+                sum -= values[k] * y[columnIndices[k]];
+            y[i] = sum;
+        }
+
+        // U z = y, in place
+        for (size_t i = n; i-- > 0;)
+        {
+            T sum = y[i];
+            for (size_t k = m_diagonalSlots[i] + 1; k < rowOffsets[i + 1]; k++)
+                sum -= values[k] * y[columnIndices[k]];
+            y[i] = sum / values[m_diagonalSlots[i]];
+        }
+    }
+}
@@ -1,5 +1,18 @@
 #include "SimdOps.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SIMD_OPS_X86
 #include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
 
 namespace LinearAlgebra::SimdOps
 {
@@ -12,26 +25,27 @@ namespace LinearAlgebra::SimdOps
 
     void Sum(const int* left, const int* right, size_t length, int* result)
     {
+        size_t simdLoops = 0;
+#ifdef SIMD_OPS_X86
         __m128i* arr_1_ptr = (__m128i*)left;
         __m128i* arr_2_ptr = (__m128i*)right;
         __m128i* res_ptr = (__m128i*)result;
 
-        size_t simdLoops = length / 4;
-        size_t singleLoops = length - 4 * simdLoops;
+        simdLoops = length / 4;
 
         for (size_t simd = 0; simd < simdLoops; simd++)
         {
 
-            __m128i reg_1_SSE = _mm_load_si128(arr_1_ptr);
-            __m128i reg_2_SSE = _mm_load_si128(arr_2_ptr);
+            __m128i reg_1_SSE = _mm_loadu_si128(arr_1_ptr);
+            __m128i reg_2_SSE = _mm_loadu_si128(arr_2_ptr);
             __m128i sumRes = _mm_add_epi32(reg_1_SSE, reg_2_SSE);
-            //*(__m256i*) res_ptr = _mm256_add_epi32(reg_1_SSE, reg_2_SSE);
-            _mm_store_si128(res_ptr, sumRes);
+            _mm_storeu_si128(res_ptr, sumRes);
 
             arr_1_ptr++;
             arr_2_ptr++;
             res_ptr++;
         }
+#endif
 
         for (size_t a = 4 * simdLoops; a < length; a++)
         {
@@ -42,23 +56,25 @@ namespace LinearAlgebra::SimdOps
     int* Subtract(const int* left, const int* right, size_t length)
     {
         int* result = new int[length];
+        size_t simdLoops = 0;
+#ifdef SIMD_OPS_X86
         __m128i* arr_1_ptr = (__m128i*)left;
         __m128i* arr_2_ptr = (__m128i*)right;
         __m128i* res_ptr = (__m128i*)result;
 
-        size_t simdLoops = length / 4;
-        size_t singleLoops = length - 4 * simdLoops;
+        simdLoops = length / 4;
 
         for (size_t simd = 0; simd < simdLoops; simd++)
         {
-            __m128i reg_1_SSE = _mm_load_si128(arr_1_ptr);
-            __m128i reg_2_SSE = _mm_load_si128(arr_2_ptr);
-            *(__m128i*)res_ptr = _mm_sub_epi32(reg_1_SSE, reg_2_SSE);
+            __m128i reg_1_SSE = _mm_loadu_si128(arr_1_ptr);
+            __m128i reg_2_SSE = _mm_loadu_si128(arr_2_ptr);
+            _mm_storeu_si128(res_ptr, _mm_sub_epi32(reg_1_SSE, reg_2_SSE));
 
             arr_1_ptr++;
             arr_2_ptr++;
             res_ptr++;
         }
+#endif
 
         for (size_t a = 4 * simdLoops; a < length; a++)
         {
@@ -67,4 +83,507 @@ namespace LinearAlgebra::SimdOps
 
         return result;
     }
-}
\ No newline at end of file
+
+    namespace
+    {
+        template <typename T>
+        struct KernelTable
+        {
+            void (*Sum)(const T*, const T*, size_t, T*);
+            void (*Subtract)(const T*, const T*, size_t, T*);
+            void (*Min)(const T*, const T*, size_t, T*);
+            void (*Max)(const T*, const T*, size_t, T*);
+            void (*MultiplyAdd)(const T*, const T*, const T*, size_t, T*);
+            void (*Scale)(const T*, T, size_t, T*);
+            void (*Axpy)(T, const T*, size_t, T*);
+            void (*GatherMultiply)(const T*, const uint32_t*, const T*, size_t, T*);
+            T (*Dot)(const T*, const T*, size_t);
+            T (*ReduceSum)(const T*, size_t);
+            T (*ReduceMin)(const T*, size_t);
+            T (*ReduceMax)(const T*, size_t);
+        };
+
+        namespace Scalar
+        {
+            template <typename T>
+            struct ScalarRegister
+            {
+                using Scalar = T;
+                using Register = T;
+                static constexpr size_t Width = 1;
+
+                static T Load(const T* data) { return *data; }
+                static T Gather(const T* base, const uint32_t* indices) { return base[*indices]; }
+                static void Store(T* data, const T value) { *data = value; }
+                static T Broadcast(const T value) { return value; }
+                static T Zero() { return T(0); }
+                static T Add(const T left, const T right) { return left + right; }
+                static T Subtract(const T left, const T right) { return left - right; }
+                static T Multiply(const T left, const T right) { return left * right; }
+                static T MultiplyAdd(const T left, const T right, const T addend) { return left * right + addend; }
+                static T Min(const T left, const T right) { return left < right ? left : right; }
+                static T Max(const T left, const T right) { return left > right ? left : right; }
+                static T ReduceAdd(const T value) { return value; }
+                static T ReduceMin(const T value) { return value; }
+                static T ReduceMax(const T value) { return value; }
+            };
+
+#include "SimdOpsKernels.inl"
+
+            template <typename T>
+            KernelTable<T> CreateKernels()
+            {
+                return CreateKernelTable<ScalarRegister<T>>();
+            }
+        }
+
+#ifdef SIMD_OPS_X86
+        // SSE2 is part of x86-64, thus needs no target region
+        namespace Sse2
+        {
+            struct FloatRegister
+            {
+                using Scalar = float;
+                using Register = __m128;
+                static constexpr size_t Width = 4;
+
+                static __m128 Load(const float* data) { return _mm_loadu_ps(data); }
+                static __m128 Gather(const float* base, const uint32_t* indices) { return _mm_set_ps(base[indices[3]], base[indices[2]], base[indices[1]], base[indices[0]]); }
+                static void Store(float* data, const __m128 value) { _mm_storeu_ps(data, value); }
+                static __m128 Broadcast(const float value) { return _mm_set1_ps(value); }
+                static __m128 Zero() { return _mm_setzero_ps(); }
+                static __m128 Add(const __m128 left, const __m128 right) { return _mm_add_ps(left, right); }
+                static __m128 Subtract(const __m128 left, const __m128 right) { return _mm_sub_ps(left, right); }
+                static __m128 Multiply(const __m128 left, const __m128 right) { return _mm_mul_ps(left, right); }
+                static __m128 MultiplyAdd(const __m128 left, const __m128 right, const __m128 addend) { return _mm_add_ps(_mm_mul_ps(left, right), addend); }
+                static __m128 Min(const __m128 left, const __m128 right) { return _mm_min_ps(left, right); }
+                static __m128 Max(const __m128 left, const __m128 right) { return _mm_max_ps(left, right); }
+
+                static float ReduceAdd(const __m128 value)
+                {
+                    const __m128 pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+                    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+                }
+
+                static float ReduceMin(const __m128 value)
+                {
+                    const __m128 pairs = _mm_min_ps(value, _mm_movehl_ps(value, value));
+                    return _mm_cvtss_f32(_mm_min_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+                }
+
+                static float ReduceMax(const __m128 value)
+                {
+                    const __m128 pairs = _mm_max_ps(value, _mm_movehl_ps(value, value));
+                    return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+                }
+            };
+
+            struct DoubleRegister
+            {
+                using Scalar = double;
+                using Register = __m128d;
+                static constexpr size_t Width = 2;
+
+                static __m128d Load(const double* data) { return _mm_loadu_pd(data); }
+                static __m128d Gather(const double* base, const uint32_t* indices) { return _mm_set_pd(base[indices[1]], base[indices[0]]); }
+                static void Store(double* data, const __m128d value) { _mm_storeu_pd(data, value); }
+                static __m128d Broadcast(const double value) { return _mm_set1_pd(value); }
+                static __m128d Zero() { return _mm_setzero_pd(); }
+                static __m128d Add(const __m128d left, const __m128d right) { return _mm_add_pd(left, right); }
+                static __m128d Subtract(const __m128d left, const __m128d right) { return _mm_sub_pd(left, right); }
+                static __m128d Multiply(const __m128d left, const __m128d right) { return _mm_mul_pd(left, right); }
+                static __m128d MultiplyAdd(const __m128d left, const __m128d right, const __m128d addend) { return _mm_add_pd(_mm_mul_pd(left, right), addend); }
+                static __m128d Min(const __m128d left, const __m128d right) { return _mm_min_pd(left, right); }
+                static __m128d Max(const __m128d left, const __m128d right) { return _mm_max_pd(left, right); }
+                static double ReduceAdd(const __m128d value) { return _mm_cvtsd_f64(_mm_add_sd(value, _mm_unpackhi_pd(value, value))); }
+                static double ReduceMin(const __m128d value) { return _mm_cvtsd_f64(_mm_min_sd(value, _mm_unpackhi_pd(value, value))); }
+                static double ReduceMax(const __m128d value) { return _mm_cvtsd_f64(_mm_max_sd(value, _mm_unpackhi_pd(value, value))); }
+            };
+
+#include "SimdOpsKernels.inl"
+
+            template <typename T>
+            KernelTable<T> CreateKernels()
+            {
+                return CreateKernelTable<std::conditional_t<std::is_same_v<T, float>, FloatRegister, DoubleRegister>>();
+            }
+        }
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+        namespace Avx2
+        {
+            struct FloatRegister
+            {
+                using Scalar = float;
+                using Register = __m256;
+                static constexpr size_t Width = 8;
+
+                static __m256 Load(const float* data) { return _mm256_loadu_ps(data); }
+                static __m256 Gather(const float* base, const uint32_t* indices) { return _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), 4); }
+                static void Store(float* data, const __m256 value) { _mm256_storeu_ps(data, value); }
+                static __m256 Broadcast(const float value) { return _mm256_set1_ps(value); }
+                static __m256 Zero() { return _mm256_setzero_ps(); }
+                static __m256 Add(const __m256 left, const __m256 right) { return _mm256_add_ps(left, right); }
+                static __m256 Subtract(const __m256 left, const __m256 right) { return _mm256_sub_ps(left, right); }
+                static __m256 Multiply(const __m256 left, const __m256 right) { return _mm256_mul_ps(left, right); }
+                static __m256 MultiplyAdd(const __m256 left, const __m256 right, const __m256 addend) { return _mm256_fmadd_ps(left, right, addend); }
+                static __m256 Min(const __m256 left, const __m256 right) { return _mm256_min_ps(left, right); }
+                static __m256 Max(const __m256 left, const __m256 right) { return _mm256_max_ps(left, right); }
+
+                static float ReduceAdd(const __m256 value)
+                {
+                    return Sse2::FloatRegister::ReduceAdd(_mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+                }
+
+                static float ReduceMin(const __m256 value)
+                {
+                    return Sse2::FloatRegister::ReduceMin(_mm_min_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+                }
+
+                static float ReduceMax(const __m256 value)
+                {
+                    return Sse2::FloatRegister::ReduceMax(_mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+                }
+            };
+
+            struct DoubleRegister
+            {
+                using Scalar = double;
+                using Register = __m256d;
+                static constexpr size_t Width = 4;
+
+                static __m256d Load(const double* data) { return _mm256_loadu_pd(data); }
+                static __m256d Gather(const double* base, const uint32_t* indices) { return _mm256_i32gather_pd(base, _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices)), 8); }
+                static void Store(double* data, const __m256d value) { _mm256_storeu_pd(data, value); }
+                static __m256d Broadcast(const double value) { return _mm256_set1_pd(value); }
+                static __m256d Zero() { return _mm256_setzero_pd(); }
+                static __m256d Add(const __m256d left, const __m256d right) { return _mm256_add_pd(left, right); }
+                static __m256d Subtract(const __m256d left, const __m256d right) { return _mm256_sub_pd(left, right); }
+                static __m256d Multiply(const __m256d left, const __m256d right) { return _mm256_mul_pd(left, right); }
+                static __m256d MultiplyAdd(const __m256d left, const __m256d right, const __m256d addend) { return _mm256_fmadd_pd(left, right, addend); }
+                static __m256d Min(const __m256d left, const __m256d right) { return _mm256_min_pd(left, right); }
+                static __m256d Max(const __m256d left, const __m256d right) { return _mm256_max_pd(left, right); }
+
+                static double ReduceAdd(const __m256d value)
+                {
+                    return Sse2::DoubleRegister::ReduceAdd(_mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1)));
+                }
+
+                static double ReduceMin(const __m256d value)
+                {
+                    return Sse2::DoubleRegister::ReduceMin(_mm_min_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1)));
+                }
+
+                static double ReduceMax(const __m256d value)
+                {
+                    return Sse2::DoubleRegister::ReduceMax(_mm_max_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1)));
+                }
+            };
+
+#include "SimdOpsKernels.inl"
+
+            KernelTable<float> CreateFloatKernels()
+            {
+                return CreateKernelTable<FloatRegister>();
+            }
+
+            KernelTable<double> CreateDoubleKernels()
+            {
+                return CreateKernelTable<DoubleRegister>();
+            }
+        }
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+#endif
+        namespace Avx512
+        {
+            struct FloatRegister
+            {
+                using Scalar = float;
+                using Register = __m512;
+                static constexpr size_t Width = 16;
+
+                static __m512 Load(const float* data) { return _mm512_loadu_ps(data); }
+                static __m512 Gather(const float* base, const uint32_t* indices) { return _mm512_i32gather_ps(_mm512_loadu_si512(indices), base, 4); }
+                static void Store(float* data, const __m512 value) { _mm512_storeu_ps(data, value); }
+                static __m512 Broadcast(const float value) { return _mm512_set1_ps(value); }
+                static __m512 Zero() { return _mm512_setzero_ps(); }
+                static __m512 Add(const __m512 left, const __m512 right) { return _mm512_add_ps(left, right); }
+                static __m512 Subtract(const __m512 left, const __m512 right) { return _mm512_sub_ps(left, right); }
+                static __m512 Multiply(const __m512 left, const __m512 right) { return _mm512_mul_ps(left, right); }
+                static __m512 MultiplyAdd(const __m512 left, const __m512 right, const __m512 addend) { return _mm512_fmadd_ps(left, right, addend); }
+                static __m512 Min(const __m512 left, const __m512 right) { return _mm512_min_ps(left, right); }
+                static __m512 Max(const __m512 left, const __m512 right) { return _mm512_max_ps(left, right); }
+                static float ReduceAdd(const __m512 value) { return _mm512_reduce_add_ps(value); }
+                static float ReduceMin(const __m512 value) { return _mm512_reduce_min_ps(value); }
+                static float ReduceMax(const __m512 value) { return _mm512_reduce_max_ps(value); }
+            };
+
+            struct DoubleRegister
+            {
+                using Scalar = double;
+                using Register = __m512d;
+                static constexpr size_t Width = 8;
+
+                static __m512d Load(const double* data) { return _mm512_loadu_pd(data); }
+                static __m512d Gather(const double* base, const uint32_t* indices) { return _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), base, 8); }
+                static void Store(double* data, const __m512d value) { _mm512_storeu_pd(data, value); }
+                static __m512d Broadcast(const double value) { return _mm512_set1_pd(value); }
+                static __m512d Zero() { return _mm512_setzero_pd(); }
+                static __m512d Add(const __m512d left, const __m512d right) { return _mm512_add_pd(left, right); }
+                static __m512d Subtract(const __m512d left, const __m512d right) { return _mm512_sub_pd(left, right); }
+                static __m512d Multiply(const __m512d left, const __m512d right) { return _mm512_mul_pd(left, right); }
+                static __m512d MultiplyAdd(const __m512d left, const __m512d right, const __m512d addend) { return _mm512_fmadd_pd(left, right, addend); }
+                static __m512d Min(const __m512d left, const __m512d right) { return _mm512_min_pd(left, right); }
+                static __m512d Max(const __m512d left, const __m512d right) { return _mm512_max_pd(left, right); }
+                static double ReduceAdd(const __m512d value) { return _mm512_reduce_add_pd(value); }
+                static double ReduceMin(const __m512d value) { return _mm512_reduce_min_pd(value); }
+                static double ReduceMax(const __m512d value) { return _mm512_reduce_max_pd(value); }
+            };
+
+#include "SimdOpsKernels.inl"
+
+            KernelTable<float> CreateFloatKernels()
+            {
+                return CreateKernelTable<FloatRegister>();
+            }
+
+            KernelTable<double> CreateDoubleKernels()
+            {
+                return CreateKernelTable<DoubleRegister>();
+            }
+        }
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+#endif
+
+        InstructionSet DetectInstructionSet()
+        {
+#if defined(SIMD_OPS_X86) && defined(__GNUC__)
+            // Also checks that the operating system saves the ymm and zmm registers
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+                return InstructionSet::Avx512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                return InstructionSet::Avx2;
+            return InstructionSet::Sse2;
+#elif defined(SIMD_OPS_X86) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            const int maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            if (!osxsave || maxLeaf < 7)
+                return InstructionSet::Sse2;
+
+            const unsigned long long enabledStates = _xgetbv(0);
+            __cpuidex(info, 7, 0);
+            const bool avx2 = (info[1] & (1 << 5)) != 0;
+            const bool avx512f = (info[1] & (1 << 16)) != 0;
+
+            // xmm, ymm, opmask and both halves of the zmm registers
+            if (avx512f && (enabledStates & 0xe6) == 0xe6)
+                return InstructionSet::Avx512;
+            if (avx2 && fma && (enabledStates & 0x6) == 0x6)
+                return InstructionSet::Avx2;
+            return InstructionSet::Sse2;
+#else
+            return InstructionSet::Scalar;
+#endif
+        }
+
+        std::atomic<InstructionSet>& ActiveInstructionSet()
+        {
+            static std::atomic<InstructionSet> instructionSet(GetSupportedInstructionSet());
+            return instructionSet;
+        }
+
+        template <typename T>
+        std::array<KernelTable<T>, 4> CreateKernelTables()
+        {
+            const KernelTable<T> scalar = Scalar::CreateKernels<T>();
+#ifdef SIMD_OPS_X86
+            if constexpr (std::is_same_v<T, float>)
+                return {scalar, Sse2::CreateKernels<T>(), Avx2::CreateFloatKernels(), Avx512::CreateFloatKernels()};
+            else
+                return {scalar, Sse2::CreateKernels<T>(), Avx2::CreateDoubleKernels(), Avx512::CreateDoubleKernels()};
+#else
+            return {scalar, scalar, scalar, scalar};
+#endif
+        }
+
+        template <typename T>
+        const KernelTable<T>& Kernels()
+        {
+            static const std::array<KernelTable<T>, 4> tables = CreateKernelTables<T>();
+            return tables[static_cast<size_t>(ActiveInstructionSet().load(std::memory_order_relaxed))];
+        }
+
+        void ThrowIfEmpty(const size_t length)
+        {
+            if (length == 0)
+                throw std::invalid_argument("Reduction of an empty range");
+        }
+    }
+
+    InstructionSet GetSupportedInstructionSet()
+    {
+        static const InstructionSet supported = DetectInstructionSet();
+        return supported;
+    }
+
+    InstructionSet GetInstructionSet()
+    {
+        return ActiveInstructionSet().load(std::memory_order_relaxed);
+    }
+
+    void SetInstructionSet(const InstructionSet instructionSet)
+    {
+        if (instructionSet > GetSupportedInstructionSet())
+            throw std::invalid_argument("Instruction set not supported by this processor");
+        ActiveInstructionSet().store(instructionSet, std::memory_order_relaxed);
+    }
+
+    void Sum(const float* left, const float* right, const size_t length, float* result)
+    {
+        Kernels<float>().Sum(left, right, length, result);
+    }
+
+    void Sum(const double* left, const double* right, const size_t length, double* result)
+    {
+        Kernels<double>().Sum(left, right, length, result);
+    }
+
+    void Subtract(const float* left, const float* right, const size_t length, float* result)
+    {
+        Kernels<float>().Subtract(left, right, length, result);
+    }
+
+    void Subtract(const double* left, const double* right, const size_t length, double* result)
+    {
+        Kernels<double>().Subtract(left, right, length, result);
+    }
+
+    void Min(const float* left, const float* right, const size_t length, float* result)
+    {
+        Kernels<float>().Min(left, right, length, result);
+    }
+
+    void Min(const double* left, const double* right, const size_t length, double* result)
+    {
+        Kernels<double>().Min(left, right, length, result);
+    }
+
+    void Max(const float* left, const float* right, const size_t length, float* result)
+    {
+        Kernels<float>().Max(left, right, length, result);
+    }
+
+    void Max(const double* left, const double* right, const size_t length, double* result)
+    {
+        Kernels<double>().Max(left, right, length, result);
+    }
+
+    void MultiplyAdd(const float* left, const float* right, const float* addend, const size_t length, float* result)
+    {
+        Kernels<float>().MultiplyAdd(left, right, addend, length, result);
+    }
+
+    void MultiplyAdd(const double* left, const double* right, const double* addend, const size_t length, double* result)
+    {
+        Kernels<double>().MultiplyAdd(left, right, addend, length, result);
+    }
+
+    void Scale(const float* values, const float scalar, const size_t length, float* result)
+    {
+        Kernels<float>().Scale(values, scalar, length, result);
+    }
+
+    void Scale(const double* values, const double scalar, const size_t length, double* result)
+    {
+        Kernels<double>().Scale(values, scalar, length, result);
+    }
+
+    void Axpy(const float alpha, const float* x, const size_t length, float* y)
+    {
+        Kernels<float>().Axpy(alpha, x, length, y);
+    }
+
+    void Axpy(const double alpha, const double* x, const size_t length, double* y)
+    {
+        Kernels<double>().Axpy(alpha, x, length, y);
+    }
+
+    void GatherMultiply(const float* values, const uint32_t* indices, const float* x, const size_t length, float* result)
+    {
+        Kernels<float>().GatherMultiply(values, indices, x, length, result);
+    }
+
+    void GatherMultiply(const double* values, const uint32_t* indices, const double* x, const size_t length, double* result)
+    {
+        Kernels<double>().GatherMultiply(values, indices, x, length, result);
+    }
+
+    float Dot(const float* left, const float* right, const size_t length)
+    {
+        return Kernels<float>().Dot(left, right, length);
+    }
+
+    double Dot(const double* left, const double* right, const size_t length)
+    {
+        return Kernels<double>().Dot(left, right, length);
+    }
+
+    float ReduceSum(const float* values, const size_t length)
+    {
+        return Kernels<float>().ReduceSum(values, length);
+    }
+
+    double ReduceSum(const double* values, const size_t length)
+    {
+        return Kernels<double>().ReduceSum(values, length);
+    }
+
+    float ReduceMin(const float* values, const size_t length)
+    {
+        ThrowIfEmpty(length);
+        return Kernels<float>().ReduceMin(values, length);
+    }
+
+    double ReduceMin(const double* values, const size_t length)
+    {
+        ThrowIfEmpty(length);
+        return Kernels<double>().ReduceMin(values, length);
+    }
+
+    float ReduceMax(const float* values, const size_t length)
+    {
+        ThrowIfEmpty(length);
+        return Kernels<float>().ReduceMax(values, length);
+    }
+
+    double ReduceMax(const double* values, const size_t length)
+    {
+        ThrowIfEmpty(length);
+        return Kernels<double>().ReduceMax(values, length);
+    }
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include <concepts>
+#include <cstdint>
 #include <stdlib.h>
 
 namespace LinearAlgebra::SimdOps
@@ -7,4 +9,85 @@ namespace LinearAlgebra::SimdOps
     void Sum(const int* left, const int* right, size_t length, int* result);
 
     int* Subtract(const int* left, const int* right, size_t length);
+
+    /// <summary>
+    /// Instruction sets the float and double kernels are compiled for, ordered by register width.
+    /// </summary>
+    enum class InstructionSet
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+        Avx512
+    };
+
+    /// <summary>
+    /// Widest instruction set supported by both the processor and the operating system, detected once via CPUID.
+    /// </summary>
+    InstructionSet GetSupportedInstructionSet();
+
+    /// <summary>
+    /// Instruction set the float and double kernels currently dispatch to, GetSupportedInstructionSet() by default.
+    /// </summary>
+    InstructionSet GetInstructionSet();
+
+    /// <summary>
+    /// Restricts the kernels to instructionSet, e.g. to compare variants. Throws if the processor does not support it.
+    /// </summary>
+    void SetInstructionSet(InstructionSet instructionSet);
+
+    /// <summary>
+    /// Element types with runtime dispatched kernels below.
+    /// </summary>
+    template <typename T>
+    constexpr bool IsAccelerated = std::same_as<T, float> || std::same_as<T, double>;
+
+    // The kernels below dispatch at runtime to the widest variant of GetInstructionSet(). Pointers need not be aligned
+    // and lengths need not be a multiple of the register width. Elementwise kernels may write result in place of an
+    // input, but inputs and result may not partially overlap. Reductions reassociate, thus the rounding of Dot and
+    // ReduceSum depends on the instruction set.
+
+    // result = left + right
+    void Sum(const float* left, const float* right, size_t length, float* result);
+    void Sum(const double* left, const double* right, size_t length, double* result);
+
+    // result = left - right
+    void Subtract(const float* left, const float* right, size_t length, float* result);
+    void Subtract(const double* left, const double* right, size_t length, double* result);
+
+    // result = min(left, right), elementwise
+    void Min(const float* left, const float* right, size_t length, float* result);
+    void Min(const double* left, const double* right, size_t length, double* result);
+
+    // result = max(left, right), elementwise
+    void Max(const float* left, const float* right, size_t length, float* result);
+    void Max(const double* left, const double* right, size_t length, double* result);
+
+    // result = left * right + addend, fused where the instruction set has FMA
+    void MultiplyAdd(const float* left, const float* right, const float* addend, size_t length, float* result);
+    void MultiplyAdd(const double* left, const double* right, const double* addend, size_t length, double* result);
+
+    // result = scalar * values
+    void Scale(const float* values, float scalar, size_t length, float* result);
+    void Scale(const double* values, double scalar, size_t length, double* result);
+
+    // y = alpha * x + y
+    void Axpy(float alpha, const float* x, size_t length, float* y);
+    void Axpy(double alpha, const double* x, size_t length, double* y);
+
+    // result = values * x[indices], elementwise, gathers x at indices below 2^31, as the indices of a sparse row
+    void GatherMultiply(const float* values, const uint32_t* indices, const float* x, size_t length, float* result);
+    void GatherMultiply(const double* values, const uint32_t* indices, const double* x, size_t length, double* result);
+
+    float Dot(const float* left, const float* right, size_t length);
+    double Dot(const double* left, const double* right, size_t length);
+
+    float ReduceSum(const float* values, size_t length);
+    double ReduceSum(const double* values, size_t length);
+
+    // Smallest and largest element, throws if length is zero
+    float ReduceMin(const float* values, size_t length);
+    double ReduceMin(const double* values, size_t length);
+    float ReduceMax(const float* values, size_t length);
+    double ReduceMax(const double* values, size_t length);
 }
@@ -0,0 +1,232 @@
+// Kernels of SimdOps, generic over a register type V. This file is included once per instruction set by SimdOps.cpp,
+// inside a namespace and a region compiled for that instruction set, such that the intrinsics of V inline into the
+// loops. V provides Scalar, Register, Width, Load, Store (both unaligned), Gather of Width elements at 32-bit indices,
+// Broadcast, Zero, Add, Subtract, Multiply, MultiplyAdd, Min, Max and the horizontal ReduceAdd, ReduceMin and ReduceMax.
+
+template <typename V>
+void SumKernel(const typename V::Scalar* left, const typename V::Scalar* right, const size_t length, typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Add(V::Load(left + i), V::Load(right + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = left[i] + right[i];
+    }
+}
+
+template <typename V>
+void SubtractKernel(const typename V::Scalar* left, const typename V::Scalar* right, const size_t length, typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Subtract(V::Load(left + i), V::Load(right + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = left[i] - right[i];
+    }
+}
+
+template <typename V>
+void MinKernel(const typename V::Scalar* left, const typename V::Scalar* right, const size_t length, typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Min(V::Load(left + i), V::Load(right + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = left[i] < right[i] ? left[i] : right[i];
+    }
+}
+
+template <typename V>
+void MaxKernel(const typename V::Scalar* left, const typename V::Scalar* right, const size_t length, typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Max(V::Load(left + i), V::Load(right + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = left[i] > right[i] ? left[i] : right[i];
+    }
+}
+
+template <typename V>
+void MultiplyAddKernel(const typename V::Scalar* left, const typename V::Scalar* right, const typename V::Scalar* addend,
+                       const size_t length, typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::MultiplyAdd(V::Load(left + i), V::Load(right + i), V::Load(addend + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = left[i] * right[i] + addend[i];
+    }
+}
+
+template <typename V>
+void ScaleKernel(const typename V::Scalar* values, const typename V::Scalar scalar, const size_t length, typename V::Scalar* result)
+{
+    const typename V::Register broadcast = V::Broadcast(scalar);
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Multiply(broadcast, V::Load(values + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = scalar * values[i];
+    }
+}
+
+template <typename V>
+void AxpyKernel(const typename V::Scalar alpha, const typename V::Scalar* x, const size_t length, typename V::Scalar* y)
+{
+    const typename V::Register broadcast = V::Broadcast(alpha);
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(y + i, V::MultiplyAdd(broadcast, V::Load(x + i), V::Load(y + i)));
+    }
+    for (; i < length; i++)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename V>
+void GatherMultiplyKernel(const typename V::Scalar* values, const uint32_t* indices, const typename V::Scalar* x, const size_t length,
+                          typename V::Scalar* result)
+{
+    size_t i = 0;
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        V::Store(result + i, V::Multiply(V::Load(values + i), V::Gather(x, indices + i)));
+    }
+    for (; i < length; i++)
+    {
+        result[i] = values[i] * x[indices[i]];
+    }
+}
+
+template <typename V>
+typename V::Scalar DotKernel(const typename V::Scalar* left, const typename V::Scalar* right, const size_t length)
+{
+    // Four accumulators hide the latency of the dependent additions
+    typename V::Register sum0 = V::Zero(), sum1 = V::Zero(), sum2 = V::Zero(), sum3 = V::Zero();
+    size_t i = 0;
+    for (; i + 4 * V::Width <= length; i += 4 * V::Width)
+    {
+        sum0 = V::MultiplyAdd(V::Load(left + i), V::Load(right + i), sum0);
+        sum1 = V::MultiplyAdd(V::Load(left + i + V::Width), V::Load(right + i + V::Width), sum1);
+        sum2 = V::MultiplyAdd(V::Load(left + i + 2 * V::Width), V::Load(right + i + 2 * V::Width), sum2);
+        sum3 = V::MultiplyAdd(V::Load(left + i + 3 * V::Width), V::Load(right + i + 3 * V::Width), sum3);
+    }
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        sum0 = V::MultiplyAdd(V::Load(left + i), V::Load(right + i), sum0);
+    }
+
+    typename V::Scalar sum = V::ReduceAdd(V::Add(V::Add(sum0, sum1), V::Add(sum2, sum3)));
+    for (; i < length; i++)
+    {
+        sum += left[i] * right[i];
+    }
+    return sum;
+}
+
+template <typename V>
+typename V::Scalar ReduceSumKernel(const typename V::Scalar* values, const size_t length)
+{
+    typename V::Register sum0 = V::Zero(), sum1 = V::Zero(), sum2 = V::Zero(), sum3 = V::Zero();
+    size_t i = 0;
+    for (; i + 4 * V::Width <= length; i += 4 * V::Width)
+    {
+        sum0 = V::Add(sum0, V::Load(values + i));
+        sum1 = V::Add(sum1, V::Load(values + i + V::Width));
+        sum2 = V::Add(sum2, V::Load(values + i + 2 * V::Width));
+        sum3 = V::Add(sum3, V::Load(values + i + 3 * V::Width));
+    }
+    for (; i + V::Width <= length; i += V::Width)
+    {
+        sum0 = V::Add(sum0, V::Load(values + i));
+    }
+
+    typename V::Scalar sum = V::ReduceAdd(V::Add(V::Add(sum0, sum1), V::Add(sum2, sum3)));
+    for (; i < length; i++)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+
+template <typename V>
+typename V::Scalar ReduceMinKernel(const typename V::Scalar* values, const size_t length)
+{
+    typename V::Scalar minimum = values[0];
+    size_t i = 1;
+    if (length >= V::Width)
+    {
+        typename V::Register minima = V::Load(values);
+        for (i = V::Width; i + V::Width <= length; i += V::Width)
+        {
+            minima = V::Min(minima, V::Load(values + i));
+        }
+        minimum = V::ReduceMin(minima);
+    }
+    for (; i < length; i++)
+    {
+        minimum = values[i] < minimum ? values[i] : minimum;
+    }
+    return minimum;
+}
+
+template <typename V>
+typename V::Scalar ReduceMaxKernel(const typename V::Scalar* values, const size_t length)
+{
+    typename V::Scalar maximum = values[0];
+    size_t i = 1;
+    if (length >= V::Width)
+    {
+        typename V::Register maxima = V::Load(values);
+        for (i = V::Width; i + V::Width <= length; i += V::Width)
+        {
+            maxima = V::Max(maxima, V::Load(values + i));
+        }
+        maximum = V::ReduceMax(maxima);
+    }
+    for (; i < length; i++)
+    {
+        maximum = values[i] > maximum ? values[i] : maximum;
+    }
+    return maximum;
+}
+
+template <typename V>
+KernelTable<typename V::Scalar> CreateKernelTable()
+{
+    KernelTable<typename V::Scalar> table;
+    table.Sum = &SumKernel<V>;
+    table.Subtract = &SubtractKernel<V>;
+    table.Min = &MinKernel<V>;
+    table.Max = &MaxKernel<V>;
+    table.MultiplyAdd = &MultiplyAddKernel<V>;
+    table.Scale = &ScaleKernel<V>;
+    table.Axpy = &AxpyKernel<V>;
+    table.GatherMultiply = &GatherMultiplyKernel<V>;
+    table.Dot = &DotKernel<V>;
+    table.ReduceSum = &ReduceSumKernel<V>;
+    table.ReduceMin = &ReduceMinKernel<V>;
+    table.ReduceMax = &ReduceMaxKernel<V>;
+    return table;
+}
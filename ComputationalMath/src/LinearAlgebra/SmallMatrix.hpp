@@ -0,0 +1,209 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Calls body(std::integral_constant<size_t, i>) for i in [0, N), expanded at compile time instead of a loop.
+    /// </summary>
+    template <size_t N, typename Body>
+    constexpr void UnrolledFor(Body&& body)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            (body(std::integral_constant<size_t, I>{}), ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+    /// <summary>
+    /// Fixed size R x C matrix stored by value in row-major order, intended for element level kernels such as
+    /// Jacobians of finite elements. All operations are constexpr, fully unrolled and never allocate.
+    /// Determinant and inverse are computed in closed form for sizes up to 3 x 3.
+    /// </summary>
+    template <typename T, size_t R, size_t C>
+    class SmallMatrix
+    {
+        static_assert(R > 0 && C > 0, "SmallMatrix should have at least one row and column");
+
+    public:
+        constexpr SmallMatrix() : m_data{} {}
+
+        /// <summary>
+        /// Construct from R * C entries in row-major order.
+        /// </summary>
+        template <typename... Values>
+            requires(sizeof...(Values) == R * C && sizeof...(Values) > 0 && (std::is_convertible_v<Values, T> && ...))
+        constexpr SmallMatrix(const Values&... values) : m_data{static_cast<T>(values)...} {}
+
+        static constexpr SmallMatrix Identity()
+            requires(R == C)
+        {
+            SmallMatrix identity;
+            UnrolledFor<R>([&](auto i)
+                           { identity(i, i) = T(1); });
+            return identity;
+        }
+
+        static constexpr size_t GetRowCount() { return R; }
+        static constexpr size_t GetColumnCount() { return C; }
+
+        constexpr T& operator()(const size_t row, const size_t column) { return m_data[row * C + column]; }
+        constexpr const T& operator()(const size_t row, const size_t column) const { return m_data[row * C + column]; }
+
+        constexpr T& operator[](const size_t index)
+            requires(R == 1 || C == 1)
+        {
+            return m_data[index];
+        }
+
+        constexpr const T& operator[](const size_t index) const
+            requires(R == 1 || C == 1)
+        {
+            return m_data[index];
+        }
+
+        constexpr T* Data() { return m_data; }
+        constexpr const T* Data() const { return m_data; }
+
+        constexpr SmallMatrix<T, C, R> Transposed() const
+        {
+            SmallMatrix<T, C, R> transposed;
+            UnrolledFor<R>([&](auto i)
+                           { UnrolledFor<C>([&](auto j)
+                                            { transposed(j, i) = (*this)(i, j); }); });
+            return transposed;
+        }
+
+        constexpr T Determinant() const
+            requires(R == C && R >= 1 && R <= 3)
+        {
+            const SmallMatrix& m = *this;
+            if constexpr (R == 1)
+                return m(0, 0);
+            else if constexpr (R == 2)
+                return Determinant(m(0, 0), m(0, 1),
+                                   m(1, 0), m(1, 1));
+            else
+                return Determinant(m(0, 0), m(0, 1), m(0, 2),
+                                   m(1, 0), m(1, 1), m(1, 2),
+                                   m(2, 0), m(2, 1), m(2, 2));
+        }
+
+        /// <summary>
+        /// Closed form inverse, the adjugate divided by the determinant. Throws if the determinant is zero.
+        /// </summary>
+        constexpr SmallMatrix Inverse() const
+            requires(R == C && R >= 1 && R <= 3)
+        {
+            const T determinant = Determinant();
+            if (determinant == T(0))
+                throw std::invalid_argument("Degenerate matrix");
+
+            const SmallMatrix& m = *this;
+            if constexpr (R == 1)
+            {
+                return SmallMatrix(T(1) / determinant);
+            }
+            else if constexpr (R == 2)
+            {
+                return SmallMatrix(m(1, 1), -m(0, 1),
+                                   -m(1, 0), m(0, 0)) *
+                       (T(1) / determinant);
+            }
+            else
+            {
+                SmallMatrix adjugate(Determinant(m(1, 1), m(1, 2), m(2, 1), m(2, 2)),
+                                     -Determinant(m(0, 1), m(0, 2), m(2, 1), m(2, 2)),
+                                     Determinant(m(0, 1), m(0, 2), m(1, 1), m(1, 2)),
+                                     -Determinant(m(1, 0), m(1, 2), m(2, 0), m(2, 2)),
+                                     Determinant(m(0, 0), m(0, 2), m(2, 0), m(2, 2)),
+                                     -Determinant(m(0, 0), m(0, 2), m(1, 0), m(1, 2)),
+                                     Determinant(m(1, 0), m(1, 1), m(2, 0), m(2, 1)),
+                                     -Determinant(m(0, 0), m(0, 1), m(2, 0), m(2, 1)),
+                                     Determinant(m(0, 0), m(0, 1), m(1, 0), m(1, 1)));
+                return adjugate * (T(1) / determinant);
+            }
+        }
+
+        static constexpr T Determinant(const T& m11, const T& m12,
+                                       const T& m21, const T& m22)
+        {
+            return m11 * m22 - m21 * m12;
+        }
+
+        static constexpr T Determinant(const T& m11, const T& m12, const T& m13,
+                                       const T& m21, const T& m22, const T& m23,
+                                       const T& m31, const T& m32, const T& m33)
+        {
+            return m11 * Determinant(m22, m23, m32, m33) - m12 * Determinant(m21, m23, m31, m33) + m13 * Determinant(m21, m22, m31, m32);
+        }
+
+        constexpr SmallMatrix& operator+=(const SmallMatrix& other)
+        {
+            UnrolledFor<R * C>([&](auto i)
+                               { m_data[i] += other.m_data[i]; });
+            return *this;
+        }
+
+        constexpr SmallMatrix& operator-=(const SmallMatrix& other)
+        {
+            UnrolledFor<R * C>([&](auto i)
+                               { m_data[i] -= other.m_data[i]; });
+            return *this;
+        }
+
+        constexpr SmallMatrix& operator*=(const T& scalar)
+        {
+            UnrolledFor<R * C>([&](auto i)
+                               { m_data[i] *= scalar; });
+            return *this;
+        }
+
+        constexpr SmallMatrix operator+(const SmallMatrix& other) const { return SmallMatrix(*this) += other; }
+        constexpr SmallMatrix operator-(const SmallMatrix& other) const { return SmallMatrix(*this) -= other; }
+        constexpr SmallMatrix operator*(const T& scalar) const { return SmallMatrix(*this) *= scalar; }
+        friend constexpr SmallMatrix operator*(const T& scalar, const SmallMatrix& matrix) { return matrix * scalar; }
+
+        template <size_t K>
+        constexpr SmallMatrix<T, R, K> operator*(const SmallMatrix<T, C, K>& other) const
+        {
+            SmallMatrix<T, R, K> product;
+            UnrolledFor<R>([&](auto i)
+                           { UnrolledFor<K>([&](auto j)
+                                            {
+                                                T sum = 0;
+                                                UnrolledFor<C>([&](auto k)
+                                                               { sum += (*this)(i, k) * other(k, j); });
+                                                product(i, j) = sum; }); });
+            return product;
+        }
+
+        constexpr bool operator==(const SmallMatrix& other) const
+        {
+            for (size_t i = 0; i < R * C; i++)
+            {
+                if (m_data[i] != other.m_data[i])
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        T m_data[R * C];
+    };
+
+    template <typename T, size_t N>
+    using SmallVector = SmallMatrix<T, N, 1>;
+
+    template <typename T, size_t N>
+    constexpr T Dot(const SmallVector<T, N>& lhs, const SmallVector<T, N>& rhs)
+    {
+        T sum = 0;
+        UnrolledFor<N>([&](auto i)
+                       { sum += lhs[i] * rhs[i]; });
+        return sum;
+    }
+}
@@ -0,0 +1,280 @@
+#include "SparseCholesky.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace LinearAlgebra::Factorization
+{
+    namespace
+    {
+        constexpr SparseIndex None = SparseCholeskyAnalysis::None;
+
+        /// <summary>
+        /// Elimination tree of P A P^T by Liu's algorithm, with path compression through the ancestors.
+        /// </summary>
+        std::vector<SparseIndex> EliminationTree(const size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                                                 const std::vector<SparseIndex>& permutation, const std::vector<SparseIndex>& inverse)
+        {
+            std::vector<SparseIndex> parent(size, None);
+            std::vector<SparseIndex> ancestor(size, None);
+            for (SparseIndex i = 0; i < size; i++)
+            {
+                const SparseIndex row = permutation[i];
+                for (size_t k = rowOffsets[row]; k < rowOffsets[row + 1]; k++)
+                {
+                    SparseIndex j = inverse[columnIndices[k]];
+                    if (j >= i)
+                        continue;
+
+                    while (ancestor[j] != None && ancestor[j] != i)
+                    {
+                        const SparseIndex next = ancestor[j];
+                        ancestor[j] = i;
+                        j = next;
+                    }
+                    if (ancestor[j] == None)
+                    {
+                        ancestor[j] = i;
+                        parent[j] = i;
+                    }
+                }
+            }
+            return parent;
+        }
+
+        /// <summary>
+        /// Postorder of a forest, children are visited in ascending order. Returns postorder[k], the k-th node.
+        /// </summary>
+        std::vector<SparseIndex> Postorder(const std::vector<SparseIndex>& parent)
+        {
+            const size_t size = parent.size();
+            std::vector<SparseIndex> firstChild(size, None);
+            std::vector<SparseIndex> nextSibling(size, None);
+            for (size_t j = size; j-- > 0;)
+            {
+                if (parent[j] != None)
+                {
+                    nextSibling[j] = firstChild[parent[j]];
+                    firstChild[parent[j]] = static_cast<SparseIndex>(j);
+                }
+            }
+
+            std::vector<SparseIndex> postorder;
+            postorder.reserve(size);
+            std::vector<SparseIndex> stack;
+            for (SparseIndex root = 0; root < size; root++)
+            {
+                if (parent[root] != None)
+                    continue;
+
+                stack.push_back(root);
+                while (!stack.empty())
+                {
+                    const SparseIndex node = stack.back();
+                    if (firstChild[node] != None)
+                    {
+                        // Descend, and detach the child such that node is emitted after its last child
+                        const SparseIndex child = firstChild[node];
+                        firstChild[node] = nextSibling[child];
+                        stack.push_back(child);
+                    }
+                    else
+                    {
+                        postorder.push_back(node);
+                        stack.pop_back();
+                    }
+                }
+            }
+            return postorder;
+        }
+
+        /// <summary>
+        /// Whether a supernode of the merged width may hold zeros of its count of lower trapezoidal entries. Narrow
+        /// supernodes are always merged, wider ones only for a decreasing fraction of zeros, the defaults of CHOLMOD.
+        /// </summary>
+        bool IsRelaxedMergeAllowed(const size_t width, const size_t zeros, const size_t count)
+        {
+            if (width <= 4)
+                return true;
+            if (width <= 16)
+                return zeros <= count * 8 / 10;
+            if (width <= 48)
+                return zeros <= count / 10;
+            return zeros <= count / 20;
+        }
+    }
+
+    SparseCholeskyAnalysis::SparseCholeskyAnalysis(const size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                                                   const std::vector<SparseIndex>& permutation)
+    {
+        if (permutation.size() != size)
+            throw std::invalid_argument("Matrix and permutation dimensions mismatch");
+
+        std::vector<SparseIndex> inverse = Ordering::InversePermutation(permutation);
+        const std::vector<SparseIndex> parent = EliminationTree(size, rowOffsets, columnIndices, permutation, inverse);
+
+        // Renumber in postorder, which keeps the elimination tree, thus the fill, but makes every subtree a
+        // contiguous range of columns, and the chains of the supernodes consecutive
+        const std::vector<SparseIndex> postorder = Postorder(parent);
+        const std::vector<SparseIndex> postorderInverse = Ordering::InversePermutation(postorder);
+        m_permutation.resize(size);
+        m_parent.resize(size);
+        for (size_t k = 0; k < size; k++)
+        {
+            m_permutation[k] = permutation[postorder[k]];
+            m_parent[k] = parent[postorder[k]] == None ? None : postorderInverse[parent[postorder[k]]];
+        }
+        for (size_t k = 0; k < size; k++)
+            inverse[m_permutation[k]] = static_cast<SparseIndex>(k);
+
+        // Row i of L is the union of the paths in the elimination tree from the nonzeros of row i of A up to i
+        std::vector<size_t> columnCounts(size, 1);
+        std::vector<SparseIndex> childCounts(size, 0);
+        std::vector<SparseIndex> mark(size, None);
+        for (SparseIndex i = 0; i < size; i++)
+        {
+            if (m_parent[i] != None)
+                childCounts[m_parent[i]]++;
+
+            mark[i] = i;
+            const SparseIndex row = m_permutation[i];
+            for (size_t k = rowOffsets[row]; k < rowOffsets[row + 1]; k++)
+            {
+                for (SparseIndex j = inverse[columnIndices[k]]; j < i && mark[j] != i; j = m_parent[j])
+                {
+                    columnCounts[j]++;
+                    mark[j] = i;
+                }
+            }
+        }
+        for (const size_t count : columnCounts)
+            m_factorNonZeroCount += count;
+
+        // Fundamental supernodes: a column joins the supernode of the previous column when that is its only child,
+        // and its structure is the structure of the child without the child itself
+        std::vector<SparseIndex> fundamentalStarts;
+        for (SparseIndex j = 0; j < size; j++)
+        {
+            const bool extends = j > 0 && m_parent[j - 1] == j && childCounts[j] == 1 && columnCounts[j - 1] == columnCounts[j] + 1
+                                 && j - fundamentalStarts.back() < MaxSupernodeWidth;
+            if (!extends)
+                fundamentalStarts.push_back(j);
+        }
+        fundamentalStarts.push_back(static_cast<SparseIndex>(size));
+
+        // Relaxed supernodes: in postorder, the last child of a supernode precedes it, and is merged into it while the
+        // explicit zeros of the merged supernode stay within the budget of its width, as in the amalgamation of CHOLMOD.
+        // The rows below the child are rows of its parent, so the merged supernode has the rows below the parent.
+        struct RelaxedSupernode
+        {
+            SparseIndex First;
+            size_t Width;
+            size_t Below;
+            size_t NonZeroCount;
+        };
+        std::vector<RelaxedSupernode> relaxed;
+        for (size_t f = 0; f + 1 < fundamentalStarts.size(); f++)
+        {
+            const SparseIndex first = fundamentalStarts[f];
+            const size_t width = fundamentalStarts[f + 1] - first;
+            RelaxedSupernode supernode{first, width, columnCounts[first] - width, 0};
+            for (SparseIndex j = first; j < fundamentalStarts[f + 1]; j++)
+                supernode.NonZeroCount += columnCounts[j];
+
+            if (!relaxed.empty() && m_parent[first - 1] == first)
+            {
+                const RelaxedSupernode& child = relaxed.back();
+                const size_t mergedWidth = child.Width + width;
+                const size_t mergedCount = mergedWidth * (mergedWidth + 1) / 2 + mergedWidth * supernode.Below;
+                const size_t mergedZeros = mergedCount - child.NonZeroCount - supernode.NonZeroCount;
+                if (mergedWidth <= MaxSupernodeWidth && IsRelaxedMergeAllowed(mergedWidth, mergedZeros, mergedCount))
+                {
+                    supernode.First = child.First;
+                    supernode.Width = mergedWidth;
+                    supernode.NonZeroCount += child.NonZeroCount;
+                    relaxed.pop_back();
+                }
+            }
+            relaxed.push_back(supernode);
+        }
+
+        m_columnSupernodes.resize(size);
+        for (const RelaxedSupernode& supernode : relaxed)
+        {
+            const SparseIndex s = static_cast<SparseIndex>(m_supernodeStarts.size());
+            m_supernodeStarts.push_back(supernode.First);
+            std::fill(m_columnSupernodes.begin() + supernode.First, m_columnSupernodes.begin() + supernode.First + supernode.Width, s);
+        }
+        m_supernodeStarts.push_back(static_cast<SparseIndex>(size));
+
+        // The rows of a supernode are its columns, the rows of A below them, and the rows of its children below them.
+        // In postorder, the children precede their parent.
+        const size_t supernodeCount = GetSupernodeCount();
+        std::vector<std::vector<SparseIndex>> children(supernodeCount);
+        m_rowOffsets.assign(1, 0);
+        m_valueOffsets.assign(1, 0);
+        std::fill(mark.begin(), mark.end(), None);
+        for (size_t s = 0; s < supernodeCount; s++)
+        {
+            const SparseIndex first = m_supernodeStarts[s];
+            const SparseIndex last = m_supernodeStarts[s + 1] - 1;
+            for (SparseIndex j = first; j <= last; j++)
+                m_rows.push_back(j);
+
+            const size_t belowStart = m_rows.size();
+            const auto addRow = [&](const SparseIndex row)
+            {
+                if (row > last && mark[row] != s)
+                {
+                    mark[row] = static_cast<SparseIndex>(s);
+                    m_rows.push_back(row);
+                }
+            };
+            for (SparseIndex j = first; j <= last; j++)
+            {
+                const SparseIndex row = m_permutation[j];
+                for (size_t k = rowOffsets[row]; k < rowOffsets[row + 1]; k++)
+                    addRow(inverse[columnIndices[k]]);
+            }
+            for (const SparseIndex child : children[s])
+            {
+                for (size_t k = m_rowOffsets[child] + m_supernodeStarts[child + 1] - m_supernodeStarts[child]; k < m_rowOffsets[child + 1]; k++)
+                    addRow(m_rows[k]);
+            }
+            std::sort(m_rows.begin() + belowStart, m_rows.end());
+
+            const size_t width = last - first + 1;
+            m_rowOffsets.push_back(m_rows.size());
+            m_valueOffsets.push_back(m_valueOffsets.back() + (m_rows.size() - m_rowOffsets[s]) * width);
+            if (m_parent[last] != None)
+                children[m_columnSupernodes[m_parent[last]]].push_back(static_cast<SparseIndex>(s));
+        }
+
+        // Of the symmetric pair of nonzeros of A, the one in the row of the earlier unknown is scattered into the
+        // panel, as the entry of that column of L
+        const size_t nonZeroCount = rowOffsets[size];
+        m_valueTargets.assign(nonZeroCount, NoTarget);
+        std::vector<SparseIndex> relativeRows(size, None);
+        for (size_t s = 0; s < supernodeCount; s++)
+        {
+            for (size_t k = m_rowOffsets[s]; k < m_rowOffsets[s + 1]; k++)
+                relativeRows[m_rows[k]] = static_cast<SparseIndex>(k - m_rowOffsets[s]);
+
+            const SparseIndex first = m_supernodeStarts[s];
+            const size_t width = m_supernodeStarts[s + 1] - first;
+            for (SparseIndex j = first; j < m_supernodeStarts[s + 1]; j++)
+            {
+                const SparseIndex row = m_permutation[j];
+                for (size_t k = rowOffsets[row]; k < rowOffsets[row + 1]; k++)
+                {
+                    const SparseIndex i = inverse[columnIndices[k]];
+                    if (i >= j)
+                        m_valueTargets[k] = m_valueOffsets[s] + relativeRows[i] * width + (j - first);
+                }
+            }
+        }
+
+        m_patternRowOffsets.assign(rowOffsets, rowOffsets + size + 1);
+        m_patternColumnIndices.assign(columnIndices, columnIndices + nonZeroCount);
+    }
+}
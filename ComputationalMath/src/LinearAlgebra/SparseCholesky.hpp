@@ -0,0 +1,367 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Blas1.hpp"
+#include "FactorizationCholesky.hpp"
+#include "Gemm.hpp"
+#include "SparseMatrix.hpp"
+#include "SparseOrdering.hpp"
+#include "Trsm.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra::Factorization
+{
+    /// <summary>
+    /// Symbolic analysis of the sparse Cholesky factorization P A P^T = L L^T of a symmetric matrix, which only
+    /// depends on the sparsity pattern of A and the ordering P. It is thus computed once and reused by any number of
+    /// numeric factorizations of matrices with the same pattern, such as M + dt * K for every time step size dt.
+    ///
+    /// The analysis computes the elimination tree of P A P^T, reorders it in postorder, counts the nonzeros of every
+    /// column of L, and groups consecutive columns with the same structure below the diagonal block, a chain in the
+    /// elimination tree, into supernodes. As these are narrow for mesh operators, a supernode is then merged with the
+    /// supernode of its last child while that adds few explicit zeros. The rows of a supernode are stored as one dense
+    /// row-major panel: the (lower triangular) diagonal block of its columns, followed by the rows below it.
+    /// </summary>
+    class SparseCholeskyAnalysis
+    {
+    public:
+        static constexpr SparseIndex None = std::numeric_limits<SparseIndex>::max();
+        static constexpr size_t NoTarget = std::numeric_limits<size_t>::max();
+
+        /// <summary>
+        /// Supernodes are split at this many columns, which bounds the dense diagonal blocks.
+        /// </summary>
+        static constexpr size_t MaxSupernodeWidth = 128;
+
+        /// <summary>
+        /// Analysis of the symmetric pattern (rowOffsets, columnIndices) of size x size, of which both triangles are
+        /// stored, in the ordering permutation, permutation[i] is the original index of the i-th unknown.
+        /// </summary>
+        SparseCholeskyAnalysis(size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices, const std::vector<SparseIndex>& permutation);
+
+        template <typename T>
+        SparseCholeskyAnalysis(const SparseMatrix<T>& matrix, const std::vector<SparseIndex>& permutation)
+            : SparseCholeskyAnalysis(AssertSquare(matrix), matrix.RowOffsets(), matrix.ColumnIndices(), permutation)
+        {
+        }
+
+        /// <summary>
+        /// Analysis in the nested dissection ordering of the graph of A.
+        /// </summary>
+        template <typename T>
+        explicit SparseCholeskyAnalysis(const SparseMatrix<T>& matrix)
+            : SparseCholeskyAnalysis(matrix, Ordering::NestedDissection(matrix))
+        {
+        }
+
+        size_t GetSize() const { return m_permutation.size(); }
+        size_t GetSupernodeCount() const { return m_supernodeStarts.size() - 1; }
+
+        /// <summary>
+        /// Nonzeros of L, including the diagonal.
+        /// </summary>
+        size_t GetFactorNonZeroCount() const { return m_factorNonZeroCount; }
+
+        /// <summary>
+        /// Values stored for L, which includes the explicit zeros of the merged supernodes, and above the diagonal of
+        /// the diagonal blocks.
+        /// </summary>
+        size_t GetFactorValueCount() const { return m_valueOffsets.back(); }
+
+        /// <summary>
+        /// Final ordering, the given permutation composed with the postorder of the elimination tree.
+        /// </summary>
+        const std::vector<SparseIndex>& GetPermutation() const { return m_permutation; }
+
+        /// <summary>
+        /// Parent of every column in the elimination tree of P A P^T, None for the roots.
+        /// </summary>
+        const std::vector<SparseIndex>& GetEliminationTree() const { return m_parent; }
+
+        /// <summary>
+        /// Columns [SupernodeStarts()[s], SupernodeStarts()[s + 1]) form supernode s.
+        /// </summary>
+        const std::vector<SparseIndex>& SupernodeStarts() const { return m_supernodeStarts; }
+
+        /// <summary>
+        /// The rows of supernode s are SupernodeRows()[SupernodeRowOffsets()[s] ...], ascending, starting with its columns.
+        /// </summary>
+        const std::vector<size_t>& SupernodeRowOffsets() const { return m_rowOffsets; }
+        const std::vector<SparseIndex>& SupernodeRows() const { return m_rows; }
+
+        /// <summary>
+        /// Offset of the panel of supernode s in the values of the factor.
+        /// </summary>
+        const std::vector<size_t>& SupernodeValueOffsets() const { return m_valueOffsets; }
+
+        const std::vector<SparseIndex>& ColumnSupernodes() const { return m_columnSupernodes; }
+
+        /// <summary>
+        /// Offset in the values of the factor of every nonzero of A, of which the symmetric pair is read once: the
+        /// nonzero in the row of the unknown that is eliminated first. NoTarget for the other one.
+        /// </summary>
+        const std::vector<size_t>& ValueTargets() const { return m_valueTargets; }
+
+        /// <summary>
+        /// Whether the pattern of the matrix is the analysed pattern.
+        /// </summary>
+        template <typename T>
+        bool IsPatternOf(const SparseMatrix<T>& matrix) const
+        {
+            return matrix.GetRowCount() == GetSize() && matrix.GetColumnCount() == GetSize()
+                   && std::equal(m_patternRowOffsets.begin(), m_patternRowOffsets.end(), matrix.RowOffsets())
+                   && std::equal(m_patternColumnIndices.begin(), m_patternColumnIndices.end(), matrix.ColumnIndices());
+        }
+
+    private:
+        template <typename T>
+        static size_t AssertSquare(const SparseMatrix<T>& matrix)
+        {
+            if (matrix.GetRowCount() != matrix.GetColumnCount())
+                throw std::invalid_argument("Non-square matrix");
+            return matrix.GetRowCount();
+        }
+
+    private:
+        std::vector<SparseIndex> m_permutation;
+        std::vector<SparseIndex> m_parent;
+        std::vector<SparseIndex> m_supernodeStarts;
+        std::vector<SparseIndex> m_columnSupernodes;
+        std::vector<size_t> m_rowOffsets;
+        std::vector<SparseIndex> m_rows;
+        std::vector<size_t> m_valueOffsets;
+        std::vector<size_t> m_valueTargets;
+        std::vector<SparseIndex> m_patternRowOffsets;
+        std::vector<SparseIndex> m_patternColumnIndices;
+        size_t m_factorNonZeroCount = 0;
+    };
+
+    /// <summary>
+    /// Supernodal sparse Cholesky factorization P A P^T = L L^T of a symmetric positive definite matrix, computed
+    /// once and reused for any number of right-hand sides. Factorize recomputes L for new values on the same pattern,
+    /// with the analysis of the construction.
+    ///
+    /// The numeric factorization is right-looking over the supernodes: the diagonal block is factorized by the dense
+    /// Cholesky kernel, the rows below it are solved by a TRSM, and their update of the ancestor supernodes,
+    /// -L_b L_b^T, is formed by a GEMM and scattered into the panels of those supernodes.
+    /// </summary>
+    template <typename T>
+    class SparseCholeskyFactorization
+    {
+    public:
+        SparseCholeskyFactorization(SparseCholeskyAnalysis analysis, const SparseMatrix<T>& matrix, T tolerance);
+
+        /// <summary>
+        /// Factorization in the nested dissection ordering of the graph of A.
+        /// </summary>
+        SparseCholeskyFactorization(const SparseMatrix<T>& matrix, T tolerance);
+
+        size_t GetSize() const { return m_analysis.GetSize(); }
+        const SparseCholeskyAnalysis& GetAnalysis() const { return m_analysis; }
+
+        /// <summary>
+        /// Refactorizes for the values of matrix, which has the analysed pattern.
+        /// </summary>
+        void Factorize(const SparseMatrix<T>& matrix);
+
+        ColumnVector<T> Solve(const ColumnVector<T>& rhs) const;
+        void SolveInPlace(ColumnVector<T>& rhs) const;
+
+    private:
+        void ScatterUpdate(size_t supernode, const T* update, size_t updateSize, std::vector<SparseIndex>& relativeRows);
+
+    private:
+        SparseCholeskyAnalysis m_analysis;
+        T m_tolerance;
+        std::vector<T> m_values;
+    };
+
+    template <typename T>
+    SparseCholeskyFactorization<T>::SparseCholeskyFactorization(SparseCholeskyAnalysis analysis, const SparseMatrix<T>& matrix, const T tolerance)
+        : m_analysis(std::move(analysis)), m_tolerance(tolerance)
+    {
+        Factorize(matrix);
+    }
+
+    template <typename T>
+    SparseCholeskyFactorization<T>::SparseCholeskyFactorization(const SparseMatrix<T>& matrix, const T tolerance)
+        : SparseCholeskyFactorization(SparseCholeskyAnalysis(matrix), matrix, tolerance)
+    {
+    }
+
+    template <typename T>
+    void SparseCholeskyFactorization<T>::Factorize(const SparseMatrix<T>& matrix)
+    {
+        if (!m_analysis.IsPatternOf(matrix))
+            throw std::invalid_argument("Sparsity pattern mismatch");
+
+        const std::vector<SparseIndex>& starts = m_analysis.SupernodeStarts();
+        const std::vector<size_t>& rowOffsets = m_analysis.SupernodeRowOffsets();
+        const std::vector<size_t>& valueOffsets = m_analysis.SupernodeValueOffsets();
+
+        // Scatter the lower triangle of P A P^T into the panels
+        m_values.assign(m_analysis.GetFactorValueCount(), T(0));
+        const std::vector<size_t>& targets = m_analysis.ValueTargets();
+        for (size_t k = 0; k < targets.size(); k++)
+        {
+            if (targets[k] != SparseCholeskyAnalysis::NoTarget)
+                m_values[targets[k]] += matrix.Values()[k];
+        }
+
+        size_t maxBelow = 0;
+        size_t maxPanel = 0;
+        for (size_t s = 0; s < m_analysis.GetSupernodeCount(); s++)
+        {
+            const size_t width = starts[s + 1] - starts[s];
+            const size_t below = rowOffsets[s + 1] - rowOffsets[s] - width;
+            maxBelow = std::max(maxBelow, below);
+            maxPanel = std::max(maxPanel, below * width);
+        }
+        std::vector<T> transposed(maxPanel);
+        std::vector<T> update(maxBelow * maxBelow);
+        std::vector<SparseIndex> relativeRows(maxBelow);
+
+        constexpr size_t updateRowBlock = 64;
+        for (size_t s = 0; s < m_analysis.GetSupernodeCount(); s++)
+        {
+            const size_t width = starts[s + 1] - starts[s];
+            const size_t below = rowOffsets[s + 1] - rowOffsets[s] - width;
+            T* diagonal = m_values.data() + valueOffsets[s];
+            CholeskyTileInPlace(diagonal, width, width, m_tolerance);
+            if (below == 0)
+                continue;
+
+            // L_b = A_b L_d^-T, solved as L_d W = A_b^T, with W the transposed panel below the diagonal block
+            T* panel = diagonal + width * width;
+            for (size_t r = 0; r < below; r++)
+            {
+                for (size_t c = 0; c < width; c++)
+                    transposed[c * below + r] = panel[r * width + c];
+            }
+            Blas::Trsm(Blas::Triangle::Lower, Blas::Diagonal::NonUnit, width, below, diagonal, width, transposed.data(), below);
+            for (size_t r = 0; r < below; r++)
+            {
+                for (size_t c = 0; c < width; c++)
+                    panel[r * width + c] = transposed[c * below + r];
+            }
+
+            // The lower triangle of -L_b L_b^T = -L_b W, in blocks of rows up to the diagonal
+            for (size_t row = 0; row < below; row += updateRowBlock)
+            {
+                const size_t rowEnd = std::min(below, row + updateRowBlock);
+                Blas::Gemm(rowEnd - row, rowEnd, width, T(-1), panel + row * width, width, transposed.data(), below,
+                           T(0), update.data() + row * below, below);
+            }
+            ScatterUpdate(s, update.data(), below, relativeRows);
+        }
+    }
+
+    template <typename T>
+    void SparseCholeskyFactorization<T>::ScatterUpdate(const size_t supernode, const T* update, const size_t updateSize,
+                                                       std::vector<SparseIndex>& relativeRows)
+    {
+        const std::vector<SparseIndex>& starts = m_analysis.SupernodeStarts();
+        const std::vector<size_t>& rowOffsets = m_analysis.SupernodeRowOffsets();
+        const std::vector<SparseIndex>& rows = m_analysis.SupernodeRows();
+        const std::vector<SparseIndex>& columnSupernodes = m_analysis.ColumnSupernodes();
+        const SparseIndex* updateRows = rows.data() + rowOffsets[supernode] + (starts[supernode + 1] - starts[supernode]);
+
+        // The update rows are a subset of the rows of every target supernode from its first column on, both are
+        // ascending, thus a merge finds their positions in the target panel
+        size_t column = 0;
+        while (column < updateSize)
+        {
+            const SparseIndex target = columnSupernodes[updateRows[column]];
+            const size_t targetStart = starts[target];
+            const size_t targetWidth = starts[target + 1] - targetStart;
+            const SparseIndex* targetRows = rows.data() + rowOffsets[target];
+            size_t columnEnd = column;
+            while (columnEnd < updateSize && columnSupernodes[updateRows[columnEnd]] == target)
+                columnEnd++;
+
+            size_t position = 0;
+            for (size_t i = column; i < updateSize; i++)
+            {
+                while (targetRows[position] != updateRows[i])
+                    position++;
+                relativeRows[i] = static_cast<SparseIndex>(position);
+            }
+
+            T* targetPanel = m_values.data() + m_analysis.SupernodeValueOffsets()[target];
+            for (size_t j = column; j < columnEnd; j++)
+            {
+                const size_t targetColumn = updateRows[j] - targetStart;
+                for (size_t i = j; i < updateSize; i++)
+                    targetPanel[relativeRows[i] * targetWidth + targetColumn] += update[i * updateSize + j];
+            }
+            column = columnEnd;
+        }
+    }
+
+    template <typename T>
+    ColumnVector<T> SparseCholeskyFactorization<T>::Solve(const ColumnVector<T>& rhs) const
+    {
+        ColumnVector<T> solution(rhs);
+        SolveInPlace(solution);
+        return solution;
+    }
+
+    template <typename T>
+    void SparseCholeskyFactorization<T>::SolveInPlace(ColumnVector<T>& rhs) const
+    {
+        if (GetSize() != rhs.GetLength())
+            throw std::invalid_argument("Matrix and Vector dimensions mismatch");
+
+        const std::vector<SparseIndex>& permutation = m_analysis.GetPermutation();
+        const std::vector<SparseIndex>& starts = m_analysis.SupernodeStarts();
+        const std::vector<size_t>& rowOffsets = m_analysis.SupernodeRowOffsets();
+        const std::vector<SparseIndex>& rows = m_analysis.SupernodeRows();
+        const std::vector<size_t>& valueOffsets = m_analysis.SupernodeValueOffsets();
+
+        std::vector<T> x(GetSize());
+        for (size_t i = 0; i < x.size(); i++)
+            x[i] = rhs[permutation[i]];
+
+        // L y = P b, supernode by supernode: the diagonal block, then the rows below
+        for (size_t s = 0; s < m_analysis.GetSupernodeCount(); s++)
+        {
+            const size_t width = starts[s + 1] - starts[s];
+            const size_t below = rowOffsets[s + 1] - rowOffsets[s] - width;
+            const T* diagonal = m_values.data() + valueOffsets[s];
+            T* xs = x.data() + starts[s];
+            for (size_t r = 0; r < width; r++)
+                xs[r] = (xs[r] - Blas::Dot(r, diagonal + r * width, xs)) / diagonal[r * width + r];
+
+            const T* panel = diagonal + width * width;
+            const SparseIndex* belowRows = rows.data() + rowOffsets[s] + width;
+            for (size_t r = 0; r < below; r++)
+                x[belowRows[r]] -= Blas::Dot(width, panel + r * width, xs);
+        }
+
+        // L^T x = y, in reverse
+        for (size_t s = m_analysis.GetSupernodeCount(); s-- > 0;)
+        {
+            const size_t width = starts[s + 1] - starts[s];
+            const size_t below = rowOffsets[s + 1] - rowOffsets[s] - width;
+            const T* diagonal = m_values.data() + valueOffsets[s];
+            T* xs = x.data() + starts[s];
+
+            const T* panel = diagonal + width * width;
+            const SparseIndex* belowRows = rows.data() + rowOffsets[s] + width;
+            for (size_t r = 0; r < below; r++)
+                Blas::Axpy(width, -x[belowRows[r]], panel + r * width, xs);
+            for (size_t r = width; r-- > 0;)
+            {
+                xs[r] /= diagonal[r * width + r];
+                Blas::Axpy(r, -xs[r], diagonal + r * width, xs);
+            }
+        }
+
+        for (size_t i = 0; i < x.size(); i++)
+            rhs[permutation[i]] = x[i];
+    }
+}
@@ -0,0 +1,606 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Matrix.hpp"
+#include "SimdOps.hpp"
+#include "ThreadPool.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Row offsets and column indices of SparseMatrix. 32-bit indices halve the index traffic of SpMV, which is bound
+    /// by memory bandwidth, compared to size_t.
+    /// </summary>
+    using SparseIndex = uint32_t;
+
+    /// <summary>
+    /// Value at (Row, Column) to construct a SparseMatrix from, e.g. the contributions of the elements of a mesh.
+    /// </summary>
+    template <typename T>
+    struct SparseEntry
+    {
+        SparseIndex Row;
+        SparseIndex Column;
+        T Value;
+    };
+}
+
+namespace LinearAlgebra::Blas
+{
+    // Below this amount of nonzeros, the sparse products stay on the calling thread
+    constexpr size_t ParallelSpmvThreshold = 64 * 1024;
+
+    // Minimal number of rows per parallel task
+    constexpr size_t SpmvRowBlock = 256;
+
+    // Products of the nonzeros are gathered in chunks of this size, such that the chunk stays in L1
+    constexpr size_t SpmvChunk = 512;
+
+    /// <summary>
+    /// Serial y = alpha * A * x + beta * y for the rows [rowBegin, rowEnd) of the CSR matrix A. The products of a run of
+    /// short rows are gathered with SIMD in one chunk, and summed per row afterwards, such that rows with fewer nonzeros
+    /// than the register width, as the ~7 of a P1 FEM matrix, still fill the registers.
+    /// </summary>
+    template <typename T>
+    void SerialSpmv(const size_t rowBegin, const size_t rowEnd, const T& alpha, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                    const T* values, const T* x, const T& beta, T* y)
+    {
+        if constexpr (SimdOps::IsAccelerated<T>)
+        {
+            T products[SpmvChunk];
+            size_t row = rowBegin;
+            while (row < rowEnd)
+            {
+                const size_t begin = rowOffsets[row];
+                size_t last = row + 1;
+                while (last < rowEnd && rowOffsets[last + 1] - begin <= SpmvChunk)
+                    last++;
+
+                const size_t end = rowOffsets[last];
+                if (end - begin <= SpmvChunk)
+                {
+                    SimdOps::GatherMultiply(values + begin, columnIndices + begin, x, end - begin, products);
+                    for (size_t i = row; i < last; i++)
+                    {
+                        T sum = 0;
+                        for (size_t k = rowOffsets[i] - begin; k < rowOffsets[i + 1] - begin; k++)
+                            sum += products[k];
+                        y[i] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[i];
+                    }
+                }
+                else
+                {
+                    // A single row longer than a chunk
+                    T sum = 0;
+                    for (size_t k = begin; k < end; k += SpmvChunk)
+                    {
+                        const size_t length = std::min(SpmvChunk, end - k);
+                        SimdOps::GatherMultiply(values + k, columnIndices + k, x, length, products);
+                        sum += SimdOps::ReduceSum(products, length);
+                    }
+                    y[row] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[row];
+                }
+                row = last;
+            }
+        }
+        else
+        {
+            for (size_t i = rowBegin; i < rowEnd; i++)
+            {
+                T sum = 0;
+                for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++)
+                    sum += values[k] * x[columnIndices[k]];
+                y[i] = beta == T(0) ? alpha * sum : alpha * sum + beta * y[i];
+            }
+        }
+    }
+
+    /// <summary>
+    /// First row of block of blockCount blocks with about the same amount of nonzeros, rowCount for block blockCount.
+    /// </summary>
+    inline size_t SparseBlockBegin(const size_t block, const size_t blockCount, const size_t rowCount, const SparseIndex* rowOffsets)
+    {
+        if (block >= blockCount)
+            return rowCount;
+        const size_t target = static_cast<size_t>(rowOffsets[rowCount]) * block / blockCount;
+        return static_cast<size_t>(std::lower_bound(rowOffsets, rowOffsets + rowCount, target) - rowOffsets);
+    }
+
+    /// <summary>
+    /// Sparse matrix-vector product y = alpha * A * x + beta * y, where A is an m-row CSR matrix. y may not overlap x.
+    /// Large products are distributed over Parallel::GlobalThreadPool() in blocks with about the same amount of nonzeros.
+    /// </summary>
+    template <typename T>
+    void Spmv(const size_t m, const T& alpha, const SparseIndex* rowOffsets, const SparseIndex* columnIndices, const T* values,
+              const T* x, const T& beta, T* y)
+    {
+        ThreadPool& pool = Parallel::GlobalThreadPool();
+        if (rowOffsets[m] < ParallelSpmvThreshold || pool.GetThreadCount() == 1)
+        {
+            SerialSpmv(0, m, alpha, rowOffsets, columnIndices, values, x, beta, y);
+            return;
+        }
+
+        const size_t blockCount = std::max<size_t>(1, std::min(4 * pool.GetThreadCount(), m / SpmvRowBlock));
+        pool.ParallelFor(blockCount, [&](const size_t block)
+                         { SerialSpmv(SparseBlockBegin(block, blockCount, m, rowOffsets), SparseBlockBegin(block + 1, blockCount, m, rowOffsets),
+                                      alpha, rowOffsets, columnIndices, values, x, beta, y); });
+    }
+
+    /// <summary>
+    /// Serial y += alpha * A^T * x for the rows [rowBegin, rowEnd) of the CSR matrix A, scattering row i into y.
+    /// </summary>
+    template <typename T>
+    void SerialSpmvTransposed(const size_t rowBegin, const size_t rowEnd, const T& alpha, const SparseIndex* rowOffsets,
+                              const SparseIndex* columnIndices, const T* values, const T* x, T* y)
+    {
+        for (size_t i = rowBegin; i < rowEnd; i++)
+        {
+            const T scale = alpha * x[i];
+            for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++)
+                y[columnIndices[k]] += scale * values[k];
+        }
+    }
+
+    /// <summary>
+    /// Transposed sparse matrix-vector product y = alpha * A^T * x + beta * y, where A is an m x n CSR matrix. y may not
+    /// overlap x. The rows of A scatter into y, thus in parallel every block scatters into its own copy of y, which are
+    /// summed afterwards. This costs a vector of n per thread.
+    /// </summary>
+    template <typename T>
+    void SpmvTransposed(const size_t m, const size_t n, const T& alpha, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                        const T* values, const T* x, const T& beta, T* y)
+    {
+        if (beta == T(0))
+            std::fill(y, y + n, T(0));
+        else if (beta != T(1))
+            std::for_each(y, y + n, [&beta](T& value)
+                          { value *= beta; });
+
+        ThreadPool& pool = Parallel::GlobalThreadPool();
+        if (rowOffsets[m] < ParallelSpmvThreshold || pool.GetThreadCount() == 1)
+        {
+            SerialSpmvTransposed(0, m, alpha, rowOffsets, columnIndices, values, x, y);
+            return;
+        }
+
+        const size_t blockCount = std::max<size_t>(1, std::min(pool.GetThreadCount(), m / SpmvRowBlock));
+        std::vector<std::vector<T>> partials(blockCount - 1, std::vector<T>(n, T(0)));
+        pool.ParallelFor(blockCount, [&](const size_t block)
+                         { SerialSpmvTransposed(SparseBlockBegin(block, blockCount, m, rowOffsets), SparseBlockBegin(block + 1, blockCount, m, rowOffsets),
+                                                alpha, rowOffsets, columnIndices, values, x, block == 0 ? y : partials[block - 1].data()); });
+
+        const size_t columnBlock = (n + blockCount - 1) / blockCount;
+        pool.ParallelFor(blockCount, [&](const size_t block)
+                         {
+                             const size_t begin = std::min(n, block * columnBlock);
+                             const size_t end = std::min(n, begin + columnBlock);
+                             for (const std::vector<T>& partial : partials)
+                             {
+                                 for (size_t j = begin; j < end; j++)
+                                     y[j] += partial[j];
+                             } });
+    }
+}
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Sparse matrix in compressed sparse row (CSR) format: the nonzeros of row i are stored at the positions
+    /// [RowOffsets()[i], RowOffsets()[i + 1]), with increasing column indices. The sparsity pattern is fixed once
+    /// constructed, its values may be modified. Dimensions are limited to 2^31 - 1 and the nonzeros to 2^32 - 1, such
+    /// that the products can gather with 32-bit indices.
+    /// </summary>
+    template <typename T>
+    class SparseMatrix
+    {
+    public:
+        SparseMatrix();
+
+        /// <summary>
+        /// Matrix of rowCount x columnCount without nonzeros.
+        /// </summary>
+        SparseMatrix(size_t rowCount, size_t columnCount);
+
+        /// <summary>
+        /// Adopts CSR arrays, rowOffsets has rowCount + 1 elements and the columns of a row are strictly increasing.
+        /// </summary>
+        SparseMatrix(size_t rowCount, size_t columnCount, std::vector<SparseIndex> rowOffsets, std::vector<SparseIndex> columnIndices,
+                     std::vector<T> values);
+
+        /// <summary>
+        /// Matrix of the entries in any order, the values of duplicate entries are summed.
+        /// </summary>
+        SparseMatrix(size_t rowCount, size_t columnCount, const std::vector<SparseEntry<T>>& entries);
+
+        /// <summary>
+        /// Matrix of the nonzero elements of a dense matrix.
+        /// </summary>
+        explicit SparseMatrix(const Matrix<T>& matrix);
+
+        size_t GetRowCount() const { return m_rowCount; }
+        size_t GetColumnCount() const { return m_columnCount; }
+        size_t GetNonZeroCount() const { return m_values.size(); }
+
+        const SparseIndex* RowOffsets() const { return m_rowOffsets.data(); }
+        const SparseIndex* ColumnIndices() const { return m_columnIndices.data(); }
+        T* Values() { return m_values.data(); }
+        const T* Values() const { return m_values.data(); }
+
+        /// <summary>
+        /// Element (row, column), zero when it is not in the sparsity pattern.
+        /// </summary>
+        T operator()(size_t row, size_t column) const;
+
+        /// <summary>
+        /// Position of (row, column) in Values(), or GetNonZeroCount() when it is not in the sparsity pattern.
+        /// </summary>
+        size_t FindIndex(size_t row, size_t column) const;
+
+        ColumnVector<T> GetDiagonal() const;
+
+        /// <summary>
+        /// Scales row i by scales[i], e.g. to apply a diagonal (Jacobi) scaling D * A.
+        /// </summary>
+        void ScaleRows(const ColumnVector<T>& scales);
+
+        SparseMatrix& operator*=(const T& scalar);
+
+        ColumnVector<T> operator*(const ColumnVector<T>& vector) const;
+
+        /// <summary>
+        /// Sparse matrix-matrix product, row by row with a dense accumulator over the columns of the result (Gustavson).
+        /// </summary>
+        SparseMatrix operator*(const SparseMatrix& other) const;
+
+        SparseMatrix Transposed() const;
+
+        /// <summary>
+        /// A^T * vector, without forming the transpose.
+        /// </summary>
+        ColumnVector<T> TransposedMultiply(const ColumnVector<T>& vector) const;
+
+        Matrix<T> ToMatrix() const;
+
+    private:
+        void AssertIndexRange() const;
+
+    private:
+        size_t m_rowCount;
+        size_t m_columnCount;
+        std::vector<SparseIndex> m_rowOffsets;
+        std::vector<SparseIndex> m_columnIndices;
+        std::vector<T> m_values;
+    };
+
+    template <typename T>
+    SparseMatrix<T>::SparseMatrix()
+        : SparseMatrix(0, 0)
+    {
+    }
+
+    template <typename T>
+    SparseMatrix<T>::SparseMatrix(const size_t rowCount, const size_t columnCount)
+        : m_rowCount(rowCount), m_columnCount(columnCount)
+    {
+        AssertIndexRange();
+        m_rowOffsets.assign(rowCount + 1, 0);
+    }
+
+    template <typename T>
+    SparseMatrix<T>::SparseMatrix(const size_t rowCount, const size_t columnCount, std::vector<SparseIndex> rowOffsets,
+                                  std::vector<SparseIndex> columnIndices, std::vector<T> values)
+        : m_rowCount(rowCount), m_columnCount(columnCount), m_rowOffsets(std::move(rowOffsets)),
+          m_columnIndices(std::move(columnIndices)), m_values(std::move(values))
+    {
+        AssertIndexRange();
+        if (m_rowOffsets.size() != rowCount + 1 || m_rowOffsets[0] != 0 || m_rowOffsets[rowCount] != m_columnIndices.size() ||
+            m_columnIndices.size() != m_values.size())
+            throw std::invalid_argument("Inconsistent CSR arrays");
+
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            if (m_rowOffsets[i] > m_rowOffsets[i + 1])
+                throw std::invalid_argument("Row offsets should not decrease");
+            for (size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; k++)
+            {
+                if (m_columnIndices[k] >= columnCount)
+                    throw std::out_of_range("Column out of range");
+                if (k > m_rowOffsets[i] && m_columnIndices[k] <= m_columnIndices[k - 1])
+                    throw std::invalid_argument("Columns of a row should be strictly increasing");
+            }
+        }
+    }
+
+    template <typename T>
+    SparseMatrix<T>::SparseMatrix(const size_t rowCount, const size_t columnCount, const std::vector<SparseEntry<T>>& entries)
+        : SparseMatrix(rowCount, columnCount)
+    {
+        if (entries.size() > std::numeric_limits<SparseIndex>::max())
+            throw std::overflow_error("Sparse index overflow");
+
+        // Bucket the entries by row, then sort and merge the columns of every row
+        std::vector<SparseIndex> counts(rowCount + 1, 0);
+        for (const SparseEntry<T>& entry : entries)
+        {
+            if (entry.Row >= rowCount || entry.Column >= columnCount)
+                throw std::out_of_range("Entry out of range");
+            counts[entry.Row + 1]++;
+        }
+        for (size_t i = 0; i < rowCount; i++)
+            counts[i + 1] += counts[i];
+
+        std::vector<std::pair<SparseIndex, T>> bucketed(entries.size());
+        std::vector<SparseIndex> next(counts.begin(), counts.end() - 1);
+        for (const SparseEntry<T>& entry : entries)
+            bucketed[next[entry.Row]++] = {entry.Column, entry.Value};
+
+        m_columnIndices.reserve(entries.size());
+        m_values.reserve(entries.size());
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            const auto rowBegin = bucketed.begin() + counts[i];
+            const auto rowEnd = bucketed.begin() + counts[i + 1];
+            std::sort(rowBegin, rowEnd, [](const auto& lhs, const auto& rhs)
+                      { return lhs.first < rhs.first; });
+            for (auto it = rowBegin; it != rowEnd; ++it)
+            {
+                if (m_columnIndices.size() > m_rowOffsets[i] && m_columnIndices.back() == it->first)
+                {
+                    m_values.back() += it->second;
+                }
+                else
+                {
+                    m_columnIndices.push_back(it->first);
+                    m_values.push_back(it->second);
+                }
+            }
+            m_rowOffsets[i + 1] = static_cast<SparseIndex>(m_columnIndices.size());
+        }
+    }
+
+    template <typename T>
+    SparseMatrix<T>::SparseMatrix(const Matrix<T>& matrix)
+        : SparseMatrix(matrix.GetRowCount(), matrix.GetColumnCount())
+    {
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t j = 0; j < m_columnCount; j++)
+            {
+                if (matrix(i, j) != T(0))
+                {
+                    m_columnIndices.push_back(static_cast<SparseIndex>(j));
+                    m_values.push_back(matrix(i, j));
+                }
+            }
+            if (m_columnIndices.size() > std::numeric_limits<SparseIndex>::max())
+                throw std::overflow_error("Sparse index overflow");
+            m_rowOffsets[i + 1] = static_cast<SparseIndex>(m_columnIndices.size());
+        }
+    }
+
+    template <typename T>
+    T SparseMatrix<T>::operator()(const size_t row, const size_t column) const
+    {
+        const size_t index = FindIndex(row, column);
+        return index == m_values.size() ? T(0) : m_values[index];
+    }
+
+    template <typename T>
+    size_t SparseMatrix<T>::FindIndex(const size_t row, const size_t column) const
+    {
+        if (row >= m_rowCount)
+            throw std::out_of_range("Row out of range");
+        if (column >= m_columnCount)
+            throw std::out_of_range("Column out of range");
+
+        const SparseIndex* begin = m_columnIndices.data() + m_rowOffsets[row];
+        const SparseIndex* end = m_columnIndices.data() + m_rowOffsets[row + 1];
+        const SparseIndex* position = std::lower_bound(begin, end, static_cast<SparseIndex>(column));
+        return position != end && *position == column ? static_cast<size_t>(position - m_columnIndices.data()) : m_values.size();
+    }
+
+    template <typename T>
+    ColumnVector<T> SparseMatrix<T>::GetDiagonal() const
+    {
+        ColumnVector<T> diagonal(std::min(m_rowCount, m_columnCount));
+        for (size_t i = 0; i < diagonal.GetLength(); i++)
+        {
+            diagonal[i] = (*this)(i, i);
+        }
+        return diagonal;
+    }
+
+    template <typename T>
+    void SparseMatrix<T>::ScaleRows(const ColumnVector<T>& scales)
+    {
+        if (scales.GetLength() != m_rowCount)
+            throw std::invalid_argument("Dimensions mismatch");
+
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            const T scale = scales[i];
+            for (size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; k++)
+                m_values[k] *= scale;
+        }
+    }
+
+    template <typename T>
+    SparseMatrix<T>& SparseMatrix<T>::operator*=(const T& scalar)
+    {
+        for (T& value : m_values)
+            value *= scalar;
+        return *this;
+    }
+
+    template <typename T>
+    ColumnVector<T> SparseMatrix<T>::operator*(const ColumnVector<T>& vector) const
+    {
+        if (m_columnCount != vector.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+
+        ColumnVector<T> result(m_rowCount);
+        Blas::Spmv(m_rowCount, T(1), RowOffsets(), ColumnIndices(), Values(), vector.Data(), T(0), result.Data());
+        return result;
+    }
+
+    template <typename T>
+    SparseMatrix<T> SparseMatrix<T>::operator*(const SparseMatrix& other) const
+    {
+        if (m_columnCount != other.m_rowCount)
+            throw std::invalid_argument("Matrix Matrix mismatch");
+
+        constexpr size_t maxNonZeroCount = std::numeric_limits<SparseIndex>::max();
+        std::vector<SparseIndex> rowOffsets(m_rowCount + 1, 0);
+        std::vector<SparseIndex> columnIndices;
+        std::vector<T> values;
+        std::vector<char> inRow(other.m_columnCount, 0);
+        std::vector<T> accumulator(other.m_columnCount, T(0));
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            // Row i of the product is the linear combination of the rows of other selected by row i of this
+            const size_t rowBegin = columnIndices.size();
+            for (size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; k++)
+            {
+                const T value = m_values[k];
+                const size_t j = m_columnIndices[k];
+                for (size_t kk = other.m_rowOffsets[j]; kk < other.m_rowOffsets[j + 1]; kk++)
+                {
+                    const SparseIndex column = other.m_columnIndices[kk];
+                    if (!inRow[column])
+                    {
+                        // The offsets are SparseIndex, thus so is the number of nonzeros
+                        if (columnIndices.size() == maxNonZeroCount)
+                            throw std::overflow_error("Sparse index overflow");
+                        inRow[column] = 1;
+                        columnIndices.push_back(column);
+                    }
+                    accumulator[column] += value * other.m_values[kk];
+                }
+            }
+
+            std::sort(columnIndices.begin() + rowBegin, columnIndices.end());
+            for (size_t k = rowBegin; k < columnIndices.size(); k++)
+            {
+                const SparseIndex column = columnIndices[k];
+                values.push_back(accumulator[column]);
+                accumulator[column] = T(0);
+                inRow[column] = 0;
+            }
+            rowOffsets[i + 1] = static_cast<SparseIndex>(columnIndices.size());
+        }
+        return SparseMatrix(m_rowCount, other.m_columnCount, std::move(rowOffsets), std::move(columnIndices), std::move(values));
+    }
+
+    template <typename T>
+    SparseMatrix<T> SparseMatrix<T>::Transposed() const
+    {
+        // Counting sort of the entries by column, visiting the rows in order keeps the columns of the result sorted
+        std::vector<SparseIndex> rowOffsets(m_columnCount + 1, 0);
+        for (const SparseIndex column : m_columnIndices)
+            rowOffsets[column + 1]++;
+        for (size_t j = 0; j < m_columnCount; j++)
+            rowOffsets[j + 1] += rowOffsets[j];
+
+        std::vector<SparseIndex> next(rowOffsets.begin(), rowOffsets.end() - 1);
+        std::vector<SparseIndex> columnIndices(m_values.size());
+        std::vector<T> values(m_values.size());
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; k++)
+            {
+                const SparseIndex slot = next[m_columnIndices[k]]++;
+                columnIndices[slot] = static_cast<SparseIndex>(i);
+                values[slot] = m_values[k];
+            }
+        }
+        return SparseMatrix(m_columnCount, m_rowCount, std::move(rowOffsets), std::move(columnIndices), std::move(values));
+    }
+
+    template <typename T>
+    ColumnVector<T> SparseMatrix<T>::TransposedMultiply(const ColumnVector<T>& vector) const
+    {
+        if (m_rowCount != vector.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+
+        ColumnVector<T> result(m_columnCount);
+        Blas::SpmvTransposed(m_rowCount, m_columnCount, T(1), RowOffsets(), ColumnIndices(), Values(), vector.Data(), T(0), result.Data());
+        return result;
+    }
+
+    template <typename T>
+    Matrix<T> SparseMatrix<T>::ToMatrix() const
+    {
+        Matrix<T> matrix(m_rowCount, m_columnCount);
+        matrix.Fill(T(0));
+        for (size_t i = 0; i < m_rowCount; i++)
+        {
+            for (size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; k++)
+                matrix(i, m_columnIndices[k]) = m_values[k];
+        }
+        return matrix;
+    }
+
+    template <typename T>
+    void SparseMatrix<T>::AssertIndexRange() const
+    {
+        constexpr size_t maxDimension = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+        if (m_rowCount > maxDimension || m_columnCount > maxDimension)
+            throw std::overflow_error("Sparse index overflow");
+    }
+
+    /// <summary>
+    /// In-place sparse matrix-vector product y = alpha * A * x + beta * y, reusing the storage of y. y may not share storage with x.
+    /// </summary>
+    template <typename T>
+    void Spmv(const T& alpha, const SparseMatrix<T>& A, const ColumnVector<T>& x, const T& beta, ColumnVector<T>& y)
+    {
+        if (A.GetColumnCount() != x.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+        if (A.GetRowCount() != y.GetLength())
+            throw std::invalid_argument("Output vector dimensions mismatch");
+        if (y.Data() != nullptr && y.Data() == x.Data())
+            throw std::invalid_argument("Output vector may not alias the input vector");
+
+        Blas::Spmv(A.GetRowCount(), alpha, A.RowOffsets(), A.ColumnIndices(), A.Values(), x.Data(), beta, y.Data());
+    }
+
+    /// <summary>
+    /// In-place transposed product y = alpha * A^T * x + beta * y, reusing the storage of y. y may not share storage with x.
+    /// </summary>
+    template <typename T>
+    void SpmvTransposed(const T& alpha, const SparseMatrix<T>& A, const ColumnVector<T>& x, const T& beta, ColumnVector<T>& y)
+    {
+        if (A.GetRowCount() != x.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+        if (A.GetColumnCount() != y.GetLength())
+            throw std::invalid_argument("Output vector dimensions mismatch");
+        if (y.Data() != nullptr && y.Data() == x.Data())
+            throw std::invalid_argument("Output vector may not alias the input vector");
+
+        Blas::SpmvTransposed(A.GetRowCount(), A.GetColumnCount(), alpha, A.RowOffsets(), A.ColumnIndices(), A.Values(), x.Data(), beta, y.Data());
+    }
+
+    /// <summary>
+    /// Copy of the matrix with the same sparsity pattern and its values converted to TTarget.
+    /// </summary>
+    template <typename TTarget, typename TSource>
+    SparseMatrix<TTarget> ConvertSparseMatrix(const SparseMatrix<TSource>& matrix)
+    {
+        const size_t nonZeroCount = matrix.GetNonZeroCount();
+        std::vector<TTarget> values(nonZeroCount);
+        for (size_t k = 0; k < nonZeroCount; k++)
+        {
+            values[k] = static_cast<TTarget>(matrix.Values()[k]);
+        }
+        return SparseMatrix<TTarget>(matrix.GetRowCount(), matrix.GetColumnCount(),
+                                     std::vector<SparseIndex>(matrix.RowOffsets(), matrix.RowOffsets() + matrix.GetRowCount() + 1),
+                                     std::vector<SparseIndex>(matrix.ColumnIndices(), matrix.ColumnIndices() + nonZeroCount), std::move(values));
+    }
+}
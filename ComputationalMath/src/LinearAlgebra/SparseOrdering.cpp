@@ -0,0 +1,231 @@
+#include "SparseOrdering.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace LinearAlgebra::Ordering
+{
+    namespace
+    {
+        constexpr SparseIndex Unvisited = std::numeric_limits<SparseIndex>::max();
+
+        class Dissection
+        {
+        public:
+            Dissection(const size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices, const double* coordinates,
+                       const size_t leafSize)
+                : m_rowOffsets(rowOffsets), m_columnIndices(columnIndices), m_coordinates(coordinates), m_leafSize(std::max<size_t>(leafSize, 1)),
+                  m_owner(size, 0), m_side(size, 0), m_level(size, Unvisited)
+            {
+                m_permutation.reserve(size);
+            }
+
+            std::vector<SparseIndex> Order()
+            {
+                // Every connected component is dissected on its own, such that the splits of a component stay connected
+                const size_t size = m_owner.size();
+                std::vector<bool> visited(size, false);
+                std::vector<std::vector<SparseIndex>> components;
+                for (size_t root = 0; root < size; root++)
+                {
+                    if (visited[root])
+                        continue;
+
+                    std::vector<SparseIndex> component = {static_cast<SparseIndex>(root)};
+                    visited[root] = true;
+                    for (size_t head = 0; head < component.size(); head++)
+                    {
+                        const SparseIndex vertex = component[head];
+                        for (size_t k = m_rowOffsets[vertex]; k < m_rowOffsets[vertex + 1]; k++)
+                        {
+                            if (!visited[m_columnIndices[k]])
+                            {
+                                visited[m_columnIndices[k]] = true;
+                                component.push_back(m_columnIndices[k]);
+                            }
+                        }
+                    }
+                    components.push_back(std::move(component));
+                }
+
+                for (std::vector<SparseIndex>& component : components)
+                    Dissect(std::move(component));
+                return std::move(m_permutation);
+            }
+
+        private:
+            void Dissect(std::vector<SparseIndex> vertices)
+            {
+                // The first part is dissected recursively, the second part in this loop, such that the recursion depth
+                // stays logarithmic when the second part is the larger, e.g. the rest of a disconnected graph
+                std::vector<std::vector<SparseIndex>> separators;
+                while (true)
+                {
+                    std::vector<SparseIndex> first, second, separator;
+                    if (vertices.size() <= m_leafSize || !Split(vertices, first, second, separator))
+                    {
+                        m_permutation.insert(m_permutation.end(), vertices.begin(), vertices.end());
+                        break;
+                    }
+
+                    Dissect(std::move(first));
+                    separators.push_back(std::move(separator));
+                    vertices = std::move(second);
+                }
+
+                for (auto it = separators.rbegin(); it != separators.rend(); ++it)
+                    m_permutation.insert(m_permutation.end(), it->begin(), it->end());
+            }
+
+            bool Split(const std::vector<SparseIndex>& vertices, std::vector<SparseIndex>& first, std::vector<SparseIndex>& second,
+                       std::vector<SparseIndex>& separator)
+            {
+                // Neighbors outside of the subgraph are ordered already, or belong to another part
+                m_subgraph++;
+                for (const SparseIndex vertex : vertices)
+                    m_owner[vertex] = m_subgraph;
+
+                if (m_coordinates != nullptr)
+                    SplitByCoordinates(vertices, first, second, separator);
+                else
+                    SplitByLevels(vertices, first, second, separator);
+                return !first.empty() && !second.empty();
+            }
+
+            void SplitByCoordinates(const std::vector<SparseIndex>& vertices, std::vector<SparseIndex>& first, std::vector<SparseIndex>& second,
+                                    std::vector<SparseIndex>& separator)
+            {
+                double minimum[2] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+                double maximum[2] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+                for (const SparseIndex vertex : vertices)
+                {
+                    for (size_t axis = 0; axis < 2; axis++)
+                    {
+                        minimum[axis] = std::min(minimum[axis], m_coordinates[2 * vertex + axis]);
+                        maximum[axis] = std::max(maximum[axis], m_coordinates[2 * vertex + axis]);
+                    }
+                }
+                const size_t axis = maximum[0] - minimum[0] >= maximum[1] - minimum[1] ? 0 : 1;
+
+                std::vector<SparseIndex> sorted = vertices;
+                const auto median = sorted.begin() + sorted.size() / 2;
+                std::nth_element(sorted.begin(), median, sorted.end(), [this, axis](const SparseIndex a, const SparseIndex b)
+                                 { return m_coordinates[2 * a + axis] < m_coordinates[2 * b + axis]; });
+                for (auto it = sorted.begin(); it != sorted.end(); ++it)
+                    m_side[*it] = it < median ? 0 : 1;
+
+                // The vertices of the second half with a neighbor in the first half separate both
+                for (const SparseIndex vertex : vertices)
+                {
+                    if (m_side[vertex] == 0)
+                    {
+                        first.push_back(vertex);
+                        continue;
+                    }
+
+                    bool adjacent = false;
+                    for (size_t k = m_rowOffsets[vertex]; k < m_rowOffsets[vertex + 1] && !adjacent; k++)
+                    {
+                        const SparseIndex neighbor = m_columnIndices[k];
+                        adjacent = m_owner[neighbor] == m_subgraph && m_side[neighbor] == 0;
+                    }
+                    (adjacent ? separator : second).push_back(vertex);
+                }
+            }
+
+            /// <summary>
+            /// Breadth first search in the subgraph from root, returns the last vertex reached, which is one of the
+            /// farthest from root, and the number of levels. Vertices that are not reached keep level Unvisited.
+            /// </summary>
+            SparseIndex BreadthFirstSearch(const std::vector<SparseIndex>& vertices, const SparseIndex root, std::vector<SparseIndex>& queue,
+                                           SparseIndex& levelCount)
+            {
+                for (const SparseIndex vertex : vertices)
+                    m_level[vertex] = Unvisited;
+
+                queue.clear();
+                queue.push_back(root);
+                m_level[root] = 0;
+                for (size_t head = 0; head < queue.size(); head++)
+                {
+                    const SparseIndex vertex = queue[head];
+                    for (size_t k = m_rowOffsets[vertex]; k < m_rowOffsets[vertex + 1]; k++)
+                    {
+                        const SparseIndex neighbor = m_columnIndices[k];
+                        if (m_owner[neighbor] == m_subgraph && m_level[neighbor] == Unvisited)
+                        {
+                            m_level[neighbor] = m_level[vertex] + 1;
+                            queue.push_back(neighbor);
+                        }
+                    }
+                }
+                levelCount = m_level[queue.back()] + 1;
+                return queue.back();
+            }
+
+            void SplitByLevels(const std::vector<SparseIndex>& vertices, std::vector<SparseIndex>& first, std::vector<SparseIndex>& second,
+                               std::vector<SparseIndex>& separator)
+            {
+                // Two sweeps find a pseudo-peripheral vertex, of which the level sets are long and narrow
+                std::vector<SparseIndex> queue;
+                queue.reserve(vertices.size());
+                SparseIndex levelCount = 0;
+                const SparseIndex peripheral = BreadthFirstSearch(vertices, vertices[0], queue, levelCount);
+                BreadthFirstSearch(vertices, peripheral, queue, levelCount);
+
+                if (queue.size() < vertices.size())
+                {
+                    // Disconnected, the reached component and the rest are dissected independently
+                    for (const SparseIndex vertex : vertices)
+                        (m_level[vertex] != Unvisited ? first : second).push_back(vertex);
+                    return;
+                }
+                if (levelCount < 3)
+                    return;
+
+                // The level that halves the vertices, queue is sorted by level
+                const SparseIndex middle = m_level[queue[queue.size() / 2]];
+                const SparseIndex separatorLevel = std::clamp<SparseIndex>(middle, 1, levelCount - 2);
+                for (const SparseIndex vertex : queue)
+                {
+                    if (m_level[vertex] < separatorLevel)
+                        first.push_back(vertex);
+                    else if (m_level[vertex] > separatorLevel)
+                        second.push_back(vertex);
+                    else
+                        separator.push_back(vertex);
+                }
+            }
+
+        private:
+            const SparseIndex* m_rowOffsets;
+            const SparseIndex* m_columnIndices;
+            const double* m_coordinates;
+            size_t m_leafSize;
+            size_t m_subgraph = 0;
+            std::vector<size_t> m_owner;
+            std::vector<unsigned char> m_side;
+            std::vector<SparseIndex> m_level;
+            std::vector<SparseIndex> m_permutation;
+        };
+    }
+
+    std::vector<SparseIndex> NestedDissection(const size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                                              const double* coordinates, const size_t leafSize)
+    {
+        return Dissection(size, rowOffsets, columnIndices, coordinates, leafSize).Order();
+    }
+
+    std::vector<SparseIndex> InversePermutation(const std::vector<SparseIndex>& permutation)
+    {
+        std::vector<SparseIndex> inverse(permutation.size(), Unvisited);
+        for (size_t i = 0; i < permutation.size(); i++)
+        {
+            if (permutation[i] >= permutation.size() || inverse[permutation[i]] != Unvisited)
+                throw std::invalid_argument("Invalid permutation");
+            inverse[permutation[i]] = static_cast<SparseIndex>(i);
+        }
+        return inverse;
+    }
+}
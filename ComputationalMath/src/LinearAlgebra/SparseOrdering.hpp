@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "SparseMatrix.hpp"
+
+namespace LinearAlgebra::Ordering
+{
+    /// <summary>
+    /// Point with X and Y coordinates, such as Geometry::Vertex2F.
+    /// </summary>
+    template <typename P>
+    concept PlanarPoint = requires(const P& point) {
+        static_cast<double>(point.X);
+        static_cast<double>(point.Y);
+    };
+
+    /// <summary>
+    /// Nested dissection ordering of the graph of the symmetric pattern (rowOffsets, columnIndices) of size x size.
+    /// Every subgraph of more than leafSize vertices is split in two parts by a vertex separator, the parts are
+    /// ordered first, recursively, and the separator last. Eliminating in this order, the parts do not fill in each
+    /// other, which bounds the fill of the Cholesky factor of a 2D mesh by O(n log n), instead of the O(n^1.5) of a
+    /// banded ordering.
+    ///
+    /// With coordinates, size pairs (x, y), a subgraph is bisected at the median of its longest extent, and the
+    /// vertices of one half adjacent to the other form the separator. Without, the separator is the middle level set
+    /// of a breadth first search from a pseudo-peripheral vertex.
+    ///
+    /// Returns the permutation, permutation[i] is the original index of the i-th vertex in the ordering.
+    /// </summary>
+    std::vector<SparseIndex> NestedDissection(size_t size, const SparseIndex* rowOffsets, const SparseIndex* columnIndices,
+                                              const double* coordinates, size_t leafSize);
+
+    template <typename T>
+    std::vector<SparseIndex> NestedDissection(const SparseMatrix<T>& matrix, const size_t leafSize = 64)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+        return NestedDissection(matrix.GetRowCount(), matrix.RowOffsets(), matrix.ColumnIndices(), nullptr, leafSize);
+    }
+
+    /// <summary>
+    /// Nested dissection by coordinate bisection, with the coordinates of the unknowns, e.g. Mesh2D::Vertices for P1
+    /// elements.
+    /// </summary>
+    template <typename T, PlanarPoint P>
+    std::vector<SparseIndex> NestedDissection(const SparseMatrix<T>& matrix, const std::vector<P>& coordinates, const size_t leafSize = 64)
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+        if (coordinates.size() != matrix.GetRowCount())
+            throw std::invalid_argument("Matrix and coordinates dimensions mismatch");
+
+        std::vector<double> flat(2 * coordinates.size());
+        for (size_t i = 0; i < coordinates.size(); i++)
+        {
+            flat[2 * i] = static_cast<double>(coordinates[i].X);
+            flat[2 * i + 1] = static_cast<double>(coordinates[i].Y);
+        }
+        return NestedDissection(matrix.GetRowCount(), matrix.RowOffsets(), matrix.ColumnIndices(), flat.data(), leafSize);
+    }
+
+    /// <summary>
+    /// Inverse of a permutation, inverse[permutation[i]] = i. Throws when permutation is not a permutation.
+    /// </summary>
+    std::vector<SparseIndex> InversePermutation(const std::vector<SparseIndex>& permutation);
+}
@@ -0,0 +1,279 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "AlignedStorage.hpp"
+#include "Blas1.hpp"
+#include "Matrix.hpp"
+#include "VectorBase.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Symmetric square matrix that only stores its lower triangle, in about half the memory of a Matrix.
+    /// The lower triangle is split in tiles of TileSize x TileSize, tile (I, J) with I >= J is stored contiguously
+    /// and row-major, and the tiles are stored row by row. The tiles are dense, which lets the blocked factorizations
+    /// work on them with GEMM, and the last tile row and column are padded with zeros.
+    /// Element (i, j) and (j, i) are the same stored element. The strict upper triangle of the diagonal tiles is
+    /// not part of the matrix, and its contents are unspecified.
+    /// </summary>
+    template <typename T>
+    class SymmetricMatrix
+    {
+    public:
+        static constexpr size_t TileSize = 64;
+
+        SymmetricMatrix();
+
+        /// <summary>
+        /// Zero initialized symmetric matrix of size x size.
+        /// </summary>
+        explicit SymmetricMatrix(size_t size);
+
+        /// <summary>
+        /// Symmetric matrix with the lower triangle of the square matrix, the strict upper triangle is ignored.
+        /// </summary>
+        explicit SymmetricMatrix(const Matrix<T>& matrix);
+
+        SymmetricMatrix(const SymmetricMatrix& other);
+        SymmetricMatrix(SymmetricMatrix&& other) noexcept;
+        SymmetricMatrix& operator=(const SymmetricMatrix& other);
+        SymmetricMatrix& operator=(SymmetricMatrix&& other) noexcept;
+
+        size_t GetSize() const { return m_size; }
+        size_t GetTileCount() const { return m_tileCount; }
+
+        /// <summary>
+        /// Number of rows and columns of the matrix in tile row or column tile, TileSize except for the last tile.
+        /// </summary>
+        size_t GetTileLength(size_t tile) const { return std::min(TileSize, m_size - tile * TileSize); }
+
+        /// <summary>
+        /// Row-major storage of tile (tileRow, tileColumn), with tileRow >= tileColumn and leading dimension TileSize.
+        /// </summary>
+        T* Tile(size_t tileRow, size_t tileColumn) { return m_storage.get() + TileOffset(tileRow, tileColumn); }
+        const T* Tile(size_t tileRow, size_t tileColumn) const { return m_storage.get() + TileOffset(tileRow, tileColumn); }
+
+        T* Data() { return m_storage.get(); }
+        const T* Data() const { return m_storage.get(); }
+        size_t GetStorageLength() const { return m_tileCount * (m_tileCount + 1) / 2 * TileSize * TileSize; }
+
+        T& operator()(size_t row, size_t column);
+        const T& operator()(size_t row, size_t column) const;
+
+        void Fill(const T& value);
+
+        SymmetricMatrix& operator+=(const SymmetricMatrix& other);
+        SymmetricMatrix& operator*=(const T& scalar);
+
+        ColumnVector<T> operator*(const ColumnVector<T>& vector) const;
+
+        Matrix<T> ToMatrix() const;
+
+    private:
+        size_t TileOffset(size_t tileRow, size_t tileColumn) const { return (tileRow * (tileRow + 1) / 2 + tileColumn) * TileSize * TileSize; }
+
+    private:
+        size_t m_size;
+        size_t m_tileCount;
+        std::shared_ptr<T[]> m_storage;
+    };
+
+    template <typename T>
+    SymmetricMatrix<T>::SymmetricMatrix()
+        : m_size(0), m_tileCount(0)
+    {
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>::SymmetricMatrix(const size_t size)
+        : m_size(size), m_tileCount((size + TileSize - 1) / TileSize)
+    {
+        // Conservative check of tileCount * (tileCount + 1) / 2 tiles of TileSize x TileSize elements
+        constexpr size_t maximumTiles = std::numeric_limits<size_t>::max() / (TileSize * TileSize);
+        if (m_tileCount != 0 && (m_tileCount + 2) / 2 > maximumTiles / m_tileCount)
+            throw std::overflow_error("NxN count size overflow");
+
+        m_storage = AllocateStorage<T>(GetStorageLength());
+        Fill(T(0));
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>::SymmetricMatrix(const Matrix<T>& matrix)
+        : SymmetricMatrix(matrix.GetRowCount())
+    {
+        if (matrix.GetRowCount() != matrix.GetColumnCount())
+            throw std::invalid_argument("Non-square matrix");
+
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                (*this)(i, j) = matrix(i, j);
+            }
+        }
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>::SymmetricMatrix(const SymmetricMatrix& other)
+        : m_size(other.m_size), m_tileCount(other.m_tileCount), m_storage(AllocateStorage<T>(other.GetStorageLength()))
+    {
+        std::copy(other.Data(), other.Data() + GetStorageLength(), Data());
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>::SymmetricMatrix(SymmetricMatrix&& other) noexcept
+        : m_size(other.m_size), m_tileCount(other.m_tileCount), m_storage(std::move(other.m_storage))
+    {
+        other.m_size = 0;
+        other.m_tileCount = 0;
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>& SymmetricMatrix<T>::operator=(const SymmetricMatrix& other)
+    {
+        if (this == &other)
+            return *this;
+
+        if (m_size != other.m_size)
+        {
+            m_size = other.m_size;
+            m_tileCount = other.m_tileCount;
+            m_storage = AllocateStorage<T>(GetStorageLength());
+        }
+        std::copy(other.Data(), other.Data() + GetStorageLength(), Data());
+        return *this;
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>& SymmetricMatrix<T>::operator=(SymmetricMatrix&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        m_size = other.m_size;
+        m_tileCount = other.m_tileCount;
+        m_storage = std::move(other.m_storage);
+        other.m_size = 0;
+        other.m_tileCount = 0;
+        return *this;
+    }
+
+    template <typename T>
+    T& SymmetricMatrix<T>::operator()(size_t row, size_t column)
+    {
+        if (row < column)
+            std::swap(row, column);
+        return Tile(row / TileSize, column / TileSize)[(row % TileSize) * TileSize + column % TileSize];
+    }
+
+    template <typename T>
+    const T& SymmetricMatrix<T>::operator()(size_t row, size_t column) const
+    {
+        if (row < column)
+            std::swap(row, column);
+        return Tile(row / TileSize, column / TileSize)[(row % TileSize) * TileSize + column % TileSize];
+    }
+
+    template <typename T>
+    void SymmetricMatrix<T>::Fill(const T& value)
+    {
+        for (size_t tileRow = 0; tileRow < m_tileCount; tileRow++)
+        {
+            for (size_t tileColumn = 0; tileColumn <= tileRow; tileColumn++)
+            {
+                // Padding of the last tiles stays zero
+                T* tile = Tile(tileRow, tileColumn);
+                std::fill(tile, tile + TileSize * TileSize, T(0));
+                for (size_t i = 0; i < GetTileLength(tileRow); i++)
+                {
+                    std::fill(tile + i * TileSize, tile + i * TileSize + GetTileLength(tileColumn), value);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>& SymmetricMatrix<T>::operator+=(const SymmetricMatrix& other)
+    {
+        if (m_size != other.m_size)
+            throw std::invalid_argument("Dimensions mismatch");
+
+        Blas::Axpy(GetStorageLength(), T(1), other.Data(), Data());
+        return *this;
+    }
+
+    template <typename T>
+    SymmetricMatrix<T>& SymmetricMatrix<T>::operator*=(const T& scalar)
+    {
+        Blas::Scal(GetStorageLength(), scalar, Data());
+        return *this;
+    }
+
+    template <typename T>
+    ColumnVector<T> SymmetricMatrix<T>::operator*(const ColumnVector<T>& vector) const
+    {
+        if (m_size != vector.GetLength())
+            throw std::invalid_argument("Matrix Column multiplication mismatch");
+
+        ColumnVector<T> result(m_size);
+        result.Fill(T(0));
+        const T* x = vector.Data();
+        T* y = result.Data();
+
+        for (size_t tileRow = 0; tileRow < m_tileCount; tileRow++)
+        {
+            const size_t rowBegin = tileRow * TileSize;
+            const size_t rowCount = GetTileLength(tileRow);
+            for (size_t tileColumn = 0; tileColumn < tileRow; tileColumn++)
+            {
+                // The tile contributes to both y_I += A_IJ x_J and, as its transpose, to y_J += A_IJ^T x_I
+                const size_t columnBegin = tileColumn * TileSize;
+                const T* tile = Tile(tileRow, tileColumn);
+                for (size_t i = 0; i < rowCount; i++)
+                {
+                    y[rowBegin + i] += Blas::Dot(TileSize, tile + i * TileSize, x + columnBegin);
+                    Blas::Axpy(TileSize, x[rowBegin + i], tile + i * TileSize, y + columnBegin);
+                }
+            }
+
+            const T* diagonal = Tile(tileRow, tileRow);
+            for (size_t i = 0; i < rowCount; i++)
+            {
+                y[rowBegin + i] += Blas::Dot(i + 1, diagonal + i * TileSize, x + rowBegin);
+                Blas::Axpy(i, x[rowBegin + i], diagonal + i * TileSize, y + rowBegin);
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+    Matrix<T> SymmetricMatrix<T>::ToMatrix() const
+    {
+        Matrix<T> result(m_size, m_size);
+        for (size_t i = 0; i < m_size; i++)
+        {
+            for (size_t j = 0; j < m_size; j++)
+            {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+    SymmetricMatrix<T> operator+(SymmetricMatrix<T> lhs, const SymmetricMatrix<T>& rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template <typename T>
+    SymmetricMatrix<T> operator*(SymmetricMatrix<T> matrix, const T& scalar)
+    {
+        matrix *= scalar;
+        return matrix;
+    }
+}
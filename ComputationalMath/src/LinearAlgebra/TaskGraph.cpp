@@ -0,0 +1,198 @@
+#include "TaskGraph.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace LinearAlgebra
+{
+    TaskGraph::TaskId TaskGraph::AddTask(std::string name, std::function<void()> work, const std::vector<TaskId>& dependencies)
+    {
+        const TaskId id = m_tasks.size();
+        for (const TaskId dependency : dependencies)
+        {
+            if (dependency >= id)
+                throw std::invalid_argument("Dependency should be added before the task");
+        }
+
+        Task task{std::move(name), std::move(work), dependencies, {}};
+        std::sort(task.Dependencies.begin(), task.Dependencies.end());
+        task.Dependencies.erase(std::unique(task.Dependencies.begin(), task.Dependencies.end()), task.Dependencies.end());
+        for (const TaskId dependency : task.Dependencies)
+        {
+            m_tasks[dependency].Successors.push_back(id);
+        }
+
+        m_tasks.push_back(std::move(task));
+        return id;
+    }
+
+    size_t TaskGraph::GetTaskCount() const
+    {
+        return m_tasks.size();
+    }
+
+    const TaskGraphProfile& TaskGraph::GetProfile() const
+    {
+        return m_profile;
+    }
+
+    void TaskGraph::Execute(ThreadPool& pool)
+    {
+        using Clock = std::chrono::steady_clock;
+        const size_t taskCount = m_tasks.size();
+
+        // Tasks are added in topological order, thus the longest chain of successors is found in one backward sweep
+        std::vector<size_t> chainLength(taskCount, 1);
+        for (size_t i = taskCount; i-- > 0;)
+        {
+            for (const TaskId successor : m_tasks[i].Successors)
+            {
+                chainLength[i] = std::max(chainLength[i], chainLength[successor] + 1);
+            }
+        }
+
+        const auto lowerPriority = [&chainLength](const TaskId left, const TaskId right)
+        {
+            return chainLength[left] != chainLength[right] ? chainLength[left] < chainLength[right] : left > right;
+        };
+        std::priority_queue<TaskId, std::vector<TaskId>, decltype(lowerPriority)> ready(lowerPriority);
+
+        std::vector<size_t> remainingDependencies(taskCount);
+        for (size_t i = 0; i < taskCount; i++)
+        {
+            remainingDependencies[i] = m_tasks[i].Dependencies.size();
+            if (remainingDependencies[i] == 0)
+                ready.push(i);
+        }
+
+        m_profile = TaskGraphProfile();
+        m_profile.Tasks.resize(taskCount);
+        for (size_t i = 0; i < taskCount; i++)
+        {
+            m_profile.Tasks[i].Name = m_tasks[i].Name;
+        }
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        size_t finishedCount = 0;
+        std::exception_ptr exception;
+
+        const Clock::time_point start = Clock::now();
+        const auto secondsSinceStart = [start]()
+        {
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        };
+
+        pool.ParallelFor(pool.GetThreadCount(), [&](const size_t thread)
+                         {
+                             std::unique_lock<std::mutex> lock(mutex);
+                             while (true)
+                             {
+                                 changed.wait(lock, [&]()
+                                              { return !ready.empty() || finishedCount == taskCount || exception; });
+                                 if (finishedCount == taskCount || exception)
+                                     return;
+
+                                 const TaskId id = ready.top();
+                                 ready.pop();
+                                 TaskTiming& timing = m_profile.Tasks[id];
+                                 timing.Thread = thread;
+                                 timing.StartSeconds = secondsSinceStart();
+                                 lock.unlock();
+
+                                 std::exception_ptr taskException;
+                                 try
+                                 {
+                                     m_tasks[id].Work();
+                                 }
+                                 catch (...)
+                                 {
+                                     taskException = std::current_exception();
+                                 }
+
+                                 const double end = secondsSinceStart();
+                                 lock.lock();
+                                 timing.EndSeconds = end;
+                                 finishedCount++;
+                                 if (taskException && !exception)
+                                     exception = taskException;
+
+                                 for (const TaskId successor : m_tasks[id].Successors)
+                                 {
+                                     if (--remainingDependencies[successor] == 0)
+                                     {
+                                         m_profile.Tasks[successor].ReadySeconds = end;
+                                         ready.push(successor);
+                                     }
+                                 }
+                                 changed.notify_all();
+                             } });
+
+        if (exception)
+            std::rethrow_exception(exception);
+
+        BuildProfile(secondsSinceStart());
+    }
+
+    void TaskGraph::BuildProfile(const double wallSeconds)
+    {
+        const size_t taskCount = m_tasks.size();
+        m_profile.WallSeconds = wallSeconds;
+        if (taskCount == 0)
+            return;
+
+        // The observed critical path ends at the task that finished last, and goes back through the dependency
+        // that finished last, which is the one that made the task ready
+        size_t task = 0;
+        for (size_t i = 0; i < taskCount; i++)
+        {
+            const TaskTiming& timing = m_profile.Tasks[i];
+            m_profile.BusySeconds += timing.EndSeconds - timing.StartSeconds;
+            if (timing.EndSeconds > m_profile.Tasks[task].EndSeconds)
+                task = i;
+        }
+
+        while (true)
+        {
+            const TaskTiming& timing = m_profile.Tasks[task];
+            m_profile.CriticalPath.push_back(task);
+            m_profile.CriticalPathSeconds += timing.EndSeconds - timing.StartSeconds;
+            m_profile.CriticalPathWaitSeconds += timing.StartSeconds - timing.ReadySeconds;
+
+            const std::vector<TaskId>& dependencies = m_tasks[task].Dependencies;
+            if (dependencies.empty())
+                break;
+            task = *std::max_element(dependencies.begin(), dependencies.end(), [this](const TaskId left, const TaskId right)
+                                     { return m_profile.Tasks[left].EndSeconds < m_profile.Tasks[right].EndSeconds; });
+        }
+        std::reverse(m_profile.CriticalPath.begin(), m_profile.CriticalPath.end());
+    }
+
+    std::ostream& operator<<(std::ostream& os, const TaskGraphProfile& profile)
+    {
+        os << "Wall " << profile.WallSeconds << " s, busy " << profile.BusySeconds << " s, critical path "
+           << profile.CriticalPathSeconds << " s running and " << profile.CriticalPathWaitSeconds << " s waiting" << std::endl;
+        os << "Critical path:";
+        for (const size_t task : profile.CriticalPath)
+        {
+            os << " " << profile.Tasks[task].Name;
+        }
+        os << std::endl;
+
+        for (const TaskTiming& timing : profile.Tasks)
+        {
+            os << std::setw(24) << std::left << timing.Name << std::right
+               << " thread " << std::setw(3) << timing.Thread
+               << " ready " << std::setw(12) << timing.ReadySeconds
+               << " start " << std::setw(12) << timing.StartSeconds
+               << " end " << std::setw(12) << timing.EndSeconds << std::endl;
+        }
+        return os;
+    }
+}
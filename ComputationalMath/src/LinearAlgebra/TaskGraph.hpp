@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Measured timing of one task of a TaskGraph, in seconds since the start of TaskGraph::Execute. A task is ready
+    /// when its last dependency finished, the time between ready and start is spent waiting for a free thread.
+    /// Thread identifies the scheduling thread, in [0, thread count of the pool).
+    /// </summary>
+    struct TaskTiming
+    {
+        std::string Name;
+        size_t Thread;
+        double ReadySeconds;
+        double StartSeconds;
+        double EndSeconds;
+    };
+
+    /// <summary>
+    /// Profile of the last TaskGraph::Execute. The critical path is the chain of tasks that ended at the last finished
+    /// task, where every task was made ready by its predecessor in the chain. CriticalPathSeconds is the time the
+    /// chain was running and CriticalPathWaitSeconds the time its tasks waited for a thread, which add up to about
+    /// WallSeconds. A large wait means the critical path stalled behind other tasks, a large running time that the
+    /// graph lacks parallelism; BusySeconds / (thread count * WallSeconds) is the utilization of the pool.
+    /// </summary>
+    struct TaskGraphProfile
+    {
+        std::vector<TaskTiming> Tasks;
+        std::vector<size_t> CriticalPath;
+        double WallSeconds = 0;
+        double BusySeconds = 0;
+        double CriticalPathSeconds = 0;
+        double CriticalPathWaitSeconds = 0;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const TaskGraphProfile& profile);
+
+    /// <summary>
+    /// Directed acyclic graph of tasks, executed by the threads of a ThreadPool. A task starts once all of its
+    /// dependencies finished. Of the ready tasks, the one with the longest chain of successors runs first, such
+    /// that the critical path is not held up by work that can wait.
+    /// </summary>
+    class TaskGraph
+    {
+    public:
+        using TaskId = size_t;
+
+        /// <summary>
+        /// Adds a task that runs after all dependencies, which should be tasks added before.
+        /// </summary>
+        TaskId AddTask(std::string name, std::function<void()> work, const std::vector<TaskId>& dependencies = {});
+
+        size_t GetTaskCount() const;
+
+        /// <summary>
+        /// Runs all tasks on the threads of pool, including the calling thread, and blocks until all finished.
+        /// When a task throws, no further tasks are started and the first exception is rethrown.
+        /// </summary>
+        void Execute(ThreadPool& pool);
+
+        /// <summary>
+        /// Timings of the last Execute.
+        /// </summary>
+        const TaskGraphProfile& GetProfile() const;
+
+    private:
+        struct Task
+        {
+            std::string Name;
+            std::function<void()> Work;
+            std::vector<TaskId> Dependencies;
+            std::vector<TaskId> Successors;
+        };
+
+        void BuildProfile(double wallSeconds);
+
+    private:
+        std::vector<Task> m_tasks;
+        TaskGraphProfile m_profile;
+    };
+}
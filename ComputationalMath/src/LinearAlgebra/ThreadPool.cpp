@@ -0,0 +1,179 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace LinearAlgebra
+{
+    ThreadPool::ThreadPool(const size_t threadCount)
+        : m_stopping(false)
+    {
+        const size_t workerCount = threadCount > 1 ? threadCount - 1 : 0;
+        m_workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++)
+        {
+            m_workers.emplace_back([this]()
+                                   { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::GetThreadCount() const
+    {
+        return m_workers.size() + 1;
+    }
+
+    void ThreadPool::Submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]()
+                                 { return m_stopping || !m_tasks.empty(); });
+                if (m_stopping && m_tasks.empty())
+                    return;
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+    namespace
+    {
+        struct ParallelForState
+        {
+            explicit ParallelForState(const size_t count, const std::function<void(size_t)>& body)
+                : Count(count), Body(body), Next(0), Finished(0) {}
+
+            const size_t Count;
+            const std::function<void(size_t)>& Body;
+            std::atomic<size_t> Next;
+            std::atomic<size_t> Finished;
+
+            std::mutex Mutex;
+            std::condition_variable Done;
+            std::exception_ptr Exception;
+
+            // Grabs iterations until none are left. Helpers that start after all iterations are
+            // taken return immediately, so the caller never waits on a queued helper.
+            void Run()
+            {
+                size_t index;
+                while ((index = Next.fetch_add(1)) < Count)
+                {
+                    try
+                    {
+                        Body(index);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(Mutex);
+                        if (!Exception)
+                            Exception = std::current_exception();
+                    }
+
+                    if (Finished.fetch_add(1) + 1 == Count)
+                    {
+                        std::lock_guard<std::mutex> lock(Mutex);
+                        Done.notify_all();
+                    }
+                }
+            }
+        };
+    }
+
+    void ThreadPool::ParallelFor(const size_t count, const std::function<void(size_t)>& body)
+    {
+        if (count == 0)
+            return;
+
+        if (count == 1 || m_workers.empty())
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                body(i);
+            }
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>(count, body);
+        const size_t helperCount = std::min(m_workers.size(), count - 1);
+        for (size_t i = 0; i < helperCount; i++)
+        {
+            Submit([state]()
+                   { state->Run(); });
+        }
+        state->Run();
+
+        std::unique_lock<std::mutex> lock(state->Mutex);
+        state->Done.wait(lock, [&state]()
+                         { return state->Finished.load() == state->Count; });
+        if (state->Exception)
+            std::rethrow_exception(state->Exception);
+    }
+
+    namespace Parallel
+    {
+        namespace
+        {
+            std::mutex globalPoolMutex;
+            std::unique_ptr<ThreadPool> globalPool;
+
+            size_t DefaultThreadCount()
+            {
+                const size_t hardwareThreads = std::thread::hardware_concurrency();
+                return hardwareThreads == 0 ? 1 : hardwareThreads;
+            }
+        }
+
+        void SetThreadCount(const size_t threadCount)
+        {
+            std::lock_guard<std::mutex> lock(globalPoolMutex);
+            globalPool = std::make_unique<ThreadPool>(threadCount == 0 ? DefaultThreadCount() : threadCount);
+        }
+
+        size_t GetThreadCount()
+        {
+            return GlobalThreadPool().GetThreadCount();
+        }
+
+        ThreadPool& GlobalThreadPool()
+        {
+            std::lock_guard<std::mutex> lock(globalPoolMutex);
+            if (!globalPool)
+                globalPool = std::make_unique<ThreadPool>(DefaultThreadCount());
+            return *globalPool;
+        }
+
+        void ParallelFor(const size_t count, const std::function<void(size_t)>& body)
+        {
+            GlobalThreadPool().ParallelFor(count, body);
+        }
+    }
+}
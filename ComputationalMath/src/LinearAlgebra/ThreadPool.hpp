@@ -0,0 +1,59 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace LinearAlgebra
+{
+    /// <summary>
+    /// Fixed size pool of worker threads. A pool with a thread count of n owns n - 1 workers,
+    /// the calling thread is the n-th thread and participates in ParallelFor.
+    /// </summary>
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(size_t threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t GetThreadCount() const;
+
+        void Submit(std::function<void()> task);
+
+        /// <summary>
+        /// Calls body(i) for all i in [0, count), distributed over the pool. Blocks until all iterations finished,
+        /// and rethrows the first exception thrown by an iteration. Safe to call from within a pool thread.
+        /// </summary>
+        void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    private:
+        void WorkerLoop();
+
+    private:
+        std::vector<std::thread> m_workers;
+        std::queue<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping;
+    };
+
+    namespace Parallel
+    {
+        /// <summary>
+        /// Number of threads used by the parallel kernels. Defaults to the hardware concurrency, a thread count of 0 restores the default.
+        /// Changing the thread count recreates the global pool and may not happen while kernels are running.
+        /// </summary>
+        void SetThreadCount(size_t threadCount);
+        size_t GetThreadCount();
+
+        ThreadPool& GlobalThreadPool();
+
+        void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+    }
+}
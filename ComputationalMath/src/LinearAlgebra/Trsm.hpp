@@ -0,0 +1,138 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+#include "Blas1.hpp"
+#include "Gemm.hpp"
+#include "ThreadPool.hpp"
+
+namespace LinearAlgebra::Blas
+{
+    enum class Triangle
+    {
+        Lower,
+        Upper
+    };
+
+    enum class Diagonal
+    {
+        NonUnit,
+        Unit
+    };
+
+    /// <summary>
+    /// Blocking parameters of the triangular solve. A RowBlock x RowBlock diagonal block of the factor is solved
+    /// row by row, the rows below are updated with one GEMM per block. The right-hand side is split in column
+    /// blocks of ColumnBlock, such that the rows of a block stay in cache while the factor is streamed once.
+    /// </summary>
+    template <typename T>
+    struct TrsmBlocking
+    {
+        static constexpr size_t RowBlock = 64;
+        static constexpr size_t ColumnBlock = 256;
+    };
+
+    /// <summary>
+    /// Unblocked solve of the rows [begin, end) of X, where the contributions of all other solved rows are already
+    /// subtracted. Every row operation is an AXPY along the contiguous rows of X.
+    /// </summary>
+    template <typename T>
+    void TrsmDiagonalBlock(const Triangle triangle, const Diagonal diagonal, const size_t begin, const size_t end,
+                           const size_t columnCount, const T* A, const size_t lda, T* X, const size_t ldx)
+    {
+        const size_t length = end - begin;
+        for (size_t step = 0; step < length; step++)
+        {
+            const size_t i = triangle == Triangle::Lower ? begin + step : end - step - 1;
+            T* row = X + i * ldx;
+            const size_t solvedBegin = triangle == Triangle::Lower ? begin : i + 1;
+            const size_t solvedEnd = triangle == Triangle::Lower ? i : end;
+            for (size_t k = solvedBegin; k < solvedEnd; k++)
+            {
+                Axpy(columnCount, -A[i * lda + k], X + k * ldx, row);
+            }
+            if (diagonal == Diagonal::NonUnit)
+                Scal(columnCount, T(1) / A[i * lda + i], row);
+        }
+    }
+
+    /// <summary>
+    /// Serial blocked solve of op(A) X = B in place of B, for the triangle of the n x n row-major A and the
+    /// n x columnCount row-major B. Lower solves go forward and upper solves backward over row blocks, every row
+    /// block is first updated with the solved rows by a packed GEMM and then solved by TrsmDiagonalBlock.
+    /// </summary>
+    template <typename T>
+    void BlockedTrsm(const Triangle triangle, const Diagonal diagonal, const size_t n, const size_t columnCount,
+                     const T* A, const size_t lda, T* B, const size_t ldb)
+    {
+        using Blocking = TrsmBlocking<T>;
+        for (size_t jc = 0; jc < columnCount; jc += Blocking::ColumnBlock)
+        {
+            const size_t nc = std::min(Blocking::ColumnBlock, columnCount - jc);
+            T* X = B + jc;
+            const size_t blockCount = (n + Blocking::RowBlock - 1) / Blocking::RowBlock;
+            for (size_t step = 0; step < blockCount; step++)
+            {
+                const size_t block = triangle == Triangle::Lower ? step : blockCount - step - 1;
+                const size_t begin = block * Blocking::RowBlock;
+                const size_t end = std::min(n, begin + Blocking::RowBlock);
+
+                // X_block -= A_block,solved X_solved, with the solved rows before (lower) or after (upper) the block
+                if (triangle == Triangle::Lower)
+                    SerialGemm(end - begin, nc, begin, T(-1), A + begin * lda, lda, X, ldb, X + begin * ldb, ldb);
+                else
+                    SerialGemm(end - begin, nc, n - end, T(-1), A + begin * lda + end, lda, X + end * ldb, ldb, X + begin * ldb, ldb);
+
+                TrsmDiagonalBlock(triangle, diagonal, begin, end, nc, A, lda, X, ldb);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Distributes the columns of B over the pool, in blocks of whole ColumnBlock multiples, every column block is
+    /// an independent system solved by BlockedTrsm on one thread.
+    /// </summary>
+    template <typename T>
+    void ParallelTrsm(const Triangle triangle, const Diagonal diagonal, const size_t n, const size_t columnCount,
+                      const T* A, const size_t lda, T* B, const size_t ldb, ThreadPool& pool)
+    {
+        using Blocking = TrsmBlocking<T>;
+
+        // Narrow right-hand sides are split below ColumnBlock, as long as the blocks stay a multiple of the GEMM width
+        constexpr size_t minimalColumns = GemmBlocking<T>::NR;
+        const size_t threadCount = pool.GetThreadCount();
+        const size_t blockColumns = std::min(Blocking::ColumnBlock,
+                                             std::max(minimalColumns, ((columnCount + threadCount - 1) / threadCount + minimalColumns - 1) / minimalColumns * minimalColumns));
+        const size_t blockCount = (columnCount + blockColumns - 1) / blockColumns;
+
+        pool.ParallelFor(blockCount, [&](const size_t block)
+                         {
+                             const size_t column = block * blockColumns;
+                             BlockedTrsm(triangle, diagonal, n, std::min(blockColumns, columnCount - column), A, lda, B + column, ldb); });
+    }
+
+    /// <summary>
+    /// Triangular solve with multiple right-hand sides, op(A) X = B, where op(A) is the lower or upper triangle of the
+    /// row-major n x n A, optionally with a unit diagonal. B is n x columnCount and overwritten by X.
+    /// Large solves are distributed over Parallel::GlobalThreadPool() in blocks of right-hand side columns.
+    /// </summary>
+    template <typename T>
+    void Trsm(const Triangle triangle, const Diagonal diagonal, const size_t n, const size_t columnCount,
+              const T* A, const size_t lda, T* B, const size_t ldb)
+    {
+        if (n == 0 || columnCount == 0)
+            return;
+
+        if (n * n * columnCount >= ParallelGemmThreshold)
+        {
+            ThreadPool& pool = Parallel::GlobalThreadPool();
+            if (pool.GetThreadCount() > 1 && columnCount > GemmBlocking<T>::NR)
+            {
+                ParallelTrsm(triangle, diagonal, n, columnCount, A, lda, B, ldb, pool);
+                return;
+            }
+        }
+
+        BlockedTrsm(triangle, diagonal, n, columnCount, A, lda, B, ldb);
+    }
+}
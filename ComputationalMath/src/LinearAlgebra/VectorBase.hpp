@@ -9,6 +9,11 @@
 
 #include <iostream>
 
+#include "AlignedStorage.hpp"
+#include "Blas1.hpp"
+#include "Expression.hpp"
+#include "VectorView.hpp"
+
 namespace LinearAlgebra
 {
     template <typename T>
@@ -26,15 +31,35 @@ namespace LinearAlgebra
         using VectorBase<T>::VectorBase;
 
     public:
+        using ValueType = T;
+        using ResultType = ColumnVector<T>;
+
+        ColumnVector() = default;
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, ColumnVector<T>>
+        ColumnVector(const E& expression);
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, ColumnVector<T>>
+        ColumnVector& operator=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, ColumnVector<T>>
+        ColumnVector& operator+=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, ColumnVector<T>>
+        ColumnVector& operator-=(const E& expression);
+
+        ColumnVector& operator*=(const T& scalar);
+
         bool ElementwiseEquals(const ColumnVector& vector) const;
         bool ElementwiseCompare(const ColumnVector& vector, float epsilon) const;
-        ColumnVector operator+(const ColumnVector& vector) const;
-        ColumnVector operator-(const ColumnVector& vector) const;
-        ColumnVector operator*(const T& scalar) const;
-        friend ColumnVector<T> operator*(const T& scalar, const ColumnVector& vector) { return vector * scalar; }
         // Matrix<T> operator*(const RowVector<T>& vector) const;
 
-        RowVector<T> Transposed() const;
+        VectorView<T, RowVector<T>> Transposed();
+        VectorView<const T, RowVector<T>> Transposed() const;
     };
 
     template <typename T>
@@ -43,16 +68,46 @@ namespace LinearAlgebra
         using VectorBase<T>::VectorBase;
 
     public:
+        using ValueType = T;
+        using ResultType = RowVector<T>;
+
+        RowVector() = default;
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, RowVector<T>>
+        RowVector(const E& expression);
+
+        template <LinearExpressionNode E>
+            requires std::same_as<typename E::ResultType, RowVector<T>>
+        RowVector& operator=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, RowVector<T>>
+        RowVector& operator+=(const E& expression);
+
+        template <LinearExpression E>
+            requires std::same_as<typename E::ResultType, RowVector<T>>
+        RowVector& operator-=(const E& expression);
+
+        RowVector& operator*=(const T& scalar);
+
         bool ElementwiseEquals(const RowVector& vector) const;
         bool ElementwiseCompare(const RowVector& vector, float epsilon) const;
 
-        RowVector operator+(const RowVector& vector) const;
-        RowVector operator-(const RowVector& vector) const;
-        RowVector operator*(const T& scalar) const;
-        friend RowVector operator*(const T& scalar, const RowVector& vector) { return vector * scalar; };
-        T operator*(const ColumnVector<T>& vector) const;
+        VectorView<T, ColumnVector<T>> Transposed();
+        VectorView<const T, ColumnVector<T>> Transposed() const;
+    };
 
-        ColumnVector<T> Transposed() const;
+    template <typename T>
+    struct ExpressionOperand<ColumnVector<T>>
+    {
+        using Type = DenseVectorTerminal<T, ColumnVector<T>>;
+    };
+
+    template <typename T>
+    struct ExpressionOperand<RowVector<T>>
+    {
+        using Type = DenseVectorTerminal<T, RowVector<T>>;
     };
 
     template <typename T>
@@ -73,10 +128,29 @@ namespace LinearAlgebra
         explicit VectorBase(const std::vector<T>& data);
         VectorBase(const std::initializer_list<T>& values);
 
+        /// <summary>
+        /// Adopts storage of at least PaddedLength<T>(length) elements, aligned as in StorageTraits<T>, without
+        /// copying. The storage is shared until the vector is reassigned to a different length.
+        /// </summary>
+        VectorBase(size_t length, std::shared_ptr<T[]> storage);
+
+        VectorBase(const VectorBase& other);
+        VectorBase(VectorBase&& other) noexcept;
+        VectorBase& operator=(const VectorBase& other);
+        VectorBase& operator=(VectorBase&& other) noexcept;
+
         T* Data();
         const T* Data() const;
         void Fill(const T& value);
 
+        /// <summary>
+        /// In-place BLAS-1 operations, these do not allocate. Axpy computes this = alpha * x + this.
+        /// </summary>
+        void Axpy(const T& alpha, const VectorBase& x);
+        void Scale(const T& alpha);
+        T Dot(const VectorBase& other) const;
+        T Norm2() const;
+
         friend class VectorIterator<T>;
 
         VectorIterator<T> begin() { return VectorIterator(*this, 0); }
@@ -90,9 +164,6 @@ namespace LinearAlgebra
         ThrowIfOutOfRange(size_t index) const;
         void ThrowIfDimensionsMismatch(size_t otherLength) const;
 
-        void ElementwiseSumVector(const VectorBase& other, VectorBase& result) const;
-        void ElementwiseSubtractVector(const VectorBase& other, VectorBase& result) const;
-
     protected:
         std::shared_ptr<T[]> m_data;
         size_t m_length;
@@ -102,20 +173,20 @@ namespace LinearAlgebra
     class VectorIterator
     {
     public:
-        VectorIterator(VectorBase<T>& vector, const int start)
-            : m_vector(vector), i(start) {};
+        VectorIterator(VectorBase<T>& vector, const size_t start)
+            : m_vector(&vector), i(start) {};
 
         VectorIterator& operator++()
         {
             ++i;
             return *this;
         }
-        T& operator*() { return m_vector[i]; }
+        T& operator*() { return (*m_vector)[i]; }
 
         bool operator!=(const VectorIterator& other) { return i != other.i; }
 
     private:
-        VectorBase<T> m_vector;
+        VectorBase<T>* m_vector;
         size_t i;
     };
 
@@ -173,9 +244,9 @@ namespace LinearAlgebra
     }
 
     template <typename T>
-    VectorBase<T>::VectorBase(const size_t length) : m_length(length)
+    VectorBase<T>::VectorBase(const size_t length)
+        : m_data(AllocateStorage<T>(length)), m_length(length)
     {
-        m_data.reset(new T[m_length]);
     }
 
     template <typename T>
@@ -199,6 +270,55 @@ namespace LinearAlgebra
         std::copy(values.begin(), values.end(), storageDestination);
     }
 
+    template <typename T>
+    VectorBase<T>::VectorBase(const size_t length, std::shared_ptr<T[]> storage)
+        : m_data(std::move(storage)), m_length(length)
+    {
+    }
+
+    template <typename T>
+    VectorBase<T>::VectorBase(const VectorBase& other) : VectorBase(other.m_length)
+    {
+        const T* source = other.m_data.get();
+        std::copy(source, source + m_length, m_data.get());
+    }
+
+    template <typename T>
+    VectorBase<T>::VectorBase(VectorBase&& other) noexcept
+        : m_data(std::move(other.m_data)), m_length(other.m_length)
+    {
+        other.m_length = 0;
+    }
+
+    template <typename T>
+    VectorBase<T>& VectorBase<T>::operator=(const VectorBase& other)
+    {
+        if (this == &other)
+            return *this;
+
+        // Reuse the current storage when possible, such that repeated assignments in a loop do not allocate
+        if (m_length != other.m_length)
+        {
+            m_length = other.m_length;
+            m_data = AllocateStorage<T>(m_length);
+        }
+        const T* source = other.m_data.get();
+        std::copy(source, source + m_length, m_data.get());
+        return *this;
+    }
+
+    template <typename T>
+    VectorBase<T>& VectorBase<T>::operator=(VectorBase&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        m_data = std::move(other.m_data);
+        m_length = other.m_length;
+        other.m_length = 0;
+        return *this;
+    }
+
     template <typename T>
     T* VectorBase<T>::Data()
     {
@@ -218,6 +338,32 @@ namespace LinearAlgebra
         std::fill(storageDestination, storageDestination + this->m_length, value);
     }
 
+    template <typename T>
+    void VectorBase<T>::Axpy(const T& alpha, const VectorBase& x)
+    {
+        ThrowIfDimensionsMismatch(x.m_length);
+        Blas::Axpy(m_length, alpha, x.Data(), Data());
+    }
+
+    template <typename T>
+    void VectorBase<T>::Scale(const T& alpha)
+    {
+        Blas::Scal(m_length, alpha, Data());
+    }
+
+    template <typename T>
+    T VectorBase<T>::Dot(const VectorBase& other) const
+    {
+        ThrowIfDimensionsMismatch(other.m_length);
+        return Blas::Dot(m_length, Data(), other.Data());
+    }
+
+    template <typename T>
+    T VectorBase<T>::Norm2() const
+    {
+        return Blas::Nrm2(m_length, Data());
+    }
+
     template <typename T>
     std::span<T> VectorBase<T>::AsSpan()
     {
@@ -245,23 +391,52 @@ namespace LinearAlgebra
     }
 
     template <typename T>
-    void VectorBase<T>::ElementwiseSumVector(const VectorBase& other, VectorBase& result) const
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, ColumnVector<T>>
+    ColumnVector<T>::ColumnVector(const E& expression)
+        : VectorBase<T>(expression.GetLength())
     {
-        T* resultPointer = result.m_data.get();
-        T* lhs = this->m_data.get();
-        T* rhs = other.m_data.get();
-        std::transform(lhs, lhs + m_length, rhs, resultPointer, [](T& left, T& right)
-                       { return left + right; });
+        EvaluateExpression(expression, this->Data());
     }
 
     template <typename T>
-    void VectorBase<T>::ElementwiseSubtractVector(const VectorBase& other, VectorBase& result) const
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, ColumnVector<T>>
+    ColumnVector<T>& ColumnVector<T>::operator=(const E& expression)
     {
-        T* resultPointer = result.m_data.get();
-        T* lhs = this->m_data.get();
-        T* rhs = other.m_data.get();
-        std::transform(lhs, lhs + m_length, rhs, resultPointer, [](T& left, T& right)
-                       { return left - right; });
+        // Elementwise expressions only read index i before writing index i, thus the expression may contain this vector
+        if (this->m_length != expression.GetLength())
+            *this = ColumnVector(expression.GetLength());
+
+        EvaluateExpression(expression, this->Data());
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, ColumnVector<T>>
+    ColumnVector<T>& ColumnVector<T>::operator+=(const E& expression)
+    {
+        this->ThrowIfDimensionsMismatch(expression.GetLength());
+        CompoundAssignExpression<AddOperation>(expression, this->Data());
+        return *this;
+    }
+
+    template <typename T>
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, ColumnVector<T>>
+    ColumnVector<T>& ColumnVector<T>::operator-=(const E& expression)
+    {
+        this->ThrowIfDimensionsMismatch(expression.GetLength());
+        CompoundAssignExpression<SubtractOperation>(expression, this->Data());
+        return *this;
+    }
+
+    template <typename T>
+    ColumnVector<T>& ColumnVector<T>::operator*=(const T& scalar)
+    {
+        this->Scale(scalar);
+        return *this;
     }
 
     template <typename T>
@@ -282,39 +457,63 @@ namespace LinearAlgebra
     }
 
     template <typename T>
-    ColumnVector<T> ColumnVector<T>::operator+(const ColumnVector& vector) const
+    VectorView<T, RowVector<T>> ColumnVector<T>::Transposed()
+    {
+        return VectorView<T, RowVector<T>>(this->m_data, this->m_length, 1);
+    }
+
+    template <typename T>
+    VectorView<const T, RowVector<T>> ColumnVector<T>::Transposed() const
+    {
+        return VectorView<const T, RowVector<T>>(this->m_data, this->m_length, 1);
+    }
+
+    template <typename T>
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, RowVector<T>>
+    RowVector<T>::RowVector(const E& expression)
+        : VectorBase<T>(expression.GetLength())
+    {
+        EvaluateExpression(expression, this->Data());
+    }
+
+    template <typename T>
+    template <LinearExpressionNode E>
+        requires std::same_as<typename E::ResultType, RowVector<T>>
+    RowVector<T>& RowVector<T>::operator=(const E& expression)
     {
-        this->ThrowIfDimensionsMismatch(vector.m_length);
-        ColumnVector result(this->m_length);
-        this->ElementwiseSumVector(vector, result);
-        return result;
+        if (this->m_length != expression.GetLength())
+            *this = RowVector(expression.GetLength());
+
+        EvaluateExpression(expression, this->Data());
+        return *this;
     }
 
     template <typename T>
-    ColumnVector<T> ColumnVector<T>::operator-(const ColumnVector& vector) const
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, RowVector<T>>
+    RowVector<T>& RowVector<T>::operator+=(const E& expression)
     {
-        this->ThrowIfDimensionsMismatch(vector.m_length);
-        ColumnVector result(this->m_length);
-        this->ElementwiseSubtractVector(vector, result);
-        return result;
+        this->ThrowIfDimensionsMismatch(expression.GetLength());
+        CompoundAssignExpression<AddOperation>(expression, this->Data());
+        return *this;
     }
 
     template <typename T>
-    ColumnVector<T> ColumnVector<T>::operator*(const T& scalar) const
+    template <LinearExpression E>
+        requires std::same_as<typename E::ResultType, RowVector<T>>
+    RowVector<T>& RowVector<T>::operator-=(const E& expression)
     {
-        ColumnVector result(this->m_length);
-        T* srcPtr = this->m_data.get();
-        T* dstPtr = result.m_data.get();
-        std::transform(srcPtr, srcPtr + this->m_length, dstPtr, [&scalar](T& right)
-                       { return scalar * right; });
-        return result;
+        this->ThrowIfDimensionsMismatch(expression.GetLength());
+        CompoundAssignExpression<SubtractOperation>(expression, this->Data());
+        return *this;
     }
 
     template <typename T>
-    RowVector<T> ColumnVector<T>::Transposed() const
+    RowVector<T>& RowVector<T>::operator*=(const T& scalar)
     {
-        // TODO: view
-        return RowVector<T>(this->AsSpan());
+        this->Scale(scalar);
+        return *this;
     }
 
     template <typename T>
@@ -334,49 +533,37 @@ namespace LinearAlgebra
                           { return std::abs(left - right) < epsilon; });
     }
 
-    template <typename T>
-    RowVector<T> RowVector<T>::operator+(const RowVector& vector) const
-    {
-        this->ThrowIfDimensionsMismatch(vector.m_length);
-        RowVector result(this->m_length);
-        this->ElementwiseSumVector(vector, result);
-        return result;
-    }
-
-    template <typename T>
-    RowVector<T> RowVector<T>::operator-(const RowVector& vector) const
+    /// <summary>
+    /// Inner product of a row and a column expression, evaluated in one loop without temporaries.
+    /// </summary>
+    template <LinearExpression Lhs, LinearExpression Rhs>
+        requires std::same_as<typename Lhs::ResultType, RowVector<typename Lhs::ValueType>> &&
+                 std::same_as<typename Rhs::ResultType, ColumnVector<typename Lhs::ValueType>>
+    typename Lhs::ValueType operator*(const Lhs& lhs, const Rhs& rhs)
     {
-        this->ThrowIfDimensionsMismatch(vector.m_length);
-        RowVector result(this->m_length);
-        this->ElementwiseSubtractVector(vector, result);
-        return result;
-    }
+        const ExpressionOperandType<Lhs> row(lhs);
+        const ExpressionOperandType<Rhs> column(rhs);
+        if (row.GetLength() != column.GetLength())
+            throw std::invalid_argument("Dimensions mismatch");
 
-    template <typename T>
-    RowVector<T> RowVector<T>::operator*(const T& scalar) const
-    {
-        RowVector result(this->m_length);
-        T* srcPtr = this->m_data.get();
-        T* dstPtr = result.m_data.get();
-        std::transform(srcPtr, srcPtr + this->m_length, dstPtr, [&scalar](T& right)
-                       { return scalar * right; });
-        return result;
+        typename Lhs::ValueType innerProduct = 0;
+        for (size_t i = 0; i < row.GetLength(); i++)
+        {
+            innerProduct += row.At(i) * column.At(i);
+        }
+        return innerProduct;
     }
 
     template <typename T>
-    T RowVector<T>::operator*(const ColumnVector<T>& vector) const
+    VectorView<T, ColumnVector<T>> RowVector<T>::Transposed()
     {
-        this->ThrowIfDimensionsMismatch(vector.GetLength());
-        T* lhsPtr = this->m_data.get();
-        const T* rhsPtr = vector.Data();
-        return std::inner_product(lhsPtr, lhsPtr + this->m_length, rhsPtr, 0.0f);
+        return VectorView<T, ColumnVector<T>>(this->m_data, this->m_length, 1);
     }
 
     template <typename T>
-    ColumnVector<T> RowVector<T>::Transposed() const
+    VectorView<const T, ColumnVector<T>> RowVector<T>::Transposed() const
     {
-        // TODO: view
-        return ColumnVector<T>(this->AsSpan());
+        return VectorView<const T, ColumnVector<T>>(this->m_data, this->m_length, 1);
     }
 
 }
\ No newline at end of file
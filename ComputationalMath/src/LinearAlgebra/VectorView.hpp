@@ -0,0 +1,230 @@
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Expression.hpp"
+
+namespace LinearAlgebra
+{
+    template <typename T>
+    class ColumnVector;
+
+    template <typename T>
+    class RowVector;
+
+    template <typename Vector>
+    struct TransposedVector;
+
+    template <typename T>
+    struct TransposedVector<ColumnVector<T>>
+    {
+        using Type = RowVector<T>;
+    };
+
+    template <typename T>
+    struct TransposedVector<RowVector<T>>
+    {
+        using Type = ColumnVector<T>;
+    };
+
+    /// <summary>
+    /// Non-owning strided view on the storage of a vector or matrix, e.g. a matrix row or column. The view shares
+    /// ownership of the storage of its parent, thus it stays valid when the parent is destroyed or reassigned to a
+    /// new buffer. T is const for read-only views. Result is the vector type the view behaves as in expressions.
+    ///
+    /// Like std::slice_array, assigning to a view writes the elements, it does not rebind the view.
+    /// </summary>
+    template <typename T, typename Result>
+    class VectorView
+    {
+    public:
+        using ValueType = std::remove_const_t<T>;
+        using ResultType = Result;
+
+        VectorView(std::shared_ptr<T[]> data, size_t length, size_t stride);
+        VectorView(const VectorView& view) = default;
+
+        operator VectorView<const T, Result>() const
+            requires(!std::is_const_v<T>)
+        {
+            return VectorView<const T, Result>(m_data, m_length, m_stride);
+        }
+
+        VectorView& operator=(const VectorView& view)
+            requires(!std::is_const_v<T>);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+        VectorView& operator=(const E& expression);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+        VectorView& operator+=(const E& expression);
+
+        template <LinearExpression E>
+            requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+        VectorView& operator-=(const E& expression);
+
+        VectorView& operator*=(const ValueType& scalar)
+            requires(!std::is_const_v<T>);
+
+        T& operator[](size_t index) const;
+        T& GetValue(size_t index) const;
+
+        size_t GetLength() const;
+        size_t GetStride() const;
+        T* Data() const;
+
+        VectorView<T, typename TransposedVector<Result>::Type> Transposed() const;
+
+        bool ElementwiseEquals(const Result& vector) const;
+        bool ElementwiseCompare(const Result& vector, float epsilon) const;
+
+    private:
+        void ThrowIfDimensionsMismatch(size_t otherLength) const;
+
+    private:
+        std::shared_ptr<T[]> m_data;
+        size_t m_length;
+        size_t m_stride;
+    };
+
+    template <typename T, typename Result>
+    struct ExpressionOperand<VectorView<T, Result>>
+    {
+        using Type = StridedVectorTerminal<std::remove_const_t<T>, Result>;
+    };
+
+    template <typename T, typename Result>
+    VectorView<T, Result>::VectorView(std::shared_ptr<T[]> data, const size_t length, const size_t stride)
+        : m_data(std::move(data)), m_length(length), m_stride(stride)
+    {
+    }
+
+    template <typename T, typename Result>
+    VectorView<T, Result>& VectorView<T, Result>::operator=(const VectorView& view)
+        requires(!std::is_const_v<T>)
+    {
+        ThrowIfDimensionsMismatch(view.m_length);
+        StridedAssignExpression<AssignOperation>(view, Data(), m_stride);
+        return *this;
+    }
+
+    template <typename T, typename Result>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+    VectorView<T, Result>& VectorView<T, Result>::operator=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetLength());
+        StridedAssignExpression<AssignOperation>(expression, Data(), m_stride);
+        return *this;
+    }
+
+    template <typename T, typename Result>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+    VectorView<T, Result>& VectorView<T, Result>::operator+=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetLength());
+        StridedAssignExpression<AddOperation>(expression, Data(), m_stride);
+        return *this;
+    }
+
+    template <typename T, typename Result>
+    template <LinearExpression E>
+        requires(!std::is_const_v<T> && std::same_as<typename E::ResultType, Result>)
+    VectorView<T, Result>& VectorView<T, Result>::operator-=(const E& expression)
+    {
+        ThrowIfDimensionsMismatch(expression.GetLength());
+        StridedAssignExpression<SubtractOperation>(expression, Data(), m_stride);
+        return *this;
+    }
+
+    template <typename T, typename Result>
+    VectorView<T, Result>& VectorView<T, Result>::operator*=(const ValueType& scalar)
+        requires(!std::is_const_v<T>)
+    {
+        T* data = Data();
+        for (size_t i = 0; i < m_length; i++)
+        {
+            data[i * m_stride] *= scalar;
+        }
+        return *this;
+    }
+
+    template <typename T, typename Result>
+    T& VectorView<T, Result>::operator[](const size_t index) const
+    {
+        return m_data.get()[index * m_stride];
+    }
+
+    template <typename T, typename Result>
+    T& VectorView<T, Result>::GetValue(const size_t index) const
+    {
+        if (index >= m_length)
+            throw std::out_of_range("Out of range");
+        return m_data.get()[index * m_stride];
+    }
+
+    template <typename T, typename Result>
+    size_t VectorView<T, Result>::GetLength() const
+    {
+        return m_length;
+    }
+
+    template <typename T, typename Result>
+    size_t VectorView<T, Result>::GetStride() const
+    {
+        return m_stride;
+    }
+
+    template <typename T, typename Result>
+    T* VectorView<T, Result>::Data() const
+    {
+        return m_data.get();
+    }
+
+    template <typename T, typename Result>
+    VectorView<T, typename TransposedVector<Result>::Type> VectorView<T, Result>::Transposed() const
+    {
+        return VectorView<T, typename TransposedVector<Result>::Type>(m_data, m_length, m_stride);
+    }
+
+    template <typename T, typename Result>
+    bool VectorView<T, Result>::ElementwiseEquals(const Result& vector) const
+    {
+        if (m_length != vector.GetLength())
+            return false;
+
+        for (size_t i = 0; i < m_length; i++)
+        {
+            if ((*this)[i] != vector[i])
+                return false;
+        }
+        return true;
+    }
+
+    template <typename T, typename Result>
+    bool VectorView<T, Result>::ElementwiseCompare(const Result& vector, const float epsilon) const
+    {
+        if (m_length != vector.GetLength())
+            return false;
+
+        for (size_t i = 0; i < m_length; i++)
+        {
+            if (!(std::abs((*this)[i] - vector[i]) < epsilon))
+                return false;
+        }
+        return true;
+    }
+
+    template <typename T, typename Result>
+    void VectorView<T, Result>::ThrowIfDimensionsMismatch(const size_t otherLength) const
+    {
+        if (m_length != otherLength)
+            throw std::invalid_argument("Dimensions mismatch");
+    }
+}
@@ -0,0 +1,75 @@
+#include <Geometry/MeshHierarchy.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace Geometry
+{
+    TEST(MeshHierarchyTests, CreateRectangularMeshHierarchy_WhenEvenCellCounts_ShouldHalveToMinCells)
+    {
+        const RectangularMeshHierarchy hierarchy = CreateRectangularMeshHierarchy(Rectangle(0, 2, 0, 1), 16, 8, 2);
+
+        EXPECT_EQ(hierarchy.CellCountsX, std::vector<unsigned int>({16, 8, 4}));
+        EXPECT_EQ(hierarchy.CellCountsY, std::vector<unsigned int>({8, 4, 2}));
+        ASSERT_EQ(hierarchy.Meshes.size(), 3);
+        ASSERT_EQ(hierarchy.Prolongations.size(), 2);
+        for (size_t level = 0; level < hierarchy.Meshes.size(); level++)
+        {
+            const size_t vertexCount = (hierarchy.CellCountsX[level] + 1) * (hierarchy.CellCountsY[level] + 1);
+            EXPECT_EQ(hierarchy.Meshes[level].Vertices.size(), vertexCount);
+            EXPECT_EQ(hierarchy.Meshes[level].Interior.size(), 2 * hierarchy.CellCountsX[level] * hierarchy.CellCountsY[level]);
+            if (level + 1 < hierarchy.Meshes.size())
+            {
+                EXPECT_EQ(hierarchy.Prolongations[level].GetRowCount(), vertexCount);
+                EXPECT_EQ(hierarchy.Prolongations[level].GetColumnCount(), hierarchy.Meshes[level + 1].Vertices.size());
+            }
+        }
+
+        // Odd cell counts cannot be halved
+        EXPECT_EQ(CreateRectangularMeshHierarchy(Rectangle(0, 1, 0, 1), 12, 5).Meshes.size(), 1);
+        EXPECT_EQ(CreateRectangularMeshHierarchy(Rectangle(0, 1, 0, 1), 12, 12).Meshes.size(), 3);
+        EXPECT_THROW(CreateRectangularMeshHierarchy(Rectangle(0, 1, 0, 1), 0, 4), std::invalid_argument);
+    }
+
+    TEST(MeshHierarchyTests, CreateRectangularProlongation_WhenLinearFunction_ShouldInterpolateExactly)
+    {
+        const RectangularMeshHierarchy hierarchy = CreateRectangularMeshHierarchy(Rectangle(-1, 1, 0, 3), 8, 6, 1);
+        ASSERT_EQ(hierarchy.Meshes.size(), 2);
+
+        const auto linear = [](const Vertex2F& v) { return 2.0f * v.X - 3.0f * v.Y + 1.0f; };
+        const std::vector<Vertex2F>& coarse = hierarchy.Meshes[1].Vertices;
+        const std::vector<Vertex2F>& fine = hierarchy.Meshes[0].Vertices;
+        LinearAlgebra::ColumnVector<float> coarseValues(coarse.size()), fineValues(fine.size());
+        for (size_t i = 0; i < coarse.size(); i++)
+            coarseValues[i] = linear(coarse[i]);
+
+        LinearAlgebra::Spmv(1.0f, hierarchy.Prolongations[0], coarseValues, 0.0f, fineValues);
+        for (size_t i = 0; i < fine.size(); i++)
+            EXPECT_NEAR(fineValues[i], linear(fine[i]), 1e-5f);
+    }
+
+    TEST(MeshHierarchyTests, CreateRectangularProlongation_WhenCellCenter_ShouldInterpolateAlongDiagonal)
+    {
+        // Coarse 1 x 1 mesh, vertices 0 = (0, 0), 1 = (1, 0), 2 = (0, 1), 3 = (1, 1), split along 0-3
+        const LinearAlgebra::Matrix<float> P = CreateRectangularProlongation(1, 1).ToMatrix();
+        ASSERT_EQ(P.GetRowCount(), 9);
+        ASSERT_EQ(P.GetColumnCount(), 4);
+
+        const std::vector<std::array<float, 4>> expected = {
+            {1.0f, 0.0f, 0.0f, 0.0f},
+            {0.5f, 0.5f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.5f, 0.0f, 0.5f, 0.0f},
+            {0.5f, 0.0f, 0.0f, 0.5f},
+            {0.0f, 0.5f, 0.0f, 0.5f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 0.5f, 0.5f},
+            {0.0f, 0.0f, 0.0f, 1.0f},
+        };
+        for (size_t i = 0; i < 9; i++)
+        {
+            for (size_t j = 0; j < 4; j++)
+                EXPECT_EQ(P(i, j), expected[i][j]) << i << ", " << j;
+        }
+    }
+}
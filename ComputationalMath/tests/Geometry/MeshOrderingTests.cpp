@@ -0,0 +1,117 @@
+#include <Geometry/MeshGenerator.hpp>
+#include <Geometry/MeshOrdering.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Geometry
+{
+    // Renumbers the vertices of mesh randomly, as the insertion order of a refined Delaunay triangulation
+    static Mesh2D ScrambleMesh(const Mesh2D& mesh)
+    {
+        std::vector<unsigned int> inverse(mesh.Vertices.size());
+        std::iota(inverse.begin(), inverse.end(), 0);
+        TestHelper::RandomGenerator random(12345);
+        for (size_t i = inverse.size(); i > 1; i--)
+            std::swap(inverse[i - 1], inverse[random.NextIndex(i)]);
+
+        Mesh2D scrambled;
+        scrambled.Vertices.resize(mesh.Vertices.size());
+        for (size_t i = 0; i < mesh.Vertices.size(); i++)
+            scrambled.Vertices[inverse[i]] = mesh.Vertices[i];
+        for (const TriangleElement& element : mesh.Interior)
+            scrambled.Interior.push_back(TriangleElement(inverse[element.I], inverse[element.J], inverse[element.K]));
+        for (const LineElement& element : mesh.Boundary)
+            scrambled.Boundary.push_back(LineElement(inverse[element.I], inverse[element.J]));
+        return scrambled;
+    }
+
+    TEST(MeshOrderingTests, ReorderMesh_WhenReordered_ShouldKeepElements)
+    {
+        const Mesh2D original = ScrambleMesh(CreateRectangularMesh(Rectangle(0, 2, 0, 1), 8, 4));
+        for (const VertexOrdering ordering : {VertexOrdering::ReverseCuthillMcKee, VertexOrdering::Hilbert})
+        {
+            Mesh2D mesh = original;
+            const std::vector<unsigned int> permutation = ReorderMesh(mesh, ordering);
+
+            ASSERT_EQ(permutation.size(), original.Vertices.size());
+            std::vector<unsigned int> sorted = permutation;
+            std::sort(sorted.begin(), sorted.end());
+            for (unsigned int i = 0; i < sorted.size(); i++)
+                EXPECT_EQ(sorted[i], i);
+            for (size_t i = 0; i < permutation.size(); i++)
+                EXPECT_TRUE(TestHelper::Vertex2FNearlyEqual(mesh.Vertices[i], original.Vertices[permutation[i]]));
+
+            // In the original numbering, the elements are the original elements, with the same orientation
+            std::vector<TriangleElement> interior;
+            for (const TriangleElement& element : mesh.Interior)
+            {
+                EXPECT_LT(element.I, element.J);
+                EXPECT_LT(element.I, element.K);
+                interior.push_back(TriangleElement(permutation[element.I], permutation[element.J], permutation[element.K]));
+            }
+            EXPECT_EQUIVALENT_USING(interior, original.Interior, TestHelper::TriangleElementCyclicalEqual);
+            EXPECT_TRUE(std::is_sorted(mesh.Interior.begin(), mesh.Interior.end(), [](const TriangleElement& a, const TriangleElement& b)
+                                       { return a.I < b.I; }));
+
+            ASSERT_EQ(mesh.Boundary.size(), original.Boundary.size());
+            for (const LineElement& element : mesh.Boundary)
+            {
+                const LineElement mapped(permutation[element.I], permutation[element.J]);
+                EXPECT_TRUE(std::any_of(original.Boundary.begin(), original.Boundary.end(), [&mapped](const LineElement& line)
+                                        { return line.I == mapped.I && line.J == mapped.J; }));
+            }
+        }
+    }
+
+    TEST(MeshOrderingTests, ReorderMesh_WhenReverseCuthillMcKee_ShouldReduceBandwidth)
+    {
+        // The bandwidth of the row by row numbering is nx + 2, Cuthill-McKee numbers along the shorter side
+        Mesh2D mesh = ScrambleMesh(CreateRectangularMesh(Rectangle(0, 4, 0, 1), 40, 10));
+        EXPECT_GT(GetMeshBandwidth(mesh), 200);
+
+        ReorderMesh(mesh, VertexOrdering::ReverseCuthillMcKee);
+        EXPECT_LE(GetMeshBandwidth(mesh), 12);
+    }
+
+    TEST(MeshOrderingTests, ReorderMesh_WhenHilbert_ShouldNumberNeighborsClose)
+    {
+        // Fraction of the edges of which both vertices are at most 8 apart, thus likely share a cache line. Of the
+        // row by row numbering, only the horizontal edges are.
+        const auto closeEdgeFraction = [](const Mesh2D& mesh)
+        {
+            const std::vector<LineElement> edges = mesh.GetAllEdges();
+            const size_t closeCount = std::count_if(edges.begin(), edges.end(), [](const LineElement& edge)
+                                                    { return (edge.I > edge.J ? edge.I - edge.J : edge.J - edge.I) <= 8; });
+            return static_cast<double>(closeCount) / static_cast<double>(edges.size());
+        };
+
+        const Mesh2D rowByRow = CreateRectangularMesh(Rectangle(0, 1, 0, 1), 32, 32);
+        Mesh2D mesh = ScrambleMesh(rowByRow);
+        EXPECT_LT(closeEdgeFraction(mesh), 0.05);
+        ReorderMesh(mesh, VertexOrdering::Hilbert);
+        EXPECT_GT(closeEdgeFraction(mesh), 1.5 * closeEdgeFraction(rowByRow));
+    }
+
+    TEST(MeshOrderingTests, ReorderMesh_WhenDisconnected_ShouldOrderEveryComponent)
+    {
+        Mesh2D mesh = CreateRectangularMesh(Rectangle(0, 1, 0, 1), 3, 3);
+        const unsigned int offset = static_cast<unsigned int>(mesh.Vertices.size());
+        const Mesh2D second = CreateRectangularMesh(Rectangle(2, 3, 0, 1), 2, 2);
+        for (const Vertex2F& vertex : second.Vertices)
+            mesh.Vertices.push_back(vertex);
+        for (const TriangleElement& element : second.Interior)
+            mesh.Interior.push_back(TriangleElement(element.I + offset, element.J + offset, element.K + offset));
+        mesh.Vertices.push_back(Vertex2F(5, 5));
+
+        const std::vector<unsigned int> permutation = ReorderMesh(mesh, VertexOrdering::ReverseCuthillMcKee);
+        std::vector<unsigned int> sorted = permutation;
+        std::sort(sorted.begin(), sorted.end());
+        for (unsigned int i = 0; i < sorted.size(); i++)
+            EXPECT_EQ(sorted[i], i);
+        EXPECT_LE(GetMeshBandwidth(mesh), 5);
+    }
+}
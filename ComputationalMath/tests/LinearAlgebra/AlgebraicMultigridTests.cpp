@@ -0,0 +1,144 @@
+#include <LinearAlgebra/AlgebraicMultigrid.hpp>
+#include <LinearAlgebra/ConjugateGradient.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    TEST(AlgebraicMultigridTests, Constructor_WhenLaplacian_ShouldCoarsenToGalerkinOperators)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(32, 0.0);
+        const AlgebraicMultigrid<double> multigrid(matrix, {.MaxCoarseSize = 40});
+
+        ASSERT_GE(multigrid.GetLevelCount(), 3);
+        const MultigridStatistics& statistics = multigrid.GetStatistics();
+        ASSERT_EQ(statistics.LevelSizes.size(), multigrid.GetLevelCount());
+        EXPECT_EQ(statistics.LevelSizes[0], 1024);
+        EXPECT_LE(statistics.LevelSizes.back(), 40);
+        EXPECT_GT(statistics.SetupSeconds, 0.0);
+        EXPECT_GT(statistics.OperatorComplexity(), 1.0);
+        EXPECT_LT(statistics.OperatorComplexity(), 2.0);
+
+        for (size_t level = 0; level + 1 < multigrid.GetLevelCount(); level++)
+        {
+            // Aggregates of a 5-point stencil hold about five nodes
+            EXPECT_LT(statistics.LevelSizes[level + 1] * 3, statistics.LevelSizes[level]);
+
+            const Matrix<double> P = multigrid.GetProlongation(level).ToMatrix();
+            const Matrix<double> galerkin = P.Transposed() * multigrid.GetOperator(level).ToMatrix() * P;
+            const Matrix<double> coarse = multigrid.GetOperator(level + 1).ToMatrix();
+            for (size_t i = 0; i < coarse.GetRowCount(); i++)
+            {
+                for (size_t j = 0; j < coarse.GetColumnCount(); j++)
+                {
+                    EXPECT_NEAR(coarse(i, j), galerkin(i, j), 1e-12);
+                    EXPECT_NEAR(coarse(i, j), coarse(j, i), 1e-12);
+                }
+            }
+        }
+        EXPECT_THROW(multigrid.GetProlongation(multigrid.GetLevelCount() - 1), std::out_of_range);
+    }
+
+    TEST(AlgebraicMultigridTests, Solve_WhenStandalone_ShouldConvergeIndependentOfSize)
+    {
+        for (const MultigridSmoother smoother : {MultigridSmoother::GaussSeidel, MultigridSmoother::Jacobi, MultigridSmoother::Chebyshev})
+        {
+            std::vector<size_t> iterations;
+            for (const size_t size : {32, 96})
+            {
+                const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(size, 1e-3);
+                const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+                ColumnVector<double> x(matrix.GetRowCount());
+                x.Fill(0.0);
+
+                const AlgebraicMultigrid<double> multigrid(matrix, {.MaxCoarseSize = 50, .Smoother = smoother, .PreSmoothingSteps = 2,
+                                                                    .PostSmoothingSteps = 2});
+                const IterativeReport report = multigrid.Solve(rhs, x, {200, 1e-8});
+                EXPECT_TRUE(report.Converged) << report;
+                EXPECT_EQ(multigrid.GetStatistics().CycleCount, report.Iterations);
+                iterations.push_back(report.Iterations);
+
+                ColumnVector<double> residual = rhs;
+                Spmv(-1.0, matrix, x, 1.0, residual);
+                EXPECT_LE(residual.Norm2(), 1e-8 * rhs.Norm2());
+            }
+            EXPECT_LE(iterations[1], iterations[0] * 2);
+        }
+    }
+
+    TEST(AlgebraicMultigridTests, ConjugateGradient_WhenPreconditioned_ShouldNeedFewIterations)
+    {
+        std::vector<size_t> iterations;
+        for (const size_t size : {32, 128})
+        {
+            const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(size, 0.0);
+            const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+            const AlgebraicMultigrid<double> multigrid(matrix);
+
+            IterativeReport report;
+            const ColumnVector<double> x = ConjugateGradient(matrix, rhs, multigrid, {200, 1e-10}, &report);
+            EXPECT_TRUE(report.Converged) << report;
+            // One cycle for the initial residual and one per iteration, except for the converged one
+            EXPECT_EQ(multigrid.GetStatistics().CycleCount, report.Iterations);
+            EXPECT_GT(multigrid.GetStatistics().CycleSeconds, 0.0);
+            iterations.push_back(report.Iterations);
+        }
+        EXPECT_LE(iterations[0], 15);
+        EXPECT_LE(iterations[1], iterations[0] + 5);
+    }
+
+    TEST(AlgebraicMultigridTests, Apply_WhenSingleLevel_ShouldSolveExactly)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(6, 0.5);
+        const AlgebraicMultigrid<double> multigrid(matrix, {.MaxCoarseSize = 100});
+        EXPECT_EQ(multigrid.GetLevelCount(), 1);
+
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const ColumnVector<double> expected = Factorization::LUSolve(matrix.ToMatrix(), rhs, 1e-12);
+        ColumnVector<double> z(matrix.GetRowCount());
+        multigrid.Apply(rhs, z);
+        for (size_t i = 0; i < z.GetLength(); i++)
+            EXPECT_NEAR(z[i], expected[i], 1e-12);
+    }
+
+    TEST(AlgebraicMultigridTests, Constructor_WhenDirichletRows_ShouldLeaveThemUnaggregated)
+    {
+        // Identity rows have no strong connections, and are solved exactly by the smoother
+        SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(20, 0.0);
+        std::vector<SparseEntry<double>> entries;
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            for (size_t k = matrix.RowOffsets()[i]; k < matrix.RowOffsets()[i + 1]; k++)
+            {
+                const SparseIndex column = matrix.ColumnIndices()[k];
+                const bool dirichlet = i < 20;
+                entries.push_back({static_cast<SparseIndex>(i), column, dirichlet ? (column == i ? 1.0 : 0.0) : matrix.Values()[k]});
+            }
+        }
+        matrix = SparseMatrix<double>(matrix.GetRowCount(), matrix.GetColumnCount(), entries);
+
+        const AlgebraicMultigrid<double> multigrid(matrix, {.MaxCoarseSize = 30});
+        ASSERT_GE(multigrid.GetLevelCount(), 2);
+        const SparseMatrix<double>& P = multigrid.GetProlongation(0);
+        for (size_t i = 0; i < 20; i++)
+        {
+            for (size_t k = P.RowOffsets()[i]; k < P.RowOffsets()[i + 1]; k++)
+                EXPECT_EQ(P.Values()[k], 0.0);
+        }
+
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        ColumnVector<double> x(matrix.GetRowCount());
+        x.Fill(0.0);
+        EXPECT_TRUE(multigrid.Solve(rhs, x, {100, 1e-8}).Converged);
+    }
+
+    TEST(AlgebraicMultigridTests, Constructor_WhenInvalidMatrix_ShouldThrow)
+    {
+        const SparseMatrix<double> missingDiagonal(2, 2, std::vector<SparseEntry<double>>{{0, 0, 1.0}, {1, 0, 1.0}});
+        EXPECT_THROW(AlgebraicMultigrid<double>{missingDiagonal}, std::invalid_argument);
+        EXPECT_THROW(AlgebraicMultigrid<double>{SparseMatrix<double>(2, 3)}, std::invalid_argument);
+        EXPECT_THROW((AlgebraicMultigrid<double>{TestHelper::CreateShiftedLaplacian(3, 0.0), {.MaxLevels = 0}}), std::invalid_argument);
+    }
+}
@@ -0,0 +1,98 @@
+#include <LinearAlgebra/AlignedStorage.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/VectorBase.hpp>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    static bool IsAligned(const void* pointer, const size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+
+    TEST(AlignedStorageTests, AllocateStorage_WhenAllocated_ShouldBeAlignedWithZeroTail)
+    {
+        for (size_t length = 1; length < 40; length++)
+        {
+            std::shared_ptr<double[]> storage = AllocateStorage<double>(length);
+            EXPECT_TRUE(IsAligned(storage.get(), CacheLineSize));
+            for (size_t i = length; i < PaddedLength<double>(length); i++)
+            {
+                EXPECT_EQ(storage[i], 0.0);
+            }
+        }
+        EXPECT_EQ(AllocateStorage<float>(0), nullptr);
+    }
+
+    TEST(AlignedStorageTests, PaddedLength_WhenLengthIsGiven_ShouldFillWholeCacheLines)
+    {
+        EXPECT_EQ(PaddedLength<float>(1), 16);
+        EXPECT_EQ(PaddedLength<float>(16), 16);
+        EXPECT_EQ(PaddedLength<float>(17), 32);
+        EXPECT_EQ(PaddedLength<double>(9), 16);
+    }
+
+    TEST(AlignedStorageTests, LeadingDimension_WhenRowsArePadded_ShouldOnlyPadRowsOfAtLeastOneCacheLine)
+    {
+        EXPECT_EQ(LeadingDimension<float>(3), 3);
+        EXPECT_EQ(LeadingDimension<float>(16), 16);
+        EXPECT_EQ(LeadingDimension<float>(100), 112);
+        EXPECT_EQ(LeadingDimension<double>(9), 16);
+        EXPECT_EQ(LeadingDimension<int>(100), 100);
+    }
+
+    TEST(AlignedStorageTests, Matrix_WhenRowsArePadded_ShouldAlignEveryRowAndKeepPaddingZero)
+    {
+        Matrix<float> matrix(5, 20);
+        matrix.Fill(3.0f);
+        matrix *= 2.0f;
+        matrix += matrix;
+
+        const size_t ld = matrix.GetLeadingDimension();
+        EXPECT_EQ(ld, 32);
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            const float* row = matrix.Data() + i * ld;
+            EXPECT_TRUE(IsAligned(row, CacheLineSize));
+            for (size_t j = 0; j < matrix.GetColumnCount(); j++)
+            {
+                EXPECT_EQ(row[j], 12.0f);
+            }
+            for (size_t j = matrix.GetColumnCount(); j < ld; j++)
+            {
+                EXPECT_EQ(row[j], 0.0f);
+            }
+        }
+    }
+
+    TEST(AlignedStorageTests, Matrix_WhenRowsArePadded_ShouldComputeLikeUnpadded)
+    {
+        Matrix<double> matrix(9, 17);
+        for (size_t i = 0; i < matrix.GetRowCount(); i++)
+        {
+            for (size_t j = 0; j < matrix.GetColumnCount(); j++)
+            {
+                matrix(i, j) = static_cast<double>(i * 17 + j);
+            }
+        }
+
+        Matrix<double> transposed = matrix.Transposed();
+        EXPECT_EQ(transposed(16, 8), matrix(8, 16));
+        EXPECT_TRUE(Matrix<double>(matrix.TransposedView()).ElementwiseEquals(transposed));
+        EXPECT_DOUBLE_EQ(matrix.Dot(matrix), transposed.Dot(transposed));
+
+        ColumnVector<double> ones(17);
+        ones.Fill(1.0);
+        ColumnVector<double> rowSums = matrix * ones;
+        EXPECT_DOUBLE_EQ(rowSums[8], 8 * 17 * 17 + 136.0);
+    }
+
+    TEST(AlignedStorageTests, Vector_WhenAllocated_ShouldBeAligned)
+    {
+        ColumnVector<float> vector(7);
+        RowVector<int> row = {1, 2, 3};
+        EXPECT_TRUE(IsAligned(vector.Data(), CacheLineSize));
+        EXPECT_TRUE(IsAligned(row.Data(), CacheLineSize));
+    }
+}
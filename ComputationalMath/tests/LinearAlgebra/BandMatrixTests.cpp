@@ -0,0 +1,69 @@
+#include <LinearAlgebra/BandMatrix.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    // Tridiagonal plus a diagonal at distance offset below the diagonal, as a sparse matrix
+    static SparseMatrix<double> CreateBandedSparseMatrix(const size_t size, const size_t offset)
+    {
+        std::vector<SparseEntry<double>> entries;
+        for (SparseIndex i = 0; i < size; i++)
+        {
+            entries.push_back({i, i, 4.0 + i});
+            if (i > 0)
+                entries.push_back({i, i - 1, -1.0});
+            if (i + 1 < size)
+                entries.push_back({i, i + 1, -2.0});
+            if (i >= offset)
+                entries.push_back({i, static_cast<SparseIndex>(i - offset), 0.5});
+        }
+        return SparseMatrix<double>(size, size, entries);
+    }
+
+    TEST(BandMatrixTests, Constructor_WhenSparseMatrix_ShouldStoreSmallestBand)
+    {
+        const SparseMatrix<double> sparse = CreateBandedSparseMatrix(20, 5);
+        const BandMatrix<double> band(sparse);
+
+        EXPECT_EQ(band.GetSize(), 20);
+        EXPECT_EQ(band.GetLowerBandwidth(), 5);
+        EXPECT_EQ(band.GetUpperBandwidth(), 1);
+        EXPECT_EQ(band.GetRowWidth(), 7);
+        EXPECT_TRUE(band.ToMatrix().ElementwiseEquals(sparse.ToMatrix()));
+
+        const BandMatrix<double> wider(sparse, 2, 4);
+        EXPECT_EQ(wider.GetLowerBandwidth(), 5);
+        EXPECT_EQ(wider.GetUpperBandwidth(), 4);
+        EXPECT_TRUE(wider.ToMatrix().ElementwiseEquals(sparse.ToMatrix()));
+
+        EXPECT_THROW(BandMatrix<double>(SparseMatrix<double>(3, 4)), std::invalid_argument);
+    }
+
+    TEST(BandMatrixTests, Indexing_WhenOutsideBand_ShouldReturnZeroOrThrow)
+    {
+        BandMatrix<double> band(10, 1, 2);
+        band(4, 3) = 1.0;
+        band(4, 6) = 2.0;
+        const BandMatrix<double>& constBand = band;
+
+        EXPECT_EQ(constBand(4, 3), 1.0);
+        EXPECT_EQ(constBand(4, 6), 2.0);
+        EXPECT_EQ(constBand(4, 7), 0.0);
+        EXPECT_EQ(constBand(4, 2), 0.0);
+        EXPECT_THROW(band(4, 7), std::out_of_range);
+        EXPECT_THROW(band(4, 2), std::out_of_range);
+        EXPECT_THROW(constBand(10, 9), std::out_of_range);
+    }
+
+    TEST(BandMatrixTests, Multiply_WhenVector_ShouldEqualSparseProduct)
+    {
+        const SparseMatrix<double> sparse = CreateBandedSparseMatrix(50, 7);
+        const BandMatrix<double> band(sparse);
+        ColumnVector<double> vector(50);
+        for (size_t i = 0; i < 50; i++)
+            vector[i] = static_cast<double>((i * 5) % 9) - 4;
+
+        EXPECT_TRUE((band * vector).ElementwiseCompare(sparse * vector, 1e-12f));
+        EXPECT_THROW(band * ColumnVector<double>(49), std::invalid_argument);
+    }
+}
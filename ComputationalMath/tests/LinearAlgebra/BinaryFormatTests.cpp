@@ -0,0 +1,184 @@
+#include <LinearAlgebra/BinaryFormat.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    namespace
+    {
+        std::string TemporaryPath(const std::string& name)
+        {
+            return (std::filesystem::temp_directory_path() / name).string();
+        }
+
+        template <typename T>
+        Matrix<T> CreateMatrix(const size_t rowCount, const size_t columnCount)
+        {
+            Matrix<T> matrix(rowCount, columnCount);
+            for (size_t i = 0; i < rowCount; i++)
+            {
+                for (size_t j = 0; j < columnCount; j++)
+                {
+                    matrix(i, j) = static_cast<T>(i * columnCount + j) / T(7);
+                }
+            }
+            return matrix;
+        }
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenSavedFloat_ShouldBeEqual)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Float.bin");
+        const Matrix<float> expected = CreateMatrix<float>(23, 37);
+        SaveBinary(path, expected);
+
+        {
+            const Matrix<float> actual = LoadMatrix<float>(path);
+            ASSERT_EQ(actual.GetRowCount(), 23);
+            ASSERT_EQ(actual.GetColumnCount(), 37);
+            EXPECT_EQ(actual.GetLeadingDimension(), expected.GetLeadingDimension());
+            EXPECT_TRUE(actual.ElementwiseEquals(expected));
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenSavedDouble_ShouldBeEqual)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Double.bin");
+        const Matrix<double> expected = CreateMatrix<double>(130, 70);
+        SaveBinary(path, expected);
+
+        {
+            const Matrix<double> actual = LoadMatrix<double>(path);
+            EXPECT_TRUE(actual.ElementwiseEquals(expected));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(actual.Data()) % StorageTraits<double>::Alignment, 0) << "Mapped storage should be aligned";
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST(BinaryFormatTests, LoadColumnVector_WhenSaved_ShouldBeEqual)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Vector.bin");
+        ColumnVector<int32_t> expected(1001);
+        for (size_t i = 0; i < expected.GetLength(); i++)
+        {
+            expected[i] = static_cast<int32_t>(i * i) - 500;
+        }
+        SaveBinary(path, expected);
+
+        {
+            const ColumnVector<int32_t> actual = LoadColumnVector<int32_t>(path);
+            EXPECT_TRUE(actual.ElementwiseEquals(expected));
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenModified_ShouldNotChangeFile)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_CopyOnWrite.bin");
+        const Matrix<double> expected = CreateMatrix<double>(16, 16);
+        SaveBinary(path, expected);
+
+        {
+            Matrix<double> loaded = LoadMatrix<double>(path);
+            loaded(3, 4) = -1.0;
+            loaded *= 2.0;
+            EXPECT_EQ(loaded(3, 4), -2.0);
+        }
+
+        const Matrix<double> reloaded = LoadMatrix<double>(path);
+        std::filesystem::remove(path);
+        EXPECT_TRUE(reloaded.ElementwiseEquals(expected));
+    }
+
+    TEST(BinaryFormatTests, BinaryWriter_WhenWrittenByRow_ShouldEqualSaveBinary)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Writer.bin");
+        const Matrix<float> expected = CreateMatrix<float>(9, 65);
+        {
+            BinaryWriter<float> writer(path, BinaryObjectKind::Matrix, 9, 65);
+            for (size_t i = 0; i < 9; i++)
+            {
+                writer.WriteRow(expected.Data() + i * expected.GetLeadingDimension());
+            }
+            writer.Close();
+        }
+
+        const Matrix<float> actual = LoadMatrix<float>(path);
+        std::filesystem::remove(path);
+        EXPECT_TRUE(actual.ElementwiseEquals(expected));
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenPackedLayout_ShouldCopy)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Packed.bin");
+        const size_t rowCount = 5;
+        const size_t columnCount = 37;
+        const BinaryHeader header = CreateBinaryHeader(BinaryObjectKind::Matrix, BinaryElementType::Float32, sizeof(float), 8,
+                                                       rowCount, columnCount, columnCount);
+        {
+            std::ofstream stream(path, std::ios::binary);
+            std::vector<char> headerBytes(header.DataOffset, 0);
+            std::memcpy(headerBytes.data(), &header, sizeof(BinaryHeader));
+            stream.write(headerBytes.data(), static_cast<std::streamsize>(headerBytes.size()));
+            for (size_t k = 0; k < rowCount * columnCount; k++)
+            {
+                const float value = static_cast<float>(k);
+                stream.write(reinterpret_cast<const char*>(&value), sizeof(float));
+            }
+        }
+
+        const Matrix<float> actual = LoadMatrix<float>(path);
+        std::filesystem::remove(path);
+        ASSERT_EQ(actual.GetRowCount(), rowCount);
+        ASSERT_EQ(actual.GetColumnCount(), columnCount);
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                ASSERT_EQ(actual(i, j), static_cast<float>(i * columnCount + j));
+            }
+        }
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenTypeMismatch_ShouldThrow)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Mismatch.bin");
+        SaveBinary(path, CreateMatrix<float>(4, 4));
+
+        EXPECT_THROW(LoadMatrix<double>(path), std::invalid_argument);
+        EXPECT_THROW(LoadColumnVector<float>(path), std::invalid_argument);
+        std::filesystem::remove(path);
+    }
+
+    TEST(BinaryFormatTests, LoadMatrix_WhenCorruptOrTruncated_ShouldThrow)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Corrupt.bin");
+        SaveBinary(path, CreateMatrix<double>(32, 32));
+        const uintmax_t byteCount = std::filesystem::file_size(path);
+
+        std::filesystem::resize_file(path, byteCount / 2);
+        EXPECT_THROW(LoadMatrix<double>(path), std::runtime_error);
+
+        {
+            std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+            stream.write("NOMATRIX", 8);
+        }
+        EXPECT_THROW(LoadMatrix<double>(path), std::runtime_error);
+        std::filesystem::remove(path);
+    }
+
+    TEST(BinaryFormatTests, Close_WhenRowsMissing_ShouldThrow)
+    {
+        const std::string path = TemporaryPath("BinaryFormatTests_Incomplete.bin");
+        {
+            BinaryWriter<double> writer(path, BinaryObjectKind::Matrix, 3, 2);
+            const double row[2] = {1.0, 2.0};
+            writer.WriteRow(row);
+            EXPECT_THROW(writer.Close(), std::out_of_range);
+        }
+        std::filesystem::remove(path);
+    }
+}
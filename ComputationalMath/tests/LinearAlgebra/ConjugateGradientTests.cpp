@@ -0,0 +1,126 @@
+#include <LinearAlgebra/ConjugateGradient.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/Preconditioners.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    template <typename P>
+    static void ExpectSolvesLaplacian(const P& preconditioner, const SparseMatrix<double>& matrix, IterativeReport& report)
+    {
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const ColumnVector<double> expected = Factorization::LUSolve(matrix.ToMatrix(), rhs, 1e-12);
+        const ColumnVector<double> actual = ConjugateGradient(matrix, rhs, preconditioner, IterativeSettings{500, 1e-10}, &report);
+
+        EXPECT_TRUE(report.Converged);
+        EXPECT_EQ(report.ResidualNorms.size(), report.Iterations + 1);
+        EXPECT_LE(report.ResidualNorms.back(), 1e-10);
+        for (size_t i = 0; i < expected.GetLength(); i++)
+            EXPECT_NEAR(actual[i], expected[i], 1e-8);
+    }
+
+    TEST(ConjugateGradientTests, ConjugateGradient_WhenPreconditioned_ShouldMatchLUSolve)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(12, 0.01);
+        IterativeReport identity, jacobi, ssor, incompleteCholesky;
+
+        ExpectSolvesLaplacian(IdentityPreconditioner<double>(), matrix, identity);
+        ExpectSolvesLaplacian(JacobiPreconditioner<double>(matrix), matrix, jacobi);
+        ExpectSolvesLaplacian(SsorPreconditioner<double>(matrix, 1.5), matrix, ssor);
+        ExpectSolvesLaplacian(IncompleteCholeskyPreconditioner<double>(matrix), matrix, incompleteCholesky);
+
+        EXPECT_LT(ssor.Iterations, identity.Iterations);
+        EXPECT_LT(incompleteCholesky.Iterations, identity.Iterations);
+    }
+
+    TEST(ConjugateGradientTests, Solve_WhenIterationLimitReached_ShouldNotConverge)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(10, 0.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        ColumnVector<double> x(matrix.GetRowCount());
+        x.Fill(0.0);
+
+        ConjugateGradientSolver<double> solver(matrix.GetRowCount(), IterativeSettings{3, 1e-12});
+        const IterativeReport report = solver.Solve(matrix, rhs, x);
+        EXPECT_FALSE(report.Converged);
+        EXPECT_EQ(report.Iterations, 3);
+        ASSERT_EQ(report.ResidualNorms.size(), 4);
+        EXPECT_DOUBLE_EQ(report.ResidualNorms[0], 1.0);
+        EXPECT_LT(report.ResidualNorms[3], report.ResidualNorms[0]);
+
+        // Restarting from the current iterate continues the iteration
+        const IterativeReport restarted = solver.Solve(matrix, rhs, x);
+        EXPECT_DOUBLE_EQ(restarted.ResidualNorms[0], report.ResidualNorms[3]);
+    }
+
+    TEST(ConjugateGradientTests, Solve_WhenZeroRightHandSide_ShouldReturnZero)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(4, 1.0);
+        ColumnVector<double> rhs(matrix.GetRowCount());
+        rhs.Fill(0.0);
+        ColumnVector<double> x = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+
+        ConjugateGradientSolver<double> solver(matrix.GetRowCount());
+        const IterativeReport report = solver.Solve(matrix, rhs, x);
+        EXPECT_TRUE(report.Converged);
+        EXPECT_EQ(report.Iterations, 0);
+        for (size_t i = 0; i < x.GetLength(); i++)
+            EXPECT_EQ(x[i], 0.0);
+    }
+
+    TEST(ConjugateGradientTests, Solve_WhenDimensionsMismatch_ShouldThrow)
+    {
+        const SparseMatrix<double> matrix = TestHelper::CreateShiftedLaplacian(4, 1.0);
+        ColumnVector<double> x(16);
+        ConjugateGradientSolver<double> solver(16);
+        EXPECT_THROW(solver.Solve(matrix, ColumnVector<double>(15), x), std::invalid_argument);
+        EXPECT_THROW(solver.Solve(TestHelper::CreateShiftedLaplacian(3, 1.0), ColumnVector<double>(16), x), std::invalid_argument);
+    }
+
+    TEST(ConjugateGradientTests, IncompleteCholesky_WhenTridiagonal_ShouldEqualCholesky)
+    {
+        // A tridiagonal matrix has no fill-in, thus IC(0) is the exact Cholesky factor
+        const size_t n = 8;
+        std::vector<SparseEntry<double>> entries;
+        for (SparseIndex i = 0; i < n; i++)
+        {
+            entries.push_back({i, i, 2.5});
+            if (i > 0)
+                entries.push_back({i, i - 1, -1.0});
+            if (i + 1 < n)
+                entries.push_back({i, i + 1, -1.0});
+        }
+        const SparseMatrix<double> matrix(n, n, entries);
+        const IncompleteCholeskyPreconditioner<double> preconditioner(matrix);
+        const Matrix<double> factor = preconditioner.GetFactor().ToMatrix();
+        EXPECT_EQ(preconditioner.GetFactor().GetNonZeroCount(), 2 * n - 1);
+
+        const Matrix<double> product = factor * factor.Transposed();
+        const Matrix<double> dense = matrix.ToMatrix();
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++)
+                EXPECT_NEAR(product(i, j), dense(i, j), 1e-12);
+
+        // Applying M^-1 of an exact factorization solves the system
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(n);
+        ColumnVector<double> z(n);
+        preconditioner.Apply(rhs, z);
+        const ColumnVector<double> residual = dense * z - rhs;
+        EXPECT_LE(residual.Norm2(), 1e-12);
+    }
+
+    TEST(ConjugateGradientTests, Preconditioners_WhenInvalidMatrix_ShouldThrow)
+    {
+        const SparseMatrix<double> indefinite(2, 2, std::vector<SparseEntry<double>>{{0, 0, 1.0}, {0, 1, 2.0}, {1, 0, 2.0}, {1, 1, 1.0}});
+        const SparseMatrix<double> missingDiagonal(2, 2, std::vector<SparseEntry<double>>{{0, 0, 1.0}, {1, 0, 1.0}});
+
+        EXPECT_THROW(IncompleteCholeskyPreconditioner<double>{indefinite}, std::invalid_argument);
+        EXPECT_THROW(IncompleteCholeskyPreconditioner<double>{missingDiagonal}, std::invalid_argument);
+        EXPECT_THROW(JacobiPreconditioner<double>{missingDiagonal}, std::invalid_argument);
+        EXPECT_THROW(SsorPreconditioner<double>{missingDiagonal}, std::invalid_argument);
+        EXPECT_THROW(SsorPreconditioner<double>(indefinite, 2.0), std::invalid_argument);
+        EXPECT_THROW(JacobiPreconditioner<double>{SparseMatrix<double>(2, 3)}, std::invalid_argument);
+    }
+}
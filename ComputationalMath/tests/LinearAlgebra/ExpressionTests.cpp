@@ -0,0 +1,118 @@
+#include <LinearAlgebra/Expression.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/VectorBase.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    TEST(ExpressionTests, MatrixExpression_WhenChained_ShouldEvaluateElementwise)
+    {
+        Matrix<float> a = {{1, 2, 3}, {4, 5, 6}};
+        Matrix<float> b = {{6, 5, 4}, {3, 2, 1}};
+        Matrix<float> c = {{1, 1, 1}, {2, 2, 2}};
+
+        Matrix<float> result = a + b * 0.5f - 2.0f * c;
+
+        Matrix<float> expected = {{2, 2.5, 3}, {1.5, 2, 2.5}};
+        EXPECT_TRUE(result.ElementwiseCompare(expected, 1e-6f));
+    }
+
+    TEST(ExpressionTests, MatrixExpression_WhenNestedScalarProducts_ShouldMultiplyScalars)
+    {
+        Matrix<int> a = {{1, 2}, {3, 4}};
+
+        Matrix<int> result = 2 * (a + a) * 3;
+
+        Matrix<int> expected = {{12, 24}, {36, 48}};
+        EXPECT_TRUE(result.ElementwiseEquals(expected));
+    }
+
+    TEST(ExpressionTests, MatrixAssignment_WhenExpressionContainsDestination_ShouldUpdateInPlace)
+    {
+        Matrix<int> a = {{1, 2}, {3, 4}};
+        Matrix<int> b = {{1, 1}, {1, 1}};
+        const int* storage = a.Data();
+
+        a = a + b * 2;
+
+        Matrix<int> expected = {{3, 4}, {5, 6}};
+        EXPECT_TRUE(a.ElementwiseEquals(expected));
+        EXPECT_EQ(a.Data(), storage);
+    }
+
+    TEST(ExpressionTests, MatrixAssignment_WhenDimensionsDiffer_ShouldReallocate)
+    {
+        Matrix<int> a(1, 1);
+        Matrix<int> b = {{1, 2, 3}, {4, 5, 6}};
+
+        a = b - b;
+
+        EXPECT_EQ(a.GetRowCount(), 2);
+        EXPECT_EQ(a.GetColumnCount(), 3);
+        Matrix<int> expected(2, 3);
+        expected.Fill(0);
+        EXPECT_TRUE(a.ElementwiseEquals(expected));
+    }
+
+    TEST(ExpressionTests, MatrixExpression_WhenInnerDimensionsMismatch_ShouldThrow)
+    {
+        Matrix<int> a(2, 3);
+        Matrix<int> b(2, 3);
+        Matrix<int> c(3, 2);
+
+        EXPECT_THROW(a + b * 2 - c, std::invalid_argument);
+    }
+
+    TEST(ExpressionTests, ColumnExpression_WhenChained_ShouldEvaluateElementwise)
+    {
+        ColumnVector<double> x = {1, 2, 3};
+        ColumnVector<double> y = {3, 2, 1};
+
+        ColumnVector<double> result = 2.0 * x - y * 0.5 + x;
+
+        ColumnVector<double> expected = {1.5, 5, 8.5};
+        EXPECT_TRUE(result.ElementwiseCompare(expected, 1e-12f));
+    }
+
+    TEST(ExpressionTests, ColumnAssignment_WhenExpressionContainsDestination_ShouldUpdateInPlace)
+    {
+        ColumnVector<int> x = {1, 2, 3};
+        ColumnVector<int> y = {1, 1, 1};
+        const int* storage = x.Data();
+
+        x = x - y * 3;
+
+        ColumnVector<int> expected = {-2, -1, 0};
+        EXPECT_TRUE(x.ElementwiseEquals(expected));
+        EXPECT_EQ(x.Data(), storage);
+    }
+
+    TEST(ExpressionTests, RowExpression_WhenChained_ShouldEvaluateElementwise)
+    {
+        RowVector<int> x = {1, 2, 3};
+        RowVector<int> y = {4, 5, 6};
+
+        RowVector<int> result = x + y - x * 2;
+
+        RowVector<int> expected = {3, 3, 3};
+        EXPECT_TRUE(result.ElementwiseEquals(expected));
+    }
+
+    TEST(ExpressionTests, InnerProduct_WhenOperandsAreExpressions_ShouldNotRequireTemporaries)
+    {
+        RowVector<int> row = {1, 2, 3};
+        ColumnVector<int> column = {4, 5, 6};
+
+        int innerProduct = 2 * row * (column + column);
+
+        EXPECT_EQ(innerProduct, 128);
+    }
+
+    TEST(ExpressionTests, InnerProduct_WhenLengthMismatch_ShouldThrow)
+    {
+        RowVector<int> row = {1, 2, 3};
+        ColumnVector<int> column = {4, 5};
+
+        EXPECT_THROW(row * (column - column), std::invalid_argument);
+    }
+}
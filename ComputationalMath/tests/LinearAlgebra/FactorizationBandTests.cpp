@@ -0,0 +1,109 @@
+#include <Geometry/MeshGenerator.hpp>
+#include <Geometry/MeshOrdering.hpp>
+#include <LinearAlgebra/FactorizationBand.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace LinearAlgebra::Factorization
+{
+    // Non-symmetric band matrix of which the diagonal is small, such that partial pivoting swaps rows
+    static BandMatrix<double> CreateNonSymmetricBandMatrix(const size_t size, const size_t lower, const size_t upper)
+    {
+        BandMatrix<double> matrix(size, lower, upper);
+        TestHelper::RandomGenerator random(12345);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = i > lower ? i - lower : 0; j <= std::min(size - 1, i + upper); j++)
+            {
+                matrix(i, j) = random.NextValue();
+            }
+            matrix(i, i) *= 0.01;
+        }
+        return matrix;
+    }
+
+    TEST(FactorizationBandTests, BandLUFactorization_WhenSolving_ShouldEqualLUSolve)
+    {
+        for (const auto& [lower, upper] : {std::pair<size_t, size_t>{3, 5}, {4, 2}, {1, 1}})
+        {
+            const BandMatrix<double> matrix = CreateNonSymmetricBandMatrix(120, lower, upper);
+            const Matrix<double> dense = matrix.ToMatrix();
+            const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(120);
+
+            const BandLUFactorization<double> lu(matrix, 1e-12);
+            EXPECT_EQ(lu.GetFactor().GetUpperBandwidth(), upper + lower);
+            // The random band matrices are badly conditioned, compare relative to the size of the solution
+            const ColumnVector<double> solution = lu.Solve(rhs);
+            const ColumnVector<double> expected = LUSolve(dense, rhs, 1e-12);
+            double scale = 0;
+            for (size_t i = 0; i < 120; i++)
+                scale = std::max(scale, std::abs(expected[i]));
+            for (size_t i = 0; i < 120; i++)
+                EXPECT_NEAR(solution[i], expected[i], 1e-10 * scale);
+            EXPECT_TRUE((matrix * solution).ElementwiseCompare(rhs, 1e-4f));
+            EXPECT_NEAR(lu.Determinant() / LUFactorization<double>(dense, 1e-12).Determinant(), 1.0, 1e-8);
+            size_t swapCount = 0;
+            for (size_t j = 0; j < lu.GetRowSwaps().size(); j++)
+                swapCount += lu.GetRowSwaps()[j] != j ? 1 : 0;
+            EXPECT_GT(swapCount, 0);
+
+            Matrix<double> rhsMatrix(120, 2);
+            for (size_t i = 0; i < 120; i++)
+            {
+                rhsMatrix(i, 0) = rhs[i];
+                rhsMatrix(i, 1) = -rhs[i];
+            }
+            const Matrix<double> solutions = lu.Solve(rhsMatrix);
+            for (size_t i = 0; i < 120; i++)
+            {
+                EXPECT_EQ(solutions(i, 0), solution[i]);
+                EXPECT_EQ(solutions(i, 1), -solution[i]);
+            }
+        }
+    }
+
+    TEST(FactorizationBandTests, BandLUFactorization_WhenSingular_ShouldThrow)
+    {
+        BandMatrix<double> matrix = CreateNonSymmetricBandMatrix(30, 2, 2);
+        for (size_t i = 8; i <= 12; i++)
+            matrix(i, 10) = 0.0;
+        EXPECT_THROW(BandLUFactorization<double>(matrix, 1e-12), std::invalid_argument);
+        EXPECT_THROW(BandLUFactorization<double>(SparseMatrix<double>(3, 4), 1e-12), std::invalid_argument);
+    }
+
+    TEST(FactorizationBandTests, BandCholeskyFactorization_WhenFemMatrix_ShouldEqualLUSolve)
+    {
+        // After reverse Cuthill-McKee, the band is about the number of cells along the short side
+        Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 4, 0, 1), 40, 8);
+        Geometry::ReorderMesh(mesh, Geometry::VertexOrdering::ReverseCuthillMcKee);
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(mesh, 1.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const ColumnVector<double> expected = LUSolve(matrix.ToMatrix(), rhs, 1e-12);
+
+        const BandCholeskyFactorization<double> cholesky(matrix, 1e-12);
+        EXPECT_LE(cholesky.GetFactor().GetLowerBandwidth(), 10);
+        EXPECT_EQ(cholesky.GetFactor().GetUpperBandwidth(), 0);
+        EXPECT_TRUE(cholesky.Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+        EXPECT_NEAR(cholesky.Determinant() / LUFactorization<double>(matrix.ToMatrix(), 1e-12).Determinant(), 1.0, 1e-8);
+
+        // Both factorizations of the same band agree
+        EXPECT_TRUE(BandLUFactorization<double>(matrix, 1e-12).Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+        EXPECT_TRUE(BandCholeskyFactorization<double>(BandMatrix<double>(matrix), 1e-12).Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+    }
+
+    TEST(FactorizationBandTests, BandCholeskyFactorization_WhenNotPositiveDefinite_ShouldThrow)
+    {
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 6, 6), -10.0);
+        EXPECT_THROW(BandCholeskyFactorization<double>(matrix, 1e-12), std::invalid_argument);
+        EXPECT_THROW(BandCholeskyFactorization<double>(SparseMatrix<double>(3, 4), 1e-12), std::invalid_argument);
+
+        ColumnVector<double> rhs(3);
+        const BandCholeskyFactorization<double> cholesky(TestHelper::AssembleOperator(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 2, 2), 1.0), 1e-12);
+        EXPECT_THROW(cholesky.SolveInPlace(rhs), std::invalid_argument);
+    }
+}
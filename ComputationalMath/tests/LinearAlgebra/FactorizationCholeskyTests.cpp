@@ -0,0 +1,132 @@
+#include <LinearAlgebra/FactorizationCholesky.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Factorization
+{
+    // A = B B^T + size * I, which is symmetric positive definite
+    static Matrix<double> CreateSpdTestMatrix(const size_t size)
+    {
+        const Matrix<double> factor = TestHelper::CreateRandomMatrix(size, 12345);
+        Matrix<double> matrix = factor * factor.Transposed();
+        for (size_t i = 0; i < size; i++)
+        {
+            matrix(i, i) += static_cast<double>(size);
+        }
+        return matrix;
+    }
+
+    TEST(FactorizationCholeskyTests, CholeskyFactorization_WhenSpd_ShouldReproduceMatrix)
+    {
+        for (const size_t size : {1, 5, 64, 150})
+        {
+            const Matrix<double> matrix = CreateSpdTestMatrix(size);
+            const CholeskyFactorization<double> cholesky(matrix, 1e-12);
+
+            Matrix<double> lower(size, size);
+            lower.Fill(0);
+            for (size_t i = 0; i < size; i++)
+            {
+                for (size_t j = 0; j <= i; j++)
+                {
+                    lower(i, j) = cholesky.GetFactor()(i, j);
+                }
+            }
+            EXPECT_TRUE((lower * lower.Transposed()).ElementwiseCompare(matrix, 1e-9f)) << "Size " << size;
+        }
+    }
+
+    TEST(FactorizationCholeskyTests, CholeskyFactorization_WhenSolving_ShouldEqualLUSolve)
+    {
+        const size_t size = 2 * SymmetricMatrix<double>::TileSize + 13;
+        const Matrix<double> matrix = CreateSpdTestMatrix(size);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(size);
+
+        const CholeskyFactorization<double> cholesky(SymmetricMatrix<double>(matrix), 1e-12);
+        const ColumnVector<double> expected = LUSolve(matrix, rhs, 1e-12);
+
+        EXPECT_TRUE(cholesky.Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+
+        Matrix<double> rhsMatrix(size, 2);
+        for (size_t i = 0; i < size; i++)
+        {
+            rhsMatrix(i, 0) = rhs[i];
+            rhsMatrix(i, 1) = 2 * rhs[i];
+        }
+        cholesky.SolveInPlace(rhsMatrix);
+        for (size_t i = 0; i < size; i++)
+        {
+            EXPECT_NEAR(rhsMatrix(i, 0), expected[i], 1e-9);
+            EXPECT_NEAR(rhsMatrix(i, 1), 2 * expected[i], 1e-9);
+        }
+    }
+
+    TEST(FactorizationCholeskyTests, CholeskyFactorization_WhenNotPositiveDefinite_ShouldThrow)
+    {
+        Matrix<double> matrix = CreateSpdTestMatrix(100);
+        matrix(80, 80) = -1.0;
+        EXPECT_THROW(CholeskyFactorization<double>(matrix, 1e-12), std::invalid_argument);
+        EXPECT_THROW(CholeskyFactorization<double>(Matrix<double>(3, 2), 1e-12), std::invalid_argument);
+    }
+
+    TEST(FactorizationCholeskyTests, LdltFactorization_WhenIndefinite_ShouldSolve)
+    {
+        // Quasi-definite [-E F; F^T G] with E and G positive definite, which has an LDL^T factorization without pivoting
+        const size_t size = 150;
+        Matrix<double> matrix = CreateSpdTestMatrix(size);
+        for (size_t i = 0; i < size / 2; i++)
+        {
+            for (size_t j = 0; j < size / 2; j++)
+            {
+                matrix(i, j) = -matrix(i, j);
+            }
+        }
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(size);
+
+        const LdltFactorization<double> ldlt(matrix, 1e-12);
+        const ColumnVector<double> solution = ldlt.Solve(rhs);
+
+        EXPECT_TRUE((matrix * solution).ElementwiseCompare(rhs, 1e-8f));
+    }
+
+    TEST(FactorizationCholeskyTests, Determinant_WhenFactorized_ShouldEqualLuDeterminant)
+    {
+        // Small enough for the determinant to stay within range
+        Matrix<double> matrix = CreateSpdTestMatrix(12);
+        const double expected = Determinant(matrix, 1e-12);
+        EXPECT_NEAR(CholeskyFactorization<double>(matrix, 1e-12).Determinant() / expected, 1.0, 1e-10);
+        EXPECT_NEAR(LdltFactorization<double>(matrix, 1e-12).Determinant() / expected, 1.0, 1e-10);
+
+        for (size_t i = 0; i < 6; i++)
+        {
+            for (size_t j = 0; j < 6; j++)
+            {
+                matrix(i, j) = -matrix(i, j);
+            }
+        }
+        EXPECT_NEAR(LdltFactorization<double>(matrix, 1e-12).Determinant() / Determinant(matrix, 1e-12), 1.0, 1e-10);
+    }
+
+    TEST(FactorizationCholeskyTests, LdltFactorization_WhenSpd_ShouldEqualCholesky)
+    {
+        const size_t size = 100;
+        const Matrix<double> matrix = CreateSpdTestMatrix(size);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(size);
+
+        const LdltFactorization<double> ldlt(matrix, 1e-12);
+        const CholeskyFactorization<double> cholesky(matrix, 1e-12);
+        EXPECT_TRUE(ldlt.Solve(rhs).ElementwiseCompare(cholesky.Solve(rhs), 1e-10f));
+
+        // L_ldlt * sqrt(D) = L_cholesky
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < i; j++)
+            {
+                EXPECT_NEAR(ldlt.GetFactor()(i, j) * std::sqrt(ldlt.GetFactor()(j, j)), cholesky.GetFactor()(i, j), 1e-10);
+            }
+        }
+    }
+}
@@ -2,6 +2,8 @@
 #include <LinearAlgebra/Matrix.hpp>
 #include <gtest/gtest.h>
 
+#include "TestHelper.hpp"
+
 namespace LinearAlgebra::Factorization
 {
     static auto FacorizationMatricesSets = ::testing::Values(
@@ -296,4 +298,166 @@ namespace LinearAlgebra::Factorization
         EXPECT_NEAR(determinant, expectedDeterminant, 1e-5f);
     }
     INSTANTIATE_TEST_CASE_P(DeterminantMatrix_WhenSystemIsGiven_ShouldComputeCorrectly, DeterminantMatrixTests, DeterminantMatrixSets);
-}
\ No newline at end of file
+
+    TEST(FactorizationLUTests, BlockedPluFactorization_WhenBlockDoesNotDivideSize_ShouldEqualUnblocked)
+    {
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(150, 12345);
+
+        FactorizationResult<double> unblocked = UnblockedPluFactorization(matrix, 1e-12);
+        for (size_t blockSize : {1, 16, 37, 150, 200})
+        {
+            FactorizationResult<double> blocked = BlockedPluFactorization(matrix, 1e-12, blockSize);
+
+            EXPECT_EQ(blocked.PermutationCount, unblocked.PermutationCount);
+            EXPECT_TRUE(std::equal(unblocked.Pivots, unblocked.Pivots + matrix.GetRowCount(), blocked.Pivots));
+            EXPECT_TRUE(blocked.Factorization.ElementwiseCompare(unblocked.Factorization, 1e-9f));
+        }
+    }
+
+    TEST(FactorizationLUTests, PluFactorization_WhenLargerThanBlock_ShouldSatisfyPermutedProduct)
+    {
+        const size_t size = 2 * LuBlocking<double>::BlockSize + 13;
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(size, 12345);
+
+        FactorizationResult<double> results = PluFactorization(matrix, 1e-12);
+        Matrix<double> LU = ExtractLowerMatrix(results.Factorization) * ExtractUpperMatrix(results.Factorization);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                EXPECT_NEAR(LU(i, j), matrix(results.Pivots[i], j), 1e-10);
+            }
+        }
+        EXPECT_NEAR(Determinant(results), Determinant(UnblockedPluFactorization(matrix, 1e-12)), 1e-8 * std::abs(Determinant(results)));
+    }
+
+    TEST(FactorizationLUTests, BlockedPluFactorization_WhenDegenerateOrNonSquare_ShouldThrow)
+    {
+        Matrix<double> degenerate = TestHelper::CreateRandomMatrix(100, 12345);
+        for (size_t i = 0; i < 100; i++)
+        {
+            degenerate(i, 70) = 2 * degenerate(i, 3);
+        }
+
+        EXPECT_THROW(BlockedPluFactorization(degenerate, 1e-10, 32), std::invalid_argument);
+        EXPECT_THROW(BlockedPluFactorization(Matrix<double>(5, 3), 1e-10), std::invalid_argument);
+        EXPECT_THROW(BlockedPluFactorization(TestHelper::CreateRandomMatrix(5, 12345), 1e-10, 0), std::invalid_argument);
+    }
+
+    TEST(FactorizationLUTests, TiledPluFactorization_WhenTileDoesNotDivideSize_ShouldEqualUnblocked)
+    {
+        const size_t initialThreadCount = Parallel::GetThreadCount();
+        Parallel::SetThreadCount(4);
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(150, 12345);
+
+        FactorizationResult<double> unblocked = UnblockedPluFactorization(matrix, 1e-12);
+        for (size_t tileSize : {1, 16, 37, 100, 150, 200})
+        {
+            TaskGraphProfile profile;
+            FactorizationResult<double> tiled = TiledPluFactorization(matrix, 1e-12, tileSize, &profile);
+
+            EXPECT_EQ(tiled.PermutationCount, unblocked.PermutationCount);
+            EXPECT_TRUE(std::equal(unblocked.Pivots, unblocked.Pivots + matrix.GetRowCount(), tiled.Pivots));
+            EXPECT_TRUE(tiled.Factorization.ElementwiseCompare(unblocked.Factorization, 1e-9f));
+
+            const size_t tileCount = (matrix.GetRowCount() + tileSize - 1) / tileSize;
+            const size_t expectedTaskCount = tileCount + (tileCount - 1) + (tileCount - 1) * tileCount * (2 * tileCount - 1) / 6 + (tileCount - 1) * tileCount / 2;
+            EXPECT_EQ(profile.Tasks.size(), expectedTaskCount);
+            EXPECT_FALSE(profile.CriticalPath.empty());
+        }
+        Parallel::SetThreadCount(initialThreadCount);
+    }
+
+    TEST(FactorizationLUTests, TiledPluFactorization_WhenDegenerateOrNonSquare_ShouldThrow)
+    {
+        Matrix<double> degenerate = TestHelper::CreateRandomMatrix(100, 12345);
+        for (size_t i = 0; i < 100; i++)
+        {
+            degenerate(i, 70) = 2 * degenerate(i, 3);
+        }
+
+        EXPECT_THROW(TiledPluFactorization(degenerate, 1e-10, 32), std::invalid_argument);
+        EXPECT_THROW(TiledPluFactorization(Matrix<double>(5, 3), 1e-10), std::invalid_argument);
+        EXPECT_THROW(TiledPluFactorization(TestHelper::CreateRandomMatrix(5, 12345), 1e-10, 0), std::invalid_argument);
+    }
+
+    TEST(FactorizationLUTests, LUFactorization_WhenSolvingSeveralRightHandSides_ShouldEqualLUSolve)
+    {
+        const size_t size = 2 * LuBlocking<double>::BlockSize + 13;
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(size, 12345);
+        const LUFactorization<double> factorization(matrix, 1e-12);
+
+        for (size_t seed = 0; seed < 3; seed++)
+        {
+            ColumnVector<double> rhs(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                rhs[i] = static_cast<double>((i * 7 + seed * 3) % 11) - 5;
+            }
+
+            const ColumnVector<double> solution = factorization.Solve(rhs);
+            const ColumnVector<double> product = matrix * solution;
+            for (size_t i = 0; i < size; i++)
+            {
+                EXPECT_NEAR(product[i], rhs[i], 1e-9);
+            }
+
+            ColumnVector<double> inPlace(rhs);
+            factorization.SolveInPlace(inPlace);
+            EXPECT_TRUE(inPlace.ElementwiseCompare(solution, 1e-12f));
+        }
+        EXPECT_NEAR(factorization.Determinant(), Determinant(UnblockedPluFactorization(matrix, 1e-12)), 1e-8 * std::abs(factorization.Determinant()));
+    }
+
+    TEST(FactorizationLUTests, LUFactorization_WhenMatrixRightHandSide_ShouldSolveEveryColumn)
+    {
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(40, 12345);
+        Matrix<double> rhs(40, 7);
+        for (size_t i = 0; i < 40; i++)
+        {
+            for (size_t j = 0; j < 7; j++)
+            {
+                rhs(i, j) = static_cast<double>((i * 5 + j * 3) % 13) - 6;
+            }
+        }
+
+        LUFactorization<double> factorization(matrix, 1e-12);
+        const Matrix<double> solution = factorization.Solve(rhs);
+        EXPECT_TRUE((matrix * solution).ElementwiseCompare(rhs, 1e-9f));
+
+        factorization.SolveInPlace(rhs);
+        EXPECT_TRUE(rhs.ElementwiseCompare(solution, 1e-12f));
+    }
+
+    TEST(FactorizationLUTests, LUFactorization_WhenCopiedOrMoved_ShouldKeepFactors)
+    {
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(20, 12345);
+        ColumnVector<double> rhs(20);
+        rhs.Fill(1.0);
+
+        LUFactorization<double> original(matrix, 1e-12);
+        const ColumnVector<double> expected = original.Solve(rhs);
+        const LUFactorization<double> copy(original);
+        LUFactorization<double> moved(std::move(original));
+        EXPECT_TRUE(copy.Solve(rhs).ElementwiseCompare(expected, 1e-12f));
+        EXPECT_TRUE(std::equal(copy.GetFactorization().Pivots, copy.GetFactorization().Pivots + 20, moved.GetFactorization().Pivots));
+        EXPECT_NE(copy.GetFactorization().Pivots, moved.GetFactorization().Pivots);
+        LUFactorization<double> assigned(TestHelper::CreateRandomMatrix(5, 12345), 1e-12);
+        assigned = std::move(moved);
+
+        EXPECT_TRUE(assigned.Solve(rhs).ElementwiseCompare(expected, 1e-12f));
+        EXPECT_EQ(assigned.GetSize(), 20);
+    }
+
+    TEST(FactorizationLUTests, LUFactorization_WhenDimensionsMismatch_ShouldThrow)
+    {
+        EXPECT_THROW(LUFactorization<double>(Matrix<double>(5, 3), 1e-10), std::invalid_argument);
+
+        const LUFactorization<double> factorization(TestHelper::CreateRandomMatrix(5, 12345), 1e-10);
+        ColumnVector<double> vector(4);
+        Matrix<double> matrix(4, 2);
+        EXPECT_THROW(factorization.SolveInPlace(vector), std::invalid_argument);
+        EXPECT_THROW(factorization.SolveInPlace(matrix), std::invalid_argument);
+    }
+}
@@ -0,0 +1,154 @@
+#include <LinearAlgebra/FactorizationMixedPrecision.hpp>
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Factorization
+{
+    // Random entries with a graded diagonal, such that the condition number grows with the grading
+    static Matrix<double> CreateGradedMatrix(const size_t size, const double grading)
+    {
+        Matrix<double> matrix = TestHelper::CreateRandomMatrix(size, 42);
+        for (size_t i = 0; i < size; i++)
+        {
+            matrix(i, i) += static_cast<double>(size) * std::pow(grading, -static_cast<double>(i) / static_cast<double>(size - 1));
+        }
+        return matrix;
+    }
+
+    static Matrix<double> CreateHilbertMatrix(const size_t size)
+    {
+        Matrix<double> matrix(size, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                matrix(i, j) = 1.0 / static_cast<double>(i + j + 1);
+            }
+        }
+        return matrix;
+    }
+
+    static double MaxError(const ColumnVector<double>& actual, const ColumnVector<double>& expected)
+    {
+        double error = 0;
+        for (size_t i = 0; i < actual.GetLength(); i++)
+        {
+            error = std::max(error, std::abs(actual[i] - expected[i]));
+        }
+        return error;
+    }
+
+    // Normwise backward error |b - Ax|_inf / (|A|_inf |x|_inf + |b|_inf), as in RefinementReport
+    static double BackwardError(const Matrix<double>& matrix, const ColumnVector<double>& rhs, const ColumnVector<double>& solution)
+    {
+        const ColumnVector<double> product = matrix * solution;
+        double residualNorm = 0, matrixNorm = 0, solutionNorm = 0, rhsNorm = 0;
+        for (size_t i = 0; i < rhs.GetLength(); i++)
+        {
+            double rowSum = 0;
+            for (size_t j = 0; j < matrix.GetColumnCount(); j++)
+            {
+                rowSum += std::abs(matrix(i, j));
+            }
+            residualNorm = std::max(residualNorm, std::abs(rhs[i] - product[i]));
+            matrixNorm = std::max(matrixNorm, rowSum);
+            solutionNorm = std::max(solutionNorm, std::abs(solution[i]));
+            rhsNorm = std::max(rhsNorm, std::abs(rhs[i]));
+        }
+        return residualNorm / (matrixNorm * solutionNorm + rhsNorm);
+    }
+
+    TEST(FactorizationMixedPrecisionTests, MixedPrecisionLUSolve_WhenIllConditioned_ShouldReachDoubleAccuracy)
+    {
+        const size_t size = 150;
+        const Matrix<double> matrix = CreateGradedMatrix(size, 1e4);
+        ColumnVector<double> exact(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            exact[i] = std::sin(static_cast<double>(i));
+        }
+        const ColumnVector<double> rhs = matrix * exact;
+
+        RefinementReport report;
+        const ColumnVector<double> refined = MixedPrecisionLUSolve<float>(matrix, rhs, 1e-12f, &report);
+        const ColumnVector<double> floatSolution = ConvertVector<double>(LUSolve(ConvertMatrix<float>(matrix), ConvertVector<float>(rhs), 1e-12f));
+
+        EXPECT_TRUE(report.Converged) << report;
+        EXPECT_LT(MaxError(refined, exact), 1e-10);
+        EXPECT_LT(MaxError(refined, exact), 1e-4 * MaxError(floatSolution, exact)) << "Refinement should improve the float solution";
+    }
+
+    TEST(FactorizationMixedPrecisionTests, Solve_WhenConverged_ShouldReportDecreasingResiduals)
+    {
+        const Matrix<double> matrix = CreateGradedMatrix(80, 1e2);
+        ColumnVector<double> rhs(80);
+        rhs.Fill(1.0);
+
+        const MixedPrecisionLUFactorization<float, double> factorization(matrix, 1e-12f);
+        RefinementReport report;
+        factorization.Solve(rhs, &report);
+
+        ASSERT_TRUE(report.Converged) << report;
+        ASSERT_EQ(report.ResidualNorms.size(), report.Iterations + 1);
+        EXPECT_GT(report.Iterations, 0) << "The float solution alone should not reach double accuracy";
+        for (size_t i = 1; i < report.ResidualNorms.size(); i++)
+        {
+            EXPECT_LT(report.ResidualNorms[i], report.ResidualNorms[i - 1]);
+        }
+        EXPECT_LE(report.ResidualNorms.back(), std::sqrt(80.0) * std::numeric_limits<double>::epsilon());
+    }
+
+    TEST(FactorizationMixedPrecisionTests, Solve_WhenTooIllConditionedForFloat_ShouldReportNotConverged)
+    {
+        // The condition number of the 10 x 10 Hilbert matrix, about 1.6e13, exceeds 1 / epsilon of float
+        const Matrix<double> matrix = CreateHilbertMatrix(10);
+        ColumnVector<double> rhs(10);
+        rhs.Fill(1.0);
+
+        RefinementReport report;
+        MixedPrecisionLUSolve<float>(matrix, rhs, 0.0f, &report);
+
+        EXPECT_FALSE(report.Converged) << report;
+        EXPECT_LT(report.Iterations, RefinementSettings().MaxIterations) << "Stagnation should stop the refinement early";
+    }
+
+    TEST(FactorizationMixedPrecisionTests, Solve_WhenCorrectionIncreasesBackwardError_ShouldReturnBestIterate)
+    {
+        // For the 13 x 13 Hilbert matrix, the first correction of the float solution increases the backward error
+        const Matrix<double> matrix = CreateHilbertMatrix(13);
+        ColumnVector<double> rhs(13);
+        rhs.Fill(1.0);
+
+        RefinementReport report;
+        const ColumnVector<double> solution = MixedPrecisionLUSolve<float>(matrix, rhs, 0.0f, &report);
+
+        ASSERT_FALSE(report.Converged) << report;
+        const double bestBackwardError = *std::min_element(report.ResidualNorms.begin(), report.ResidualNorms.end());
+        ASSERT_LT(bestBackwardError, report.ResidualNorms.back()) << report;
+        EXPECT_NEAR(BackwardError(matrix, rhs, solution), bestBackwardError, 1e-3 * bestBackwardError);
+    }
+
+    TEST(FactorizationMixedPrecisionTests, MixedPrecisionLUSolve_WhenFloatSystem_ShouldEqualRoundedDoubleSolution)
+    {
+        const size_t size = 60;
+        const Matrix<float> matrix = ConvertMatrix<float>(CreateGradedMatrix(size, 1e3));
+        ColumnVector<float> rhs(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            rhs[i] = static_cast<float>(i % 7) - 3.0f;
+        }
+
+        const ColumnVector<float> expected = ConvertVector<float>(LUSolve(ConvertMatrix<double>(matrix), ConvertVector<double>(rhs), 1e-12));
+        const ColumnVector<float> actual = MixedPrecisionLUSolve(matrix, rhs, 1e-12f);
+        EXPECT_TRUE(actual.ElementwiseCompare(expected, 1e-7f));
+    }
+
+    TEST(FactorizationMixedPrecisionTests, MixedPrecisionLUSolve_WhenDimensionsMismatch_ShouldThrow)
+    {
+        EXPECT_THROW(MixedPrecisionLUSolve<float>(Matrix<double>(5, 3), ColumnVector<double>(5), 1e-5f), std::invalid_argument);
+        EXPECT_THROW(MixedPrecisionLUSolve<float>(Matrix<double>(5, 5), ColumnVector<double>(3), 1e-5f), std::invalid_argument);
+    }
+}
@@ -0,0 +1,69 @@
+#include <LinearAlgebra/FactorizationOutOfCore.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Factorization
+{
+    TEST(FactorizationOutOfCoreTests, OutOfCoreMatrix_WhenCopiedFromMatrix_ShouldReproduceMatrix)
+    {
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(70, 7);
+        const OutOfCoreMatrix<double> outOfCore(matrix, 32);
+
+        EXPECT_EQ(outOfCore.GetTileCount(), 3);
+        EXPECT_EQ(outOfCore.GetPaddedSize(), 96);
+        EXPECT_TRUE(outOfCore.ToMatrix().ElementwiseEquals(matrix));
+        EXPECT_EQ(outOfCore(80, 80), 1.0) << "Padding should be the identity";
+        EXPECT_EQ(outOfCore(80, 10), 0.0) << "Padding should be the identity";
+    }
+
+    TEST(FactorizationOutOfCoreTests, OutOfCoreLUFactorization_WhenSolving_ShouldEqualLUSolve)
+    {
+        // 3 1/2 tile columns, and a panel block size that does not divide the tile size
+        const size_t size = 250;
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(size, 7);
+        ColumnVector<double> rhs(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            rhs[i] = static_cast<double>(i % 9) - 4.0;
+        }
+
+        const OutOfCoreLUFactorization<double> factorization(OutOfCoreMatrix<double>(matrix, 72), 1e-12);
+        const ColumnVector<double> expected = LUSolve(matrix, rhs, 1e-12);
+        EXPECT_TRUE(factorization.Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+    }
+
+    TEST(FactorizationOutOfCoreTests, OutOfCoreLUFactorization_WhenFactorized_ShouldEqualPluFactors)
+    {
+        // Partial pivoting picks the same pivots as PluFactorization, thus the factors are the same up to rounding
+        const size_t size = 130;
+        const Matrix<double> matrix = TestHelper::CreateRandomMatrix(size, 7);
+
+        const OutOfCoreLUFactorization<double> factorization(OutOfCoreMatrix<double>(matrix, 64), 1e-12);
+        const FactorizationResult<double> expected = PluFactorization(matrix, 1e-12);
+        EXPECT_TRUE(factorization.GetFactorization().ToMatrix().ElementwiseCompare(expected.Factorization, 1e-9f));
+    }
+
+    TEST(FactorizationOutOfCoreTests, OutOfCoreLUFactorization_WhenFactorized_ShouldWriteEveryTileAboutOnce)
+    {
+        const size_t size = 256;
+        const size_t tileSize = 32;
+        const OutOfCoreLUFactorization<double> factorization(OutOfCoreMatrix<double>(TestHelper::CreateRandomMatrix(size, 7), tileSize), 1e-12);
+
+        const OutOfCoreStatistics& statistics = factorization.GetStatistics();
+        const size_t matrixBytes = size * size * sizeof(double);
+        EXPECT_LE(statistics.BytesWritten, 2 * matrixBytes) << "Left-looking schedule should write every tile once, plus the row swap pass";
+        EXPECT_GT(statistics.BytesRead, statistics.BytesWritten);
+        EXPECT_NEAR(statistics.Flops, 2.0 / 3.0 * size * size * size, 0.1 * size * size * size);
+    }
+
+    TEST(FactorizationOutOfCoreTests, OutOfCoreLUFactorization_WhenSingular_ShouldThrow)
+    {
+        Matrix<double> matrix = TestHelper::CreateRandomMatrix(40, 7);
+        for (size_t i = 0; i < 40; i++)
+        {
+            matrix(i, 25) = 2.0 * matrix(i, 3);
+        }
+        EXPECT_THROW(OutOfCoreLUFactorization<double>(OutOfCoreMatrix<double>(matrix, 16), 1e-10), std::invalid_argument);
+    }
+}
@@ -0,0 +1,139 @@
+#include <LinearAlgebra/Gemm.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    // Small integer entries keep every product exactly representable, also in float
+    template <typename T>
+    static Matrix<T> CreateTestMatrix(const size_t rowCount, const size_t columnCount, const size_t seed)
+    {
+        Matrix<T> matrix(rowCount, columnCount);
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                matrix(i, j) = static_cast<T>(static_cast<int>((i * 7 + j * 3 + seed) % 11) - 5);
+            }
+        }
+        return matrix;
+    }
+
+    template <typename T>
+    static Matrix<T> NaiveProduct(const Matrix<T>& lhs, const Matrix<T>& rhs)
+    {
+        Matrix<T> product(lhs.GetRowCount(), rhs.GetColumnCount());
+        for (size_t i = 0; i < lhs.GetRowCount(); i++)
+        {
+            for (size_t j = 0; j < rhs.GetColumnCount(); j++)
+            {
+                T dotProduct = 0;
+                for (size_t k = 0; k < lhs.GetColumnCount(); k++)
+                {
+                    dotProduct += lhs(i, k) * rhs(k, j);
+                }
+                product(i, j) = dotProduct;
+            }
+        }
+        return product;
+    }
+
+    template <typename T>
+    class GemmTypedTests : public ::testing::Test
+    {
+    };
+
+    using GemmTypes = ::testing::Types<int, float, double>;
+    TYPED_TEST_SUITE(GemmTypedTests, GemmTypes);
+
+    TYPED_TEST(GemmTypedTests, Product_WhenLargerThanBlockSizes_ShouldEqualNaiveProduct)
+    {
+        // Dimensions are no multiple of MR, NR, MC or KC to also cover the edge tiles
+        Matrix<TypeParam> lhs = CreateTestMatrix<TypeParam>(157, 301, 1);
+        Matrix<TypeParam> rhs = CreateTestMatrix<TypeParam>(301, 83, 4);
+
+        Matrix<TypeParam> result = lhs * rhs;
+        EXPECT_TRUE(result.ElementwiseEquals(NaiveProduct(lhs, rhs)));
+    }
+
+    TYPED_TEST(GemmTypedTests, Gemm_WhenAlphaAndBetaGiven_ShouldAccumulateIntoOutput)
+    {
+        Matrix<TypeParam> lhs = CreateTestMatrix<TypeParam>(65, 70, 2);
+        Matrix<TypeParam> rhs = CreateTestMatrix<TypeParam>(70, 37, 5);
+        Matrix<TypeParam> output = CreateTestMatrix<TypeParam>(65, 37, 3);
+        Matrix<TypeParam> initialOutput(output);
+
+        Gemm(TypeParam(2), lhs, rhs, TypeParam(-1), output);
+
+        Matrix<TypeParam> product = NaiveProduct(lhs, rhs);
+        for (size_t i = 0; i < output.GetRowCount(); i++)
+        {
+            for (size_t j = 0; j < output.GetColumnCount(); j++)
+            {
+                EXPECT_EQ(output(i, j), 2 * product(i, j) - initialOutput(i, j)) << "Matrix is not correct at (" << i << ", " << j << ")";
+            }
+        }
+    }
+
+    TEST(GemmTests, Gemm_WhenBetaIsZero_ShouldIgnoreOutputValues)
+    {
+        Matrix<double> lhs = CreateTestMatrix<double>(40, 50, 0);
+        Matrix<double> rhs = CreateTestMatrix<double>(50, 60, 1);
+        Matrix<double> output(40, 60);
+        output.Fill(std::numeric_limits<double>::quiet_NaN());
+
+        Gemm(1.0, lhs, rhs, 0.0, output);
+        EXPECT_TRUE(output.ElementwiseEquals(NaiveProduct(lhs, rhs)));
+    }
+
+    TEST(GemmTests, Gemm_WhenLeadingDimensionsGiven_ShouldOnlyUpdateSubmatrix)
+    {
+        Matrix<float> lhs = CreateTestMatrix<float>(100, 100, 0);
+        Matrix<float> rhs = CreateTestMatrix<float>(100, 100, 1);
+        Matrix<float> output(100, 100);
+        output.Fill(1.0f);
+
+        // C[10:60, 20:90] = A[10:60, 5:85] * B[5:85, 20:90]
+        const size_t ld = lhs.GetLeadingDimension();
+        Blas::Gemm<float>(50, 70, 80,
+                          1.0f, lhs.Data() + 10 * ld + 5, ld,
+                          rhs.Data() + 5 * ld + 20, ld,
+                          0.0f, output.Data() + 10 * ld + 20, ld);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            for (size_t j = 0; j < 100; j++)
+            {
+                float expected = 1.0f;
+                if (i >= 10 && i < 60 && j >= 20 && j < 90)
+                {
+                    expected = 0.0f;
+                    for (size_t k = 5; k < 85; k++)
+                    {
+                        expected += lhs(i, k) * rhs(k, j);
+                    }
+                }
+                EXPECT_EQ(output(i, j), expected) << "Matrix is not correct at (" << i << ", " << j << ")";
+            }
+        }
+    }
+
+    TEST(GemmTests, Gemm_WhenDimensionMismatch_ShouldThrow)
+    {
+        Matrix<float> matrix3x5(3, 5);
+        Matrix<float> matrix5x2(5, 2);
+        Matrix<float> matrix3x2(3, 2);
+        Matrix<float> matrix2x3(2, 3);
+
+        EXPECT_NO_THROW(Gemm(1.0f, matrix3x5, matrix5x2, 0.0f, matrix3x2));
+        EXPECT_THROW(Gemm(1.0f, matrix5x2, matrix3x5, 0.0f, matrix3x2), std::invalid_argument);
+        EXPECT_THROW(Gemm(1.0f, matrix3x5, matrix5x2, 0.0f, matrix2x3), std::invalid_argument);
+    }
+
+    TEST(GemmTests, Gemm_WhenOutputAliasesInput_ShouldThrow)
+    {
+        Matrix<float> matrix(4, 4);
+        matrix.Fill(1.0f);
+        EXPECT_THROW(Gemm(1.0f, matrix, matrix, 0.0f, matrix), std::invalid_argument);
+    }
+}
@@ -0,0 +1,94 @@
+#include <Geometry/MeshHierarchy.hpp>
+#include <LinearAlgebra/ConjugateGradient.hpp>
+#include <LinearAlgebra/GeometricMultigrid.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    static std::vector<SparseMatrix<double>> ConvertProlongations(const Geometry::RectangularMeshHierarchy& hierarchy)
+    {
+        std::vector<SparseMatrix<double>> prolongations;
+        for (const SparseMatrix<float>& prolongation : hierarchy.Prolongations)
+            prolongations.push_back(ConvertSparseMatrix<double>(prolongation));
+        return prolongations;
+    }
+
+    TEST(GeometricMultigridTests, Constructor_WhenNestedMeshes_ShouldEqualRediscretizedOperators)
+    {
+        const Geometry::RectangularMeshHierarchy hierarchy = Geometry::CreateRectangularMeshHierarchy(Geometry::Rectangle(0, 2, 0, 1), 16, 8);
+        const GeometricMultigrid<double> multigrid(TestHelper::AssembleOperator(hierarchy.Meshes[0], 3.0), ConvertProlongations(hierarchy));
+
+        ASSERT_EQ(multigrid.GetLevelCount(), hierarchy.Meshes.size());
+        const MultigridStatistics& statistics = multigrid.GetStatistics();
+        EXPECT_LT(statistics.OperatorComplexity(), 1.4);
+        for (size_t level = 1; level < multigrid.GetLevelCount(); level++)
+        {
+            const Matrix<double> galerkin = multigrid.GetOperator(level).ToMatrix();
+            const Matrix<double> rediscretized = TestHelper::AssembleOperator(hierarchy.Meshes[level], 3.0).ToMatrix();
+            ASSERT_EQ(galerkin.GetRowCount(), rediscretized.GetRowCount());
+            for (size_t i = 0; i < galerkin.GetRowCount(); i++)
+            {
+                for (size_t j = 0; j < galerkin.GetColumnCount(); j++)
+                    EXPECT_NEAR(galerkin(i, j), rediscretized(i, j), 1e-5);
+            }
+        }
+    }
+
+    TEST(GeometricMultigridTests, Solve_WhenStandalone_ShouldConvergeIndependentOfMeshSize)
+    {
+        for (const MultigridSmoother smoother : {MultigridSmoother::GaussSeidel, MultigridSmoother::Chebyshev})
+        {
+            std::vector<size_t> iterations;
+            for (const unsigned int cells : {16, 64})
+            {
+                const Geometry::RectangularMeshHierarchy hierarchy = Geometry::CreateRectangularMeshHierarchy(Geometry::Rectangle(0, 1, 0, 1), cells, cells);
+                const SparseMatrix<double> matrix = TestHelper::AssembleOperator(hierarchy.Meshes[0], 1.0);
+                const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+                ColumnVector<double> x(matrix.GetRowCount());
+                x.Fill(0.0);
+
+                const GeometricMultigrid<double> multigrid(matrix, ConvertProlongations(hierarchy), {.Smoother = smoother});
+                const IterativeReport report = multigrid.Solve(rhs, x, {100, 1e-8});
+                EXPECT_TRUE(report.Converged) << report;
+                iterations.push_back(report.Iterations);
+
+                ColumnVector<double> residual = rhs;
+                Spmv(-1.0, matrix, x, 1.0, residual);
+                EXPECT_LE(residual.Norm2(), 1e-8 * rhs.Norm2());
+            }
+            EXPECT_LE(iterations[1], iterations[0] + 2);
+        }
+    }
+
+    TEST(GeometricMultigridTests, ConjugateGradient_WhenRediscretizedLevels_ShouldNeedFewIterations)
+    {
+        const Geometry::RectangularMeshHierarchy hierarchy = Geometry::CreateRectangularMeshHierarchy(Geometry::Rectangle(0, 1, 0, 1), 64, 64);
+        std::vector<SparseMatrix<double>> operators;
+        for (const Geometry::Mesh2D& mesh : hierarchy.Meshes)
+            operators.push_back(TestHelper::AssembleOperator(mesh, 10.0));
+        const GeometricMultigrid<double> multigrid(operators, ConvertProlongations(hierarchy), {.Smoother = MultigridSmoother::Chebyshev});
+        EXPECT_EQ(multigrid.GetLevelCount(), 6);
+
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(operators[0].GetRowCount());
+        IterativeReport report;
+        const ColumnVector<double> x = ConjugateGradient(operators[0], rhs, multigrid, {100, 1e-10}, &report);
+        EXPECT_TRUE(report.Converged) << report;
+        EXPECT_LE(report.Iterations, 12);
+        EXPECT_EQ(multigrid.GetStatistics().CycleCount, report.Iterations);
+    }
+
+    TEST(GeometricMultigridTests, Constructor_WhenDimensionsMismatch_ShouldThrow)
+    {
+        const Geometry::RectangularMeshHierarchy hierarchy = Geometry::CreateRectangularMeshHierarchy(Geometry::Rectangle(0, 1, 0, 1), 8, 8);
+        const std::vector<SparseMatrix<double>> prolongations = ConvertProlongations(hierarchy);
+        const SparseMatrix<double> fine = TestHelper::AssembleOperator(hierarchy.Meshes[0], 1.0);
+        const SparseMatrix<double> coarse = TestHelper::AssembleOperator(hierarchy.Meshes[1], 1.0);
+
+        EXPECT_THROW(GeometricMultigrid<double>(coarse, prolongations), std::invalid_argument);
+        EXPECT_THROW(GeometricMultigrid<double>(std::vector<SparseMatrix<double>>{}, {}), std::invalid_argument);
+        EXPECT_THROW(GeometricMultigrid<double>(std::vector<SparseMatrix<double>>{fine, coarse}, prolongations), std::invalid_argument);
+        EXPECT_THROW(GeometricMultigrid<double>(std::vector<SparseMatrix<double>>{fine, fine}, {prolongations[0]}), std::invalid_argument);
+    }
+}
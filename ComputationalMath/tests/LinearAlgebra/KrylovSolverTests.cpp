@@ -0,0 +1,170 @@
+#include <LinearAlgebra/BiCGStab.hpp>
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/Gmres.hpp>
+#include <LinearAlgebra/Preconditioners.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+namespace LinearAlgebra::Iterative
+{
+    // Upwinded convection-diffusion on a size x size grid, non-symmetric for convection != 0. With a negative diagonal
+    // shift the (symmetric part of the) matrix becomes indefinite.
+    static SparseMatrix<double> CreateConvectionDiffusion(const size_t size, const double convection, const double shift)
+    {
+        std::vector<SparseEntry<double>> entries;
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                const SparseIndex row = static_cast<SparseIndex>(i * size + j);
+                entries.push_back({row, row, 4.0 + convection + shift});
+                if (i > 0)
+                    entries.push_back({row, static_cast<SparseIndex>(row - size), -1.0});
+                if (i + 1 < size)
+                    entries.push_back({row, static_cast<SparseIndex>(row + size), -1.0});
+                if (j > 0)
+                    entries.push_back({row, row - 1, -1.0 - convection});
+                if (j + 1 < size)
+                    entries.push_back({row, row + 1, -1.0});
+            }
+        }
+        return SparseMatrix<double>(size * size, size * size, entries);
+    }
+
+    static void ExpectEqualsLUSolve(const SparseMatrix<double>& matrix, const ColumnVector<double>& rhs, const ColumnVector<double>& actual,
+                                    const IterativeReport& report)
+    {
+        const ColumnVector<double> expected = Factorization::LUSolve(matrix.ToMatrix(), rhs, 1e-12);
+        EXPECT_TRUE(report.Converged) << report;
+        EXPECT_EQ(report.ResidualNorms.size(), report.Iterations + 1);
+        for (size_t i = 0; i < expected.GetLength(); i++)
+            EXPECT_NEAR(actual[i], expected[i], 1e-7);
+    }
+
+    TEST(KrylovSolverTests, Gmres_WhenNonSymmetric_ShouldMatchLUSolve)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(12, 2.0, 0.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const IterativeSettings settings{1000, 1e-10};
+        IterativeReport identity, incompleteLU;
+
+        ExpectEqualsLUSolve(matrix, rhs, Gmres(matrix, rhs, IdentityPreconditioner<double>(), 20, settings, &identity), identity);
+        ExpectEqualsLUSolve(matrix, rhs, Gmres(matrix, rhs, IncompleteLUPreconditioner<double>(matrix), 20, settings, &incompleteLU), incompleteLU);
+        EXPECT_LT(incompleteLU.Iterations, identity.Iterations);
+    }
+
+    TEST(KrylovSolverTests, Gmres_WhenIndefinite_ShouldMatchLUSolve)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(10, 0.5, -0.5);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        IterativeReport report;
+
+        const ColumnVector<double> actual = Gmres(matrix, rhs, IncompleteLUPreconditioner<double>(matrix), 30, {1000, 1e-10}, &report);
+        ExpectEqualsLUSolve(matrix, rhs, actual, report);
+    }
+
+    TEST(KrylovSolverTests, Gmres_WhenIterationLimitReached_ShouldHaveNonIncreasingResiduals)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(12, 1.0, 0.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        ColumnVector<double> x(matrix.GetRowCount());
+        x.Fill(0.0);
+
+        // Three full cycles and a partial one
+        GmresSolver<double> solver(matrix.GetRowCount(), 4, IterativeSettings{14, 1e-14});
+        const IterativeReport report = solver.Solve(matrix, rhs, x);
+        EXPECT_FALSE(report.Converged);
+        EXPECT_EQ(report.Iterations, 14);
+        ASSERT_EQ(report.ResidualNorms.size(), 15);
+        EXPECT_DOUBLE_EQ(report.ResidualNorms[0], 1.0);
+        for (size_t i = 1; i < report.ResidualNorms.size(); i++)
+            EXPECT_LE(report.ResidualNorms[i], report.ResidualNorms[i - 1] * (1 + 1e-12));
+
+        ColumnVector<double> residual = rhs;
+        Spmv(-1.0, matrix, x, 1.0, residual);
+        EXPECT_NEAR(residual.Norm2() / rhs.Norm2(), report.ResidualNorms.back(), 1e-12);
+    }
+
+    TEST(KrylovSolverTests, BiCGStab_WhenNonSymmetric_ShouldMatchLUSolve)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(12, 2.0, 0.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const IterativeSettings settings{1000, 1e-10};
+        IterativeReport identity, incompleteLU;
+
+        ExpectEqualsLUSolve(matrix, rhs, BiCGStab(matrix, rhs, IdentityPreconditioner<double>(), settings, &identity), identity);
+        ExpectEqualsLUSolve(matrix, rhs, BiCGStab(matrix, rhs, IncompleteLUPreconditioner<double>(matrix), settings, &incompleteLU), incompleteLU);
+        EXPECT_LT(incompleteLU.Iterations, identity.Iterations);
+    }
+
+    TEST(KrylovSolverTests, BiCGStab_WhenFloat_ShouldReachSinglePrecisionTolerance)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(20, 1.0, 0.0);
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const Matrix<double> dense = matrix.ToMatrix();
+
+        Matrix<float> denseFloat(dense.GetRowCount(), dense.GetColumnCount());
+        for (size_t i = 0; i < dense.GetRowCount(); i++)
+            for (size_t j = 0; j < dense.GetColumnCount(); j++)
+                denseFloat(i, j) = static_cast<float>(dense(i, j));
+        ColumnVector<float> rhsFloat(rhs.GetLength());
+        for (size_t i = 0; i < rhs.GetLength(); i++)
+            rhsFloat[i] = static_cast<float>(rhs[i]);
+        const SparseMatrix<float> matrixFloat(denseFloat);
+
+        IterativeReport report;
+        const ColumnVector<float> actual = BiCGStab(matrixFloat, rhsFloat, IncompleteLUPreconditioner<float>(matrixFloat), {500, 1e-5}, &report);
+        EXPECT_TRUE(report.Converged) << report;
+
+        ColumnVector<float> residual = rhsFloat;
+        Spmv(-1.0f, matrixFloat, actual, 1.0f, residual);
+        EXPECT_LE(residual.Norm2(), 1e-5f * rhsFloat.Norm2());
+    }
+
+    TEST(KrylovSolverTests, Solve_WhenDimensionsMismatch_ShouldThrow)
+    {
+        const SparseMatrix<double> matrix = CreateConvectionDiffusion(4, 1.0, 0.0);
+        ColumnVector<double> x(16);
+        GmresSolver<double> gmres(16, 5);
+        BiCGStabSolver<double> biCGStab(16);
+        EXPECT_THROW(gmres.Solve(matrix, ColumnVector<double>(15), x), std::invalid_argument);
+        EXPECT_THROW(biCGStab.Solve(CreateConvectionDiffusion(3, 1.0, 0.0), ColumnVector<double>(16), x), std::invalid_argument);
+        EXPECT_THROW(GmresSolver<double>(16, 0), std::invalid_argument);
+    }
+
+    TEST(KrylovSolverTests, IncompleteLU_WhenTridiagonal_ShouldSolveExactly)
+    {
+        // A tridiagonal matrix has no fill-in, thus ILU(0) is the exact LU factorization
+        const size_t n = 9;
+        std::vector<SparseEntry<double>> entries;
+        for (SparseIndex i = 0; i < n; i++)
+        {
+            entries.push_back({i, i, 3.0});
+            if (i > 0)
+                entries.push_back({i, i - 1, -2.0});
+            if (i + 1 < n)
+                entries.push_back({i, i + 1, 0.5});
+        }
+        const SparseMatrix<double> matrix(n, n, entries);
+        const IncompleteLUPreconditioner<double> preconditioner(matrix);
+        EXPECT_EQ(preconditioner.GetFactor().GetNonZeroCount(), matrix.GetNonZeroCount());
+
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(n);
+        ColumnVector<double> z(n);
+        preconditioner.Apply(rhs, z);
+        ColumnVector<double> residual = rhs;
+        Spmv(-1.0, matrix, z, 1.0, residual);
+        EXPECT_LE(residual.Norm2(), 1e-12);
+    }
+
+    TEST(KrylovSolverTests, IncompleteLU_WhenInvalidMatrix_ShouldThrow)
+    {
+        const SparseMatrix<double> missingDiagonal(2, 2, std::vector<SparseEntry<double>>{{0, 0, 1.0}, {1, 0, 1.0}});
+        const SparseMatrix<double> zeroPivot(2, 2, std::vector<SparseEntry<double>>{{0, 0, 1.0}, {0, 1, 1.0}, {1, 0, 1.0}, {1, 1, 1.0}});
+
+        EXPECT_THROW(IncompleteLUPreconditioner<double>{missingDiagonal}, std::invalid_argument);
+        EXPECT_THROW(IncompleteLUPreconditioner<double>{zeroPivot}, std::invalid_argument);
+        EXPECT_THROW(IncompleteLUPreconditioner<double>{SparseMatrix<double>(2, 3)}, std::invalid_argument);
+    }
+}
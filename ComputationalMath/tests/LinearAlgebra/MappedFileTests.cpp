@@ -0,0 +1,68 @@
+#include <LinearAlgebra/MappedFile.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    TEST(MappedFileTests, MappedFile_WhenPathGiven_ShouldWriteContentsToFile)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "MappedFileTests.bin";
+        {
+            MappedFile file(path.string(), 10000);
+            ASSERT_EQ(file.GetByteCount(), 10000);
+            EXPECT_EQ(file.Data()[9999], 0) << "New file should be zero";
+            for (size_t i = 0; i < file.GetByteCount(); i++)
+            {
+                file.Data()[i] = static_cast<char>(i % 127);
+            }
+        }
+
+        std::ifstream stream(path, std::ios::binary);
+        std::vector<char> contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        stream.close();
+        std::filesystem::remove(path);
+
+        ASSERT_EQ(contents.size(), 10000);
+        for (size_t i = 0; i < contents.size(); i++)
+        {
+            ASSERT_EQ(contents[i], static_cast<char>(i % 127)) << "File is not correct at " << i;
+        }
+    }
+
+    TEST(MappedFileTests, Evict_WhenPagesModified_ShouldKeepContents)
+    {
+        MappedFile file(1 << 20);
+        for (size_t i = 0; i < file.GetByteCount(); i++)
+        {
+            file.Data()[i] = static_cast<char>(i % 251);
+        }
+
+        // Unaligned ranges are widened to whole pages
+        file.Prefetch(12345, 100000);
+        file.Flush(1, file.GetByteCount());
+        file.Evict(777, 500000);
+
+        for (size_t i = 0; i < file.GetByteCount(); i++)
+        {
+            ASSERT_EQ(file.Data()[i], static_cast<char>(i % 251)) << "Contents are not correct at " << i;
+        }
+    }
+
+    TEST(MappedFileTests, MappedFile_WhenMoved_ShouldTransferMapping)
+    {
+        MappedFile file(4096);
+        file.Data()[10] = 42;
+
+        MappedFile moved(std::move(file));
+        EXPECT_EQ(file.Data(), nullptr);
+        EXPECT_EQ(file.GetByteCount(), 0);
+        EXPECT_EQ(moved.Data()[10], 42);
+    }
+
+    TEST(MappedFileTests, MappedFile_WhenPathInvalid_ShouldThrow)
+    {
+        EXPECT_THROW(MappedFile("/nonexistent-directory/file.bin", 16), std::runtime_error);
+    }
+}
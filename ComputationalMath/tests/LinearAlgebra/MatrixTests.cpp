@@ -438,4 +438,70 @@ namespace LinearAlgebra
             }
         }
     }
+
+    TEST(MatrixTests, CopyAssignment_WhenModifyingCopy_ShouldNotModifyOriginal)
+    {
+        Matrix<int> matrix = {{1, 2}, {3, 4}};
+        Matrix<int> copy(1, 1);
+        copy = matrix;
+        copy(0, 0) = 10;
+        EXPECT_EQ(matrix(0, 0), 1);
+        EXPECT_EQ(copy.GetRowCount(), 2);
+        EXPECT_EQ(copy.GetColumnCount(), 2);
+    }
+
+    TEST(MatrixTests, MoveConstructor_WhenMoved_ShouldTakeStorage)
+    {
+        Matrix<int> matrix = {{1, 2}, {3, 4}};
+        const int* storage = matrix.Data();
+        Matrix<int> moved(std::move(matrix));
+        EXPECT_EQ(moved.Data(), storage);
+        EXPECT_EQ(moved.GetRowCount(), 2);
+        EXPECT_EQ(matrix.GetRowCount(), 0);
+        EXPECT_EQ(matrix.GetColumnCount(), 0);
+    }
+
+    TEST(MatrixTests, CompoundAssignment_WhenSameDimensions_ShouldUpdateInPlace)
+    {
+        Matrix<int> matrix = {{1, 2}, {3, 4}};
+        Matrix<int> other = {{1, 1}, {2, 2}};
+        const int* storage = matrix.Data();
+
+        matrix += other * 3;
+        EXPECT_TRUE(matrix.ElementwiseEquals(Matrix<int>({{4, 5}, {9, 10}})));
+        matrix -= other;
+        EXPECT_TRUE(matrix.ElementwiseEquals(Matrix<int>({{3, 4}, {7, 8}})));
+        matrix *= 2;
+        EXPECT_TRUE(matrix.ElementwiseEquals(Matrix<int>({{6, 8}, {14, 16}})));
+        EXPECT_EQ(matrix.Data(), storage);
+
+        EXPECT_THROW(matrix += Matrix<int>(2, 3), std::invalid_argument);
+    }
+
+    TEST(MatrixTests, Blas1_WhenSameDimensions_ShouldComputeAxpyDotAndNorm)
+    {
+        Matrix<float> matrix = {{1, 2}, {3, 4}};
+        Matrix<float> other = {{1, 1}, {1, 1}};
+
+        matrix.Axpy(2.0f, other);
+        EXPECT_TRUE(matrix.ElementwiseEquals(Matrix<float>({{3, 4}, {5, 6}})));
+        EXPECT_FLOAT_EQ(matrix.Dot(other), 18.0f);
+        EXPECT_FLOAT_EQ(Matrix<float>({{3, 0}, {0, 4}}).FrobeniusNorm(), 5.0f);
+        EXPECT_FLOAT_EQ(Matrix<float>({{3e25f, 0}, {0, 4e25f}}).FrobeniusNorm(), 5e25f);
+        EXPECT_THROW(matrix.Dot(Matrix<float>(1, 4)), std::invalid_argument);
+    }
+
+    TEST(MatrixTests, Gemv_WhenDimensionsMatch_ShouldUpdateInPlace)
+    {
+        Matrix<int> matrix = {{1, 2}, {3, 4}, {5, 6}};
+        ColumnVector<int> x = {1, 1};
+        ColumnVector<int> y = {1, 1, 1};
+        const int* storage = y.Data();
+
+        Gemv(2, matrix, x, 1, y);
+
+        EXPECT_TRUE(y.ElementwiseEquals(ColumnVector<int>({7, 15, 23})));
+        EXPECT_EQ(y.Data(), storage);
+        EXPECT_THROW(Gemv(1, matrix, y, 0, y), std::invalid_argument);
+    }
 }
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <LinearAlgebra/Matrix.hpp>
 #include <LinearAlgebra/SimdOps.hpp>
+#include <LinearAlgebra/VectorBase.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace LinearAlgebra
 {
@@ -73,4 +77,209 @@ namespace LinearAlgebra
         result = SimdOps::Subtract(left, right, n);
         EXPECT_TRUE(std::equal(result, result + n, negLeft));
     }
-}
\ No newline at end of file
+}
+namespace LinearAlgebra
+{
+    static std::vector<SimdOps::InstructionSet> GetSupportedInstructionSets()
+    {
+        std::vector<SimdOps::InstructionSet> instructionSets;
+        for (SimdOps::InstructionSet instructionSet : {SimdOps::InstructionSet::Scalar, SimdOps::InstructionSet::Sse2,
+                                                       SimdOps::InstructionSet::Avx2, SimdOps::InstructionSet::Avx512})
+        {
+            if (instructionSet <= SimdOps::GetSupportedInstructionSet())
+                instructionSets.push_back(instructionSet);
+        }
+        return instructionSets;
+    }
+
+    class InstructionSetScope
+    {
+    public:
+        explicit InstructionSetScope(const SimdOps::InstructionSet instructionSet)
+            : m_previous(SimdOps::GetInstructionSet())
+        {
+            SimdOps::SetInstructionSet(instructionSet);
+        }
+
+        ~InstructionSetScope()
+        {
+            SimdOps::SetInstructionSet(m_previous);
+        }
+
+    private:
+        SimdOps::InstructionSet m_previous;
+    };
+
+    template <typename T>
+    static std::vector<T> CreateSimdTestValues(const size_t length, const T offset)
+    {
+        std::vector<T> values(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            values[i] = static_cast<T>((i * 7 + 3) % 11) - offset;
+        }
+        return values;
+    }
+
+    template <typename T>
+    class SimdOpsFloatingPointTests : public testing::Test
+    {
+    };
+
+    using SimdOpsFloatingPointTypes = testing::Types<float, double>;
+    TYPED_TEST_SUITE(SimdOpsFloatingPointTests, SimdOpsFloatingPointTypes);
+
+    TYPED_TEST(SimdOpsFloatingPointTests, ElementwiseKernels_WhenUnalignedWithTail_ShouldMatchScalarLoop)
+    {
+        using T = TypeParam;
+        for (SimdOps::InstructionSet instructionSet : GetSupportedInstructionSets())
+        {
+            InstructionSetScope scope(instructionSet);
+            for (size_t length = 0; length < 70; length += 3)
+            {
+                // Offset by one element, such that none of the kernels runs on aligned data
+                const std::vector<T> left = CreateSimdTestValues<T>(length + 1, 5);
+                const std::vector<T> right = CreateSimdTestValues<T>(length + 1, 2);
+                std::vector<T> result(length + 1, T(-100));
+
+                SimdOps::Sum(left.data() + 1, right.data() + 1, length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], left[i] + right[i]);
+
+                SimdOps::Subtract(left.data() + 1, right.data() + 1, length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], left[i] - right[i]);
+
+                SimdOps::Min(left.data() + 1, right.data() + 1, length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], std::min(left[i], right[i]));
+
+                SimdOps::Max(left.data() + 1, right.data() + 1, length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], std::max(left[i], right[i]));
+
+                SimdOps::Scale(left.data() + 1, T(0.5), length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], T(0.5) * left[i]);
+
+                SimdOps::MultiplyAdd(left.data() + 1, right.data() + 1, left.data() + 1, length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], left[i] * right[i] + left[i]);
+
+                std::vector<T> y = right;
+                SimdOps::Axpy(T(2), left.data() + 1, length, y.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(y[i], T(2) * left[i] + right[i]);
+
+                EXPECT_EQ(result[0], T(-100));
+                EXPECT_EQ(y[0], right[0]);
+            }
+        }
+    }
+
+    TYPED_TEST(SimdOpsFloatingPointTests, Reductions_WhenUnalignedWithTail_ShouldMatchScalarLoop)
+    {
+        using T = TypeParam;
+        for (SimdOps::InstructionSet instructionSet : GetSupportedInstructionSets())
+        {
+            InstructionSetScope scope(instructionSet);
+            for (size_t length = 1; length < 140; length += 5)
+            {
+                const std::vector<T> left = CreateSimdTestValues<T>(length + 1, 5);
+                const std::vector<T> right = CreateSimdTestValues<T>(length + 1, 2);
+
+                T dot = 0, sum = 0;
+                for (size_t i = 1; i <= length; i++)
+                {
+                    dot += left[i] * right[i];
+                    sum += left[i];
+                }
+
+                // Small integers, thus exact regardless of the order of summation
+                EXPECT_EQ(SimdOps::Dot(left.data() + 1, right.data() + 1, length), dot);
+                EXPECT_EQ(SimdOps::ReduceSum(left.data() + 1, length), sum);
+                EXPECT_EQ(SimdOps::ReduceMin(left.data() + 1, length), *std::min_element(left.begin() + 1, left.end()));
+                EXPECT_EQ(SimdOps::ReduceMax(left.data() + 1, length), *std::max_element(left.begin() + 1, left.end()));
+            }
+
+            EXPECT_EQ(SimdOps::Dot(static_cast<const T*>(nullptr), nullptr, 0), T(0));
+            EXPECT_THROW(SimdOps::ReduceMin(static_cast<const T*>(nullptr), 0), std::invalid_argument);
+        }
+    }
+
+    TYPED_TEST(SimdOpsFloatingPointTests, GatherMultiply_WhenUnalignedWithTail_ShouldMatchScalarLoop)
+    {
+        using T = TypeParam;
+        const std::vector<T> x = CreateSimdTestValues<T>(97, 4);
+        for (SimdOps::InstructionSet instructionSet : GetSupportedInstructionSets())
+        {
+            InstructionSetScope scope(instructionSet);
+            for (size_t length = 0; length < 70; length += 3)
+            {
+                const std::vector<T> values = CreateSimdTestValues<T>(length + 1, 5);
+                std::vector<uint32_t> indices(length + 1);
+                for (size_t i = 0; i < indices.size(); i++)
+                    indices[i] = static_cast<uint32_t>((i * 37 + 11) % x.size());
+                std::vector<T> result(length + 1, T(-100));
+
+                SimdOps::GatherMultiply(values.data() + 1, indices.data() + 1, x.data(), length, result.data() + 1);
+                for (size_t i = 1; i <= length; i++)
+                    EXPECT_EQ(result[i], values[i] * x[indices[i]]);
+                EXPECT_EQ(result[0], T(-100));
+            }
+        }
+    }
+
+    TEST(SimdOpsTests, SetInstructionSet_WhenNotSupported_ShouldThrow)
+    {
+        EXPECT_EQ(SimdOps::GetInstructionSet(), SimdOps::GetSupportedInstructionSet());
+        if (SimdOps::GetSupportedInstructionSet() != SimdOps::InstructionSet::Avx512)
+        {
+            EXPECT_THROW(SimdOps::SetInstructionSet(SimdOps::InstructionSet::Avx512), std::invalid_argument);
+        }
+        EXPECT_NO_THROW(SimdOps::SetInstructionSet(SimdOps::InstructionSet::Scalar));
+        SimdOps::SetInstructionSet(SimdOps::GetSupportedInstructionSet());
+    }
+
+    TEST(SimdOpsTests, MatrixExpressions_WhenDispatched_ShouldKeepRowPaddingZero)
+    {
+        for (SimdOps::InstructionSet instructionSet : GetSupportedInstructionSets())
+        {
+            InstructionSetScope scope(instructionSet);
+
+            // 19 floats per row are padded to a leading dimension of 32
+            Matrix<float> left(5, 19);
+            Matrix<float> right(5, 19);
+            for (size_t i = 0; i < 5; i++)
+            {
+                for (size_t j = 0; j < 19; j++)
+                {
+                    left(i, j) = static_cast<float>(i + j);
+                    right(i, j) = static_cast<float>(i * j);
+                }
+            }
+
+            Matrix<float> result = left + right;
+            result -= right * 2.0f;
+            result += left;
+            result *= 0.5f;
+
+            for (size_t i = 0; i < 5; i++)
+            {
+                for (size_t j = 0; j < 19; j++)
+                {
+                    EXPECT_EQ(result(i, j), (2.0f * left(i, j) - right(i, j)) * 0.5f);
+                }
+                for (size_t j = 19; j < result.GetLeadingDimension(); j++)
+                {
+                    EXPECT_EQ(result.Data()[i * result.GetLeadingDimension() + j], 0.0f);
+                }
+            }
+
+            ColumnVector<double> x = {1, 2, 3, 4, 5};
+            ColumnVector<double> y = x - x * 3.0;
+            EXPECT_TRUE(y.ElementwiseEquals(ColumnVector<double>({-2, -4, -6, -8, -10})));
+            EXPECT_EQ(x.Dot(y), -110.0);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SmallMatrix.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    template <size_t N>
+    static bool IsIdentity(const SmallMatrix<double, N, N>& matrix, const double epsilon)
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            for (size_t j = 0; j < N; j++)
+            {
+                if (!(std::abs(matrix(i, j) - (i == j ? 1.0 : 0.0)) < epsilon))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    TEST(SmallMatrixTests, Determinant_WhenEvaluatedAtCompileTime_ShouldBeConstant)
+    {
+        constexpr SmallMatrix<int, 2, 2> matrix2(1, 2,
+                                                 3, 4);
+        constexpr SmallMatrix<int, 3, 3> matrix3(2, 0, 1,
+                                                 1, 3, 2,
+                                                 1, 1, 2);
+        static_assert(matrix2.Determinant() == -2);
+        static_assert(matrix3.Determinant() == 6);
+        static_assert(SmallMatrix<int, 1, 1>(5).Determinant() == 5);
+        EXPECT_EQ(matrix3.Determinant(), Matrix<int>::Determinant(2, 0, 1, 1, 3, 2, 1, 1, 2));
+    }
+
+    TEST(SmallMatrixTests, Product_WhenEvaluatedAtCompileTime_ShouldBeMatrixProduct)
+    {
+        constexpr SmallMatrix<int, 2, 3> lhs(1, 2, 3,
+                                             4, 5, 6);
+        constexpr SmallMatrix<int, 3, 2> rhs(7, 8,
+                                             9, 10,
+                                             11, 12);
+        static_assert(lhs * rhs == SmallMatrix<int, 2, 2>(58, 64, 139, 154));
+        static_assert(lhs.Transposed() == SmallMatrix<int, 3, 2>(1, 4, 2, 5, 3, 6));
+        static_assert(Dot(SmallVector<int, 3>(1, 2, 3), SmallVector<int, 3>(4, 5, 6)) == 32);
+        static_assert(2 * SmallMatrix<int, 2, 2>::Identity() - SmallMatrix<int, 2, 2>(1, 0, 0, 1) == SmallMatrix<int, 2, 2>::Identity());
+    }
+
+    TEST(SmallMatrixTests, Inverse_WhenNonDegenerate_ShouldGiveIdentityProduct)
+    {
+        constexpr SmallMatrix<double, 2, 2> matrix2(4, 7,
+                                                    2, 6);
+        constexpr SmallMatrix<double, 3, 3> matrix3(1, 2, 3,
+                                                    0, 1, 4,
+                                                    5, 6, 0);
+        static_assert(matrix3.Inverse() == SmallMatrix<double, 3, 3>(-24, 18, 5, 20, -15, -4, -5, 4, 1));
+
+        EXPECT_TRUE(IsIdentity(matrix2.Inverse() * matrix2, 1e-12));
+        EXPECT_TRUE(IsIdentity(matrix2 * matrix2.Inverse(), 1e-12));
+        EXPECT_TRUE(IsIdentity(matrix3.Inverse() * matrix3, 1e-12));
+        EXPECT_TRUE(IsIdentity(matrix3 * matrix3.Inverse(), 1e-12));
+        const SmallMatrix<double, 1, 1> matrix1(4);
+        EXPECT_DOUBLE_EQ(matrix1.Inverse()(0, 0), 0.25);
+    }
+
+    TEST(SmallMatrixTests, Inverse_WhenDegenerate_ShouldThrow)
+    {
+        const SmallMatrix<float, 2, 2> matrix2(1, 2,
+                                               2, 4);
+        const SmallMatrix<float, 3, 3> matrix3(1, 2, 3,
+                                               4, 5, 6,
+                                               5, 7, 9);
+        EXPECT_THROW(matrix2.Inverse(), std::invalid_argument);
+        EXPECT_THROW(matrix3.Inverse(), std::invalid_argument);
+    }
+
+    TEST(SmallMatrixTests, Operators_WhenVectorIsIndexed_ShouldBeWritable)
+    {
+        SmallVector<float, 2> vector;
+        vector[1] = 3;
+        vector += SmallVector<float, 2>(1, 1);
+        vector *= 2;
+
+        EXPECT_EQ(vector, (SmallVector<float, 2>(2, 8)));
+        EXPECT_EQ(vector.Data()[1], 8);
+    }
+}
@@ -0,0 +1,169 @@
+#include <Geometry/MeshGenerator.hpp>
+#include <LinearAlgebra/FactorizationCholesky.hpp>
+#include <LinearAlgebra/SparseCholesky.hpp>
+#include <LinearAlgebra/SparseOrdering.hpp>
+#include <gtest/gtest.h>
+
+#include "TestHelper.hpp"
+
+#include <numeric>
+
+namespace LinearAlgebra::Factorization
+{
+    static std::vector<SparseIndex> IdentityPermutation(const size_t size)
+    {
+        std::vector<SparseIndex> permutation(size);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        return permutation;
+    }
+
+    static void ExpectDenseCholeskySolve(const SparseCholeskyFactorization<double>& factorization, const SparseMatrix<double>& matrix)
+    {
+        const ColumnVector<double> rhs = TestHelper::CreateRightHandSide(matrix.GetRowCount());
+        const ColumnVector<double> expected = CholeskyFactorization<double>(matrix.ToMatrix(), 1e-12).Solve(rhs);
+        EXPECT_TRUE(factorization.Solve(rhs).ElementwiseCompare(expected, 1e-9f));
+    }
+
+    TEST(SparseCholeskyTests, Solve_WhenMeshOperator_ShouldEqualDenseCholesky)
+    {
+        const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 2, 0, 1), 24, 12);
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(mesh, 1.0);
+
+        const std::vector<std::vector<SparseIndex>> orderings = {IdentityPermutation(matrix.GetRowCount()), Ordering::NestedDissection(matrix, 8),
+                                                                 Ordering::NestedDissection(matrix, mesh.Vertices, 8)};
+        for (const std::vector<SparseIndex>& ordering : orderings)
+        {
+            const SparseCholeskyFactorization<double> factorization(SparseCholeskyAnalysis(matrix, ordering), matrix, 1e-12);
+            ExpectDenseCholeskySolve(factorization, matrix);
+        }
+    }
+
+    TEST(SparseCholeskyTests, Solve_WhenDense_ShouldSplitSupernodes)
+    {
+        const size_t size = 2 * SparseCholeskyAnalysis::MaxSupernodeWidth + 17;
+        Matrix<double> dense(size, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+                dense(i, j) = i == j ? static_cast<double>(size) : 1.0 / (1.0 + static_cast<double>((i + j) % 7));
+        }
+        const SparseMatrix<double> matrix(dense);
+
+        const SparseCholeskyFactorization<double> factorization(matrix, 1e-12);
+        EXPECT_EQ(factorization.GetAnalysis().GetSupernodeCount(), 3);
+        EXPECT_EQ(factorization.GetAnalysis().GetFactorNonZeroCount(), size * (size + 1) / 2);
+        ExpectDenseCholeskySolve(factorization, matrix);
+    }
+
+    TEST(SparseCholeskyTests, Analysis_WhenNestedDissection_ShouldReduceFill)
+    {
+        const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 48, 48);
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(mesh, 0.0);
+
+        const SparseCholeskyAnalysis natural(matrix, IdentityPermutation(matrix.GetRowCount()));
+        const SparseCholeskyAnalysis algebraic(matrix);
+        const SparseCholeskyAnalysis geometric(matrix, Ordering::NestedDissection(matrix, mesh.Vertices));
+
+        EXPECT_LT(algebraic.GetFactorNonZeroCount(), natural.GetFactorNonZeroCount());
+        EXPECT_LT(geometric.GetFactorNonZeroCount(), natural.GetFactorNonZeroCount());
+        EXPECT_LE(geometric.GetFactorNonZeroCount(), geometric.GetFactorValueCount());
+
+        // In postorder, every parent succeeds its children
+        const std::vector<SparseIndex>& parent = geometric.GetEliminationTree();
+        for (size_t j = 0; j < parent.size(); j++)
+        {
+            if (parent[j] != SparseCholeskyAnalysis::None)
+            {
+                EXPECT_GT(parent[j], j);
+            }
+        }
+    }
+
+    TEST(SparseCholeskyTests, Analysis_WhenMeshOperator_ShouldMergeNarrowSupernodes)
+    {
+        const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 48, 48);
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(mesh, 1.0);
+        const SparseCholeskyAnalysis analysis(matrix, Ordering::NestedDissection(matrix, mesh.Vertices));
+
+        // The fundamental supernodes of a 2D operator average little more than one column
+        EXPECT_GT(analysis.GetSize(), 4 * analysis.GetSupernodeCount());
+        EXPECT_LT(analysis.GetFactorValueCount(), 2 * analysis.GetFactorNonZeroCount());
+
+        // Every supernode is a contiguous range of columns, its rows start with them
+        const std::vector<SparseIndex>& starts = analysis.SupernodeStarts();
+        for (size_t s = 0; s < analysis.GetSupernodeCount(); s++)
+        {
+            ASSERT_LE(starts[s + 1] - starts[s], SparseCholeskyAnalysis::MaxSupernodeWidth);
+            for (SparseIndex j = starts[s]; j < starts[s + 1]; j++)
+            {
+                EXPECT_EQ(analysis.ColumnSupernodes()[j], s);
+                EXPECT_EQ(analysis.SupernodeRows()[analysis.SupernodeRowOffsets()[s] + j - starts[s]], j);
+            }
+        }
+
+        const SparseCholeskyFactorization<double> factorization(analysis, matrix, 1e-12);
+        ExpectDenseCholeskySolve(factorization, matrix);
+    }
+
+    TEST(SparseCholeskyTests, Factorize_WhenValuesChange_ShouldReuseAnalysis)
+    {
+        const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 16, 16);
+        const SparseMatrix<double> first = TestHelper::AssembleOperator(mesh, 1.0);
+        const SparseMatrix<double> second = TestHelper::AssembleOperator(mesh, 50.0);
+
+        SparseCholeskyFactorization<double> factorization(SparseCholeskyAnalysis(first, Ordering::NestedDissection(first, mesh.Vertices, 16)), first, 1e-12);
+        ExpectDenseCholeskySolve(factorization, first);
+        factorization.Factorize(second);
+        ExpectDenseCholeskySolve(factorization, second);
+    }
+
+    TEST(SparseCholeskyTests, Factorize_WhenInvalid_ShouldThrow)
+    {
+        const Geometry::Mesh2D mesh = Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 8, 8);
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(mesh, 1.0);
+
+        // A negative shift of more than the smallest eigenvalue of the Laplacian makes the operator indefinite
+        EXPECT_THROW(SparseCholeskyFactorization<double>(TestHelper::AssembleOperator(mesh, -10.0), 1e-12), std::invalid_argument);
+
+        SparseCholeskyFactorization<double> factorization(matrix, 1e-12);
+        EXPECT_THROW(factorization.Factorize(TestHelper::AssembleOperator(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 8, 7), 1.0)),
+                     std::invalid_argument);
+
+        ColumnVector<double> rhs(3);
+        EXPECT_THROW(factorization.SolveInPlace(rhs), std::invalid_argument);
+    }
+
+    TEST(SparseCholeskyTests, Analysis_WhenInvalidPermutation_ShouldThrow)
+    {
+        const SparseMatrix<double> matrix = TestHelper::AssembleOperator(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 4, 4), 1.0);
+        std::vector<SparseIndex> permutation = IdentityPermutation(matrix.GetRowCount());
+        permutation[3] = 4;
+        EXPECT_THROW(SparseCholeskyAnalysis(matrix, permutation), std::invalid_argument);
+        permutation.pop_back();
+        EXPECT_THROW(SparseCholeskyAnalysis(matrix, permutation), std::invalid_argument);
+    }
+
+    TEST(SparseCholeskyTests, NestedDissection_WhenDisconnected_ShouldReturnPermutation)
+    {
+        // Two meshes without shared vertices
+        const SparseMatrix<double> block = TestHelper::AssembleOperator(Geometry::CreateRectangularMesh(Geometry::Rectangle(0, 1, 0, 1), 12, 12), 1.0);
+        std::vector<SparseEntry<double>> entries;
+        const SparseIndex size = static_cast<SparseIndex>(block.GetRowCount());
+        for (SparseIndex row = 0; row < size; row++)
+        {
+            for (SparseIndex k = block.RowOffsets()[row]; k < block.RowOffsets()[row + 1]; k++)
+            {
+                entries.push_back({row, block.ColumnIndices()[k], block.Values()[k]});
+                entries.push_back({row + size, block.ColumnIndices()[k] + size, block.Values()[k]});
+            }
+        }
+        const SparseMatrix<double> matrix(2 * size, 2 * size, entries);
+
+        const std::vector<SparseIndex> permutation = Ordering::NestedDissection(matrix, 4);
+        const std::vector<SparseIndex> inverse = Ordering::InversePermutation(permutation);
+        ASSERT_EQ(inverse.size(), matrix.GetRowCount());
+
+        const SparseCholeskyFactorization<double> factorization(SparseCholeskyAnalysis(matrix, permutation), matrix, 1e-12);
+        ExpectDenseCholeskySolve(factorization, matrix);
+    }
+}
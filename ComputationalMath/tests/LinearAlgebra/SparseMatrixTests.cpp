@@ -0,0 +1,177 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
+#include <LinearAlgebra/ThreadPool.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    // 5-point Laplacian of a size x size grid, with small integers such that the products are exact
+    template <typename T>
+    static SparseMatrix<T> CreateLaplacian(const size_t size)
+    {
+        std::vector<SparseEntry<T>> entries;
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                const SparseIndex row = static_cast<SparseIndex>(i * size + j);
+                entries.push_back({row, row, T(4)});
+                if (i > 0)
+                    entries.push_back({row, static_cast<SparseIndex>(row - size), T(-1)});
+                if (i + 1 < size)
+                    entries.push_back({row, static_cast<SparseIndex>(row + size), T(-1)});
+                if (j > 0)
+                    entries.push_back({row, row - 1, T(-1)});
+                if (j + 1 < size)
+                    entries.push_back({row, row + 1, T(-2)});
+            }
+        }
+        return SparseMatrix<T>(size * size, size * size, entries);
+    }
+
+    template <typename T>
+    static ColumnVector<T> CreateSparseTestVector(const size_t length)
+    {
+        ColumnVector<T> vector(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            vector[i] = static_cast<T>((i * 7 + 3) % 11) - 5;
+        }
+        return vector;
+    }
+
+    TEST(SparseMatrixTests, Constructor_WhenDuplicateEntries_ShouldSumAndSortColumns)
+    {
+        const std::vector<SparseEntry<double>> entries = {{1, 3, 1.0}, {0, 2, 2.0}, {1, 0, 3.0}, {1, 3, 4.0}, {0, 0, 5.0}};
+        const SparseMatrix<double> matrix(3, 4, entries);
+
+        EXPECT_EQ(matrix.GetNonZeroCount(), 4);
+        EXPECT_EQ(matrix(1, 3), 5.0);
+        EXPECT_EQ(matrix(0, 2), 2.0);
+        EXPECT_EQ(matrix(1, 1), 0.0);
+        EXPECT_EQ(matrix.FindIndex(2, 2), matrix.GetNonZeroCount());
+        EXPECT_EQ(std::vector<SparseIndex>(matrix.RowOffsets(), matrix.RowOffsets() + 4), std::vector<SparseIndex>({0, 2, 4, 4}));
+        EXPECT_EQ(std::vector<SparseIndex>(matrix.ColumnIndices(), matrix.ColumnIndices() + 4), std::vector<SparseIndex>({0, 2, 0, 3}));
+        EXPECT_THROW(matrix(3, 0), std::out_of_range);
+    }
+
+    TEST(SparseMatrixTests, Constructor_WhenInvalidCsr_ShouldThrow)
+    {
+        EXPECT_THROW(SparseMatrix<float>(2, 2, {0, 1}, {0}, {1.0f}), std::invalid_argument);
+        EXPECT_THROW(SparseMatrix<float>(2, 2, {0, 2, 2}, {1, 0}, {1.0f, 2.0f}), std::invalid_argument);
+        EXPECT_THROW(SparseMatrix<float>(2, 2, {0, 1, 1}, {2}, {1.0f}), std::out_of_range);
+        EXPECT_THROW(SparseMatrix<float>(2, 2, std::vector<SparseEntry<float>>{{2, 0, 1.0f}}), std::out_of_range);
+        EXPECT_NO_THROW(SparseMatrix<float>(2, 2, {0, 1, 2}, {1, 0}, {1.0f, 2.0f}));
+    }
+
+    TEST(SparseMatrixTests, ToMatrix_WhenConstructedFromDense_ShouldBeEqual)
+    {
+        Matrix<float> dense(7, 5);
+        dense.Fill(0.0f);
+        dense(0, 4) = 1.0f;
+        dense(3, 2) = -2.0f;
+        dense(6, 0) = 3.0f;
+
+        const SparseMatrix<float> sparse(dense);
+        EXPECT_EQ(sparse.GetNonZeroCount(), 3);
+        EXPECT_TRUE(sparse.ToMatrix().ElementwiseEquals(dense));
+    }
+
+    TEST(SparseMatrixTests, Multiply_WhenComparedToDense_ShouldBeEqual)
+    {
+        const SparseMatrix<double> sparse = CreateLaplacian<double>(13);
+        const Matrix<double> dense = sparse.ToMatrix();
+        const ColumnVector<double> x = CreateSparseTestVector<double>(sparse.GetColumnCount());
+
+        EXPECT_TRUE((sparse * x).ElementwiseEquals(dense * x));
+        EXPECT_TRUE(sparse.TransposedMultiply(x).ElementwiseEquals(dense.Transposed() * x));
+        EXPECT_THROW(sparse * ColumnVector<double>(3), std::invalid_argument);
+    }
+
+    TEST(SparseMatrixTests, Spmv_WhenLongRows_ShouldMatchDense)
+    {
+        // Rows longer than a gather chunk next to empty and short rows
+        const size_t columnCount = 3 * Blas::SpmvChunk + 5;
+        std::vector<SparseEntry<float>> entries;
+        for (SparseIndex j = 0; j < columnCount; j += 2)
+            entries.push_back({1, j, static_cast<float>(j % 5) - 2.0f});
+        for (SparseIndex j = 0; j < columnCount; j++)
+            entries.push_back({3, j, 1.0f});
+        entries.push_back({4, 7, 2.0f});
+        const SparseMatrix<float> sparse(5, columnCount, entries);
+        const ColumnVector<float> x = CreateSparseTestVector<float>(columnCount);
+
+        ColumnVector<float> y = CreateSparseTestVector<float>(5);
+        const ColumnVector<float> expected = 2.0f * (sparse.ToMatrix() * x) + 3.0f * y;
+        Spmv(2.0f, sparse, x, 3.0f, y);
+        EXPECT_TRUE(y.ElementwiseEquals(expected));
+    }
+
+    TEST(SparseMatrixTests, Spmv_WhenParallel_ShouldMatchSerial)
+    {
+        const size_t initialThreadCount = Parallel::GetThreadCount();
+        Parallel::SetThreadCount(4);
+
+        const SparseMatrix<double> sparse = CreateLaplacian<double>(200);
+        ASSERT_GE(sparse.GetNonZeroCount(), Blas::ParallelSpmvThreshold);
+        const ColumnVector<double> x = CreateSparseTestVector<double>(sparse.GetColumnCount());
+
+        ColumnVector<double> expected(sparse.GetRowCount());
+        Blas::SerialSpmv(0, sparse.GetRowCount(), 1.0, sparse.RowOffsets(), sparse.ColumnIndices(), sparse.Values(), x.Data(), 0.0, expected.Data());
+        ColumnVector<double> expectedTransposed(sparse.GetColumnCount());
+        expectedTransposed.Fill(0.0);
+        Blas::SerialSpmvTransposed(0, sparse.GetRowCount(), 1.0, sparse.RowOffsets(), sparse.ColumnIndices(), sparse.Values(), x.Data(),
+                                   expectedTransposed.Data());
+
+        const ColumnVector<double> actual = sparse * x;
+        const ColumnVector<double> actualTransposed = sparse.TransposedMultiply(x);
+        Parallel::SetThreadCount(initialThreadCount);
+
+        EXPECT_TRUE(actual.ElementwiseEquals(expected));
+        EXPECT_TRUE(actualTransposed.ElementwiseEquals(expectedTransposed));
+    }
+
+    TEST(SparseMatrixTests, ScaleRows_WhenInverseDiagonal_ShouldHaveUnitDiagonal)
+    {
+        SparseMatrix<double> sparse = CreateLaplacian<double>(5);
+        ColumnVector<double> diagonal = sparse.GetDiagonal();
+        ASSERT_EQ(diagonal.GetLength(), 25);
+        EXPECT_EQ(diagonal[10], 4.0);
+
+        for (size_t i = 0; i < diagonal.GetLength(); i++)
+            diagonal[i] = 1.0 / diagonal[i];
+        sparse.ScaleRows(diagonal);
+
+        const ColumnVector<double> scaled = sparse.GetDiagonal();
+        for (size_t i = 0; i < scaled.GetLength(); i++)
+            EXPECT_EQ(scaled[i], 1.0);
+        EXPECT_EQ(sparse(0, 1), -0.5);
+        EXPECT_THROW(sparse.ScaleRows(ColumnVector<double>(3)), std::invalid_argument);
+    }
+
+    TEST(SparseMatrixTests, Multiply_WhenSparseMatrices_ShouldMatchDense)
+    {
+        const SparseMatrix<double> laplacian = CreateLaplacian<double>(6);
+        const std::vector<SparseEntry<double>> entries = {{0, 1, 2.0}, {5, 0, -1.0}, {5, 2, 3.0}, {20, 1, 1.0}, {35, 2, 4.0}};
+        const SparseMatrix<double> rectangular(36, 3, entries);
+
+        const SparseMatrix<double> product = laplacian * rectangular;
+        EXPECT_EQ(product.GetRowCount(), 36);
+        EXPECT_EQ(product.GetColumnCount(), 3);
+        EXPECT_TRUE(product.ToMatrix().ElementwiseEquals(laplacian.ToMatrix() * rectangular.ToMatrix()));
+        EXPECT_TRUE((laplacian * laplacian).ToMatrix().ElementwiseEquals(laplacian.ToMatrix() * laplacian.ToMatrix()));
+        EXPECT_THROW(rectangular * laplacian, std::invalid_argument);
+    }
+
+    TEST(SparseMatrixTests, Transposed_WhenTransposedTwice_ShouldBeEqual)
+    {
+        const std::vector<SparseEntry<float>> entries = {{0, 4, 1.0f}, {2, 0, -2.0f}, {2, 4, 3.0f}, {6, 1, 5.0f}};
+        const SparseMatrix<float> sparse(7, 5, entries);
+
+        const SparseMatrix<float> transposed = sparse.Transposed();
+        EXPECT_EQ(transposed.GetRowCount(), 5);
+        EXPECT_EQ(transposed.GetColumnCount(), 7);
+        EXPECT_TRUE(transposed.ToMatrix().ElementwiseEquals(sparse.ToMatrix().Transposed()));
+        EXPECT_TRUE(transposed.Transposed().ToMatrix().ElementwiseEquals(sparse.ToMatrix()));
+    }
+}
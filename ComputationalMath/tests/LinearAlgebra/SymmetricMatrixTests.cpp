@@ -0,0 +1,74 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SymmetricMatrix.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    static Matrix<double> CreateSymmetricTestMatrix(const size_t size)
+    {
+        Matrix<double> matrix(size, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                matrix(i, j) = static_cast<double>((i * 7 + j * 13) % 17) - 8;
+                matrix(j, i) = matrix(i, j);
+            }
+        }
+        return matrix;
+    }
+
+    TEST(SymmetricMatrixTests, Indexing_WhenTransposedIndex_ShouldReturnSameElement)
+    {
+        SymmetricMatrix<float> matrix(150);
+        matrix(100, 3) = 5.0f;
+        matrix(7, 140) += 2.0f;
+
+        EXPECT_EQ(matrix(3, 100), 5.0f);
+        EXPECT_EQ(matrix(140, 7), 2.0f);
+        EXPECT_EQ(&matrix(3, 100), &matrix(100, 3));
+        EXPECT_EQ(matrix(0, 149), 0.0f);
+    }
+
+    TEST(SymmetricMatrixTests, Constructor_WhenMatrixGiven_ShouldStoreAboutHalf)
+    {
+        const size_t size = 16 * SymmetricMatrix<double>::TileSize - 5;
+        const Matrix<double> dense = CreateSymmetricTestMatrix(size);
+        const SymmetricMatrix<double> symmetric(dense);
+
+        EXPECT_TRUE(symmetric.ToMatrix().ElementwiseEquals(dense));
+        EXPECT_EQ(symmetric.GetTileCount(), 16);
+        EXPECT_LT(symmetric.GetStorageLength(), 55 * size * size / 100);
+        EXPECT_THROW(SymmetricMatrix<double>(Matrix<double>(3, 4)), std::invalid_argument);
+    }
+
+    TEST(SymmetricMatrixTests, MultiplyColumnVector_WhenSymmetric_ShouldEqualDenseProduct)
+    {
+        const size_t size = 2 * SymmetricMatrix<double>::TileSize + 17;
+        const Matrix<double> dense = CreateSymmetricTestMatrix(size);
+        const SymmetricMatrix<double> symmetric(dense);
+        ColumnVector<double> vector(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            vector[i] = static_cast<double>(i % 5) - 2;
+        }
+
+        EXPECT_TRUE((symmetric * vector).ElementwiseCompare(dense * vector, 1e-10f));
+        EXPECT_THROW(symmetric * ColumnVector<double>(size + 1), std::invalid_argument);
+    }
+
+    TEST(SymmetricMatrixTests, AddAndScale_WhenSameSize_ShouldEqualDense)
+    {
+        const size_t size = 70;
+        const Matrix<double> dense = CreateSymmetricTestMatrix(size);
+        const SymmetricMatrix<double> symmetric(dense);
+
+        const SymmetricMatrix<double> result = symmetric + symmetric * 0.5;
+        Matrix<double> expected(dense);
+        expected.Scale(1.5);
+
+        EXPECT_TRUE(result.ToMatrix().ElementwiseCompare(expected, 1e-12f));
+        SymmetricMatrix<double> other(size + 1);
+        EXPECT_THROW(other += symmetric, std::invalid_argument);
+    }
+}
@@ -0,0 +1,111 @@
+#include <LinearAlgebra/TaskGraph.hpp>
+#include <LinearAlgebra/ThreadPool.hpp>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace LinearAlgebra
+{
+    TEST(TaskGraphTests, Execute_WhenTasksDepend_ShouldRunAfterDependencies)
+    {
+        ThreadPool pool(4);
+        TaskGraph graph;
+        std::atomic<int> clock = 0;
+        std::vector<int> finished(6, -1);
+        const auto task = [&clock, &finished](const size_t id)
+        { return [&clock, &finished, id]()
+          { finished[id] = clock++; }; };
+
+        // Diamond 0 -> {1, 2, 3} -> 4, with 5 independent
+        const TaskGraph::TaskId first = graph.AddTask("first", task(0));
+        const TaskGraph::TaskId left = graph.AddTask("left", task(1), {first});
+        const TaskGraph::TaskId middle = graph.AddTask("middle", task(2), {first});
+        const TaskGraph::TaskId right = graph.AddTask("right", task(3), {first, first});
+        graph.AddTask("last", task(4), {left, middle, right});
+        graph.AddTask("independent", task(5));
+        graph.Execute(pool);
+
+        for (size_t id = 1; id < 4; id++)
+        {
+            EXPECT_GT(finished[id], finished[0]);
+            EXPECT_LT(finished[id], finished[4]);
+        }
+        EXPECT_NE(finished[5], -1);
+    }
+
+    TEST(TaskGraphTests, Execute_WhenManyTasks_ShouldRunEveryTaskOnce)
+    {
+        ThreadPool pool(3);
+        TaskGraph graph;
+        std::vector<std::atomic<int>> calls(200);
+        for (size_t i = 0; i < calls.size(); i++)
+        {
+            std::vector<TaskGraph::TaskId> dependencies;
+            if (i >= 10)
+                dependencies = {i - 10, i / 2};
+            graph.AddTask("task", [&calls, i]()
+                          { calls[i]++; },
+                          dependencies);
+        }
+        graph.Execute(pool);
+
+        for (size_t i = 0; i < calls.size(); i++)
+        {
+            EXPECT_EQ(calls[i].load(), 1) << "Task " << i << " is not called exactly once";
+        }
+        EXPECT_EQ(graph.GetProfile().Tasks.size(), calls.size());
+    }
+
+    TEST(TaskGraphTests, Execute_WhenTaskThrows_ShouldRethrowAndSkipSuccessors)
+    {
+        ThreadPool pool(4);
+        TaskGraph graph;
+        bool successorCalled = false;
+        const TaskGraph::TaskId failing = graph.AddTask("failing", []()
+                                                        { throw std::invalid_argument("Task failed"); });
+        graph.AddTask("successor", [&successorCalled]()
+                      { successorCalled = true; },
+                      {failing});
+
+        EXPECT_THROW(graph.Execute(pool), std::invalid_argument);
+        EXPECT_FALSE(successorCalled);
+    }
+
+    TEST(TaskGraphTests, AddTask_WhenDependencyNotAdded_ShouldThrow)
+    {
+        TaskGraph graph;
+        graph.AddTask("first", []() {});
+        EXPECT_THROW(graph.AddTask("second", []() {}, {1}), std::invalid_argument);
+    }
+
+    TEST(TaskGraphTests, GetProfile_WhenChainExecuted_ShouldReportChainAsCriticalPath)
+    {
+        ThreadPool pool(2);
+        TaskGraph graph;
+        const auto work = []()
+        {
+            volatile double sum = 0;
+            for (int i = 0; i < 100000; i++)
+                sum = sum + i;
+        };
+        const TaskGraph::TaskId a = graph.AddTask("a", work);
+        const TaskGraph::TaskId b = graph.AddTask("b", work, {a});
+        const TaskGraph::TaskId c = graph.AddTask("c", work, {b});
+        graph.Execute(pool);
+
+        const TaskGraphProfile& profile = graph.GetProfile();
+        EXPECT_EQ(profile.CriticalPath, std::vector<size_t>({a, b, c}));
+        EXPECT_GT(profile.CriticalPathSeconds, 0);
+        EXPECT_LE(profile.CriticalPathSeconds, profile.WallSeconds);
+        EXPECT_DOUBLE_EQ(profile.CriticalPathSeconds, profile.BusySeconds);
+        EXPECT_LE(profile.CriticalPathSeconds + profile.CriticalPathWaitSeconds, profile.WallSeconds);
+        for (const TaskTiming& timing : profile.Tasks)
+        {
+            EXPECT_LE(timing.ReadySeconds, timing.StartSeconds);
+            EXPECT_LE(timing.StartSeconds, timing.EndSeconds);
+            EXPECT_LT(timing.Thread, pool.GetThreadCount());
+        }
+        EXPECT_EQ(profile.Tasks[b].Name, "b");
+    }
+}
@@ -0,0 +1,76 @@
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/ThreadPool.hpp>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace LinearAlgebra
+{
+    TEST(ThreadPoolTests, ParallelFor_WhenCountGiven_ShouldCallEveryIndexOnce)
+    {
+        ThreadPool pool(4);
+        std::vector<std::atomic<int>> calls(1000);
+        pool.ParallelFor(calls.size(), [&calls](const size_t i)
+                         { calls[i]++; });
+
+        for (size_t i = 0; i < calls.size(); i++)
+        {
+            EXPECT_EQ(calls[i].load(), 1) << "Index " << i << " is not called exactly once";
+        }
+    }
+
+    TEST(ThreadPoolTests, ParallelFor_WhenNested_ShouldComplete)
+    {
+        ThreadPool pool(3);
+        std::atomic<int> sum = 0;
+        pool.ParallelFor(8, [&pool, &sum](const size_t)
+                         { pool.ParallelFor(8, [&sum](const size_t j)
+                                            { sum += static_cast<int>(j); }); });
+        EXPECT_EQ(sum.load(), 8 * 28);
+    }
+
+    TEST(ThreadPoolTests, ParallelFor_WhenIterationThrows_ShouldRethrow)
+    {
+        ThreadPool pool(4);
+        EXPECT_THROW(pool.ParallelFor(100, [](const size_t i)
+                                      { if (i == 42) throw std::invalid_argument("Iteration failed"); }),
+                     std::invalid_argument);
+    }
+
+    TEST(ThreadPoolTests, SetThreadCount_WhenCountGiven_ShouldResizeGlobalPool)
+    {
+        const size_t initialThreadCount = Parallel::GetThreadCount();
+        Parallel::SetThreadCount(3);
+        EXPECT_EQ(Parallel::GetThreadCount(), 3);
+        Parallel::SetThreadCount(initialThreadCount);
+        EXPECT_EQ(Parallel::GetThreadCount(), initialThreadCount);
+    }
+
+    TEST(ThreadPoolTests, ParallelProduct_WhenMultipleThreads_ShouldEqualSerialProduct)
+    {
+        const size_t initialThreadCount = Parallel::GetThreadCount();
+        Matrix<double> lhs(300, 257);
+        Matrix<double> rhs(257, 310);
+        ColumnVector<double> vector(257);
+        for (size_t i = 0; i < 300; i++)
+            for (size_t j = 0; j < 257; j++)
+                lhs(i, j) = static_cast<double>((i * 13 + j * 7) % 17) - 8;
+        for (size_t i = 0; i < 257; i++)
+            for (size_t j = 0; j < 310; j++)
+                rhs(i, j) = static_cast<double>((i * 5 + j * 11) % 13) - 6;
+        for (size_t i = 0; i < 257; i++)
+            vector[i] = static_cast<double>(i % 9) - 4;
+
+        Parallel::SetThreadCount(1);
+        Matrix<double> serialProduct = lhs * rhs;
+        ColumnVector<double> serialVectorProduct = lhs * vector;
+
+        Parallel::SetThreadCount(5);
+        Matrix<double> parallelProduct = lhs * rhs;
+        ColumnVector<double> parallelVectorProduct = lhs * vector;
+        Parallel::SetThreadCount(initialThreadCount);
+
+        EXPECT_TRUE(parallelProduct.ElementwiseEquals(serialProduct));
+        EXPECT_TRUE(parallelVectorProduct.ElementwiseEquals(serialVectorProduct));
+    }
+}
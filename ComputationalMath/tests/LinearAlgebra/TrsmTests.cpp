@@ -0,0 +1,130 @@
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/Trsm.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    // Diagonally dominant, such that the triangles are well conditioned and the solves accurate
+    template <typename T>
+    static Matrix<T> CreateTriangularTestMatrix(const size_t size)
+    {
+        Matrix<T> matrix(size, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t j = 0; j < size; j++)
+            {
+                matrix(i, j) = static_cast<T>(static_cast<int>((i * 7 + j * 3) % 11) - 5) / static_cast<T>(4 * size);
+            }
+            matrix(i, i) = static_cast<T>(2 + i % 3);
+        }
+        return matrix;
+    }
+
+    template <typename T>
+    static Matrix<T> CreateRightHandSides(const size_t rowCount, const size_t columnCount)
+    {
+        Matrix<T> matrix(rowCount, columnCount);
+        for (size_t i = 0; i < rowCount; i++)
+        {
+            for (size_t j = 0; j < columnCount; j++)
+            {
+                matrix(i, j) = static_cast<T>(static_cast<int>((i * 5 + j * 2) % 13) - 6);
+            }
+        }
+        return matrix;
+    }
+
+    // Product of the triangle of A and X, the reference that the solve should reproduce
+    template <typename T>
+    static Matrix<T> TriangularProduct(const Blas::Triangle triangle, const Blas::Diagonal diagonal, const Matrix<T>& A, const Matrix<T>& X)
+    {
+        Matrix<T> product(X.GetRowCount(), X.GetColumnCount());
+        for (size_t i = 0; i < A.GetRowCount(); i++)
+        {
+            for (size_t j = 0; j < X.GetColumnCount(); j++)
+            {
+                T sum = diagonal == Blas::Diagonal::Unit ? X(i, j) : A(i, i) * X(i, j);
+                const size_t begin = triangle == Blas::Triangle::Lower ? 0 : i + 1;
+                const size_t end = triangle == Blas::Triangle::Lower ? i : A.GetColumnCount();
+                for (size_t k = begin; k < end; k++)
+                {
+                    sum += A(i, k) * X(k, j);
+                }
+                product(i, j) = sum;
+            }
+        }
+        return product;
+    }
+
+    template <typename T>
+    class TrsmTypedTests : public ::testing::Test
+    {
+    };
+
+    using TrsmTypes = ::testing::Types<float, double>;
+    TYPED_TEST_SUITE(TrsmTypedTests, TrsmTypes);
+
+    TYPED_TEST(TrsmTypedTests, Trsm_WhenLargerThanBlockSizes_ShouldSolveTriangularSystem)
+    {
+        // Dimensions are no multiple of the row or column blocks to also cover the edge blocks
+        const size_t size = 157;
+        const size_t columnCount = 301;
+        const Matrix<TypeParam> A = CreateTriangularTestMatrix<TypeParam>(size);
+        const Matrix<TypeParam> B = CreateRightHandSides<TypeParam>(size, columnCount);
+
+        for (const Blas::Triangle triangle : {Blas::Triangle::Lower, Blas::Triangle::Upper})
+        {
+            for (const Blas::Diagonal diagonal : {Blas::Diagonal::NonUnit, Blas::Diagonal::Unit})
+            {
+                Matrix<TypeParam> X(B);
+                Blas::Trsm(triangle, diagonal, size, columnCount, A.Data(), A.GetLeadingDimension(), X.Data(), X.GetLeadingDimension());
+                EXPECT_TRUE(TriangularProduct(triangle, diagonal, A, X).ElementwiseCompare(B, 1e-3f))
+                    << "Solve is not correct for " << (triangle == Blas::Triangle::Lower ? "lower" : "upper")
+                    << (diagonal == Blas::Diagonal::Unit ? " unit" : "") << " triangle";
+            }
+        }
+    }
+
+    TEST(TrsmTests, ParallelTrsm_WhenSolvedOnPool_ShouldEqualBlockedTrsm)
+    {
+        const size_t size = 131;
+        const size_t columnCount = 530;
+        const Matrix<double> A = CreateTriangularTestMatrix<double>(size);
+        Matrix<double> expected = CreateRightHandSides<double>(size, columnCount);
+        Matrix<double> actual(expected);
+
+        ThreadPool pool(4);
+        Blas::BlockedTrsm(Blas::Triangle::Upper, Blas::Diagonal::NonUnit, size, columnCount, A.Data(), A.GetLeadingDimension(), expected.Data(), expected.GetLeadingDimension());
+        Blas::ParallelTrsm(Blas::Triangle::Upper, Blas::Diagonal::NonUnit, size, columnCount, A.Data(), A.GetLeadingDimension(), actual.Data(), actual.GetLeadingDimension(), pool);
+
+        EXPECT_TRUE(actual.ElementwiseCompare(expected, 1e-12f));
+    }
+
+    TEST(TrsmTests, SubstitutionInPlace_WhenMatrixGiven_ShouldEqualColumnByColumnSubstitution)
+    {
+        const size_t size = 97;
+        const Matrix<double> A = CreateTriangularTestMatrix<double>(size);
+        Matrix<double> rhs = CreateRightHandSides<double>(size, size);
+
+        Matrix<double> expected(rhs);
+        for (size_t j = 0; j < size; j++)
+        {
+            ColumnVector<double> column(size);
+            for (size_t i = 0; i < size; i++)
+            {
+                column[i] = rhs(i, j);
+            }
+            Factorization::ForwardSubstitutionInPlace(A, column);
+            Factorization::BackwardSubstitutionInPlace(A, column);
+            for (size_t i = 0; i < size; i++)
+            {
+                expected(i, j) = column[i];
+            }
+        }
+
+        Factorization::ForwardSubstitutionInPlace(A, rhs);
+        Factorization::BackwardSubstitutionInPlace(A, rhs);
+        EXPECT_TRUE(rhs.ElementwiseCompare(expected, 1e-10f));
+    }
+}
@@ -1,5 +1,7 @@
 #include <LinearAlgebra/VectorBase.hpp>
+#include <cmath>
 #include <gtest/gtest.h>
+#include <limits>
 #include <memory>
 
 namespace LinearAlgebra
@@ -299,4 +301,95 @@ namespace LinearAlgebra
         }
         EXPECT_EQ(count, 5);
     }
-}
\ No newline at end of file
+
+    TEST(VectorBaseTests, CopyConstructor_WhenModifyingCopy_ShouldNotModifyOriginal)
+    {
+        ColumnVector<int> vector = {1, 2, 3};
+        ColumnVector<int> copy(vector);
+        copy[0] = 10;
+        EXPECT_EQ(vector[0], 1);
+        EXPECT_NE(copy.Data(), vector.Data());
+    }
+
+    TEST(VectorBaseTests, MoveConstructor_WhenMoved_ShouldTakeStorage)
+    {
+        ColumnVector<int> vector = {1, 2, 3};
+        const int* storage = vector.Data();
+        ColumnVector<int> moved(std::move(vector));
+        EXPECT_EQ(moved.Data(), storage);
+        EXPECT_EQ(moved.GetLength(), 3);
+        EXPECT_EQ(vector.GetLength(), 0);
+    }
+
+    TEST(VectorBaseTests, CopyAssignment_WhenSameLength_ShouldReuseStorage)
+    {
+        ColumnVector<int> vector = {1, 2, 3};
+        ColumnVector<int> other = {4, 5, 6};
+        const int* storage = vector.Data();
+        vector = other;
+        EXPECT_EQ(vector.Data(), storage);
+        EXPECT_TRUE(vector.ElementwiseEquals(other));
+    }
+
+    TEST(VectorBaseTests, CompoundAssignment_WhenSameLength_ShouldUpdateInPlace)
+    {
+        ColumnVector<int> vector = {1, 2, 3};
+        ColumnVector<int> other = {4, 5, 6};
+        const int* storage = vector.Data();
+
+        vector += other;
+        EXPECT_TRUE(vector.ElementwiseEquals(ColumnVector<int>({5, 7, 9})));
+        vector -= 2 * other;
+        EXPECT_TRUE(vector.ElementwiseEquals(ColumnVector<int>({-3, -3, -3})));
+        vector *= -2;
+        EXPECT_TRUE(vector.ElementwiseEquals(ColumnVector<int>({6, 6, 6})));
+        EXPECT_EQ(vector.Data(), storage);
+    }
+
+    TEST(VectorBaseTests, CompoundAssignment_WhenNotSameLength_ShouldThrow)
+    {
+        RowVector<int> vector(3);
+        RowVector<int> other(4);
+        EXPECT_THROW(vector += other, std::invalid_argument);
+        EXPECT_THROW(vector -= other, std::invalid_argument);
+    }
+
+    TEST(VectorBaseTests, Axpy_WhenSameLength_ShouldAddScaledVector)
+    {
+        ColumnVector<double> y(11);
+        ColumnVector<double> x(11);
+        y.Fill(1.0);
+        x.Fill(2.0);
+        y.Axpy(0.5, x);
+        for (size_t i = 0; i < y.GetLength(); i++)
+        {
+            EXPECT_DOUBLE_EQ(y[i], 2.0);
+        }
+        EXPECT_THROW(y.Axpy(1.0, ColumnVector<double>(10)), std::invalid_argument);
+    }
+
+    TEST(VectorBaseTests, DotAndNorm_WhenSameLength_ShouldReturnInnerProductAndNorm)
+    {
+        ColumnVector<float> x = {1, 2, 3, 4, 5, 6, 7};
+        ColumnVector<float> y = {7, 6, 5, 4, 3, 2, 1};
+        EXPECT_FLOAT_EQ(x.Dot(y), 84.0f);
+        EXPECT_FLOAT_EQ(ColumnVector<float>({3, 4}).Norm2(), 5.0f);
+        EXPECT_THROW(x.Dot(ColumnVector<float>(3)), std::invalid_argument);
+    }
+
+    TEST(VectorBaseTests, Norm2_WhenEntriesNearFloatLimits_ShouldNotOverflowOrUnderflow)
+    {
+        EXPECT_FLOAT_EQ(ColumnVector<float>({3e30f, 4e30f}).Norm2(), 5e30f);
+        EXPECT_FLOAT_EQ(ColumnVector<float>({3e-30f, 4e-30f}).Norm2(), 5e-30f);
+        EXPECT_FLOAT_EQ(ColumnVector<float>({std::numeric_limits<float>::max(), 0.0f}).Norm2(), std::numeric_limits<float>::max());
+        EXPECT_FLOAT_EQ(ColumnVector<float>({std::numeric_limits<float>::denorm_min(), 0.0f}).Norm2(), std::numeric_limits<float>::denorm_min());
+        EXPECT_EQ(ColumnVector<float>({0.0f, 0.0f}).Norm2(), 0.0f);
+        EXPECT_TRUE(std::isinf(ColumnVector<float>({std::numeric_limits<float>::infinity(), 1.0f}).Norm2()));
+        EXPECT_TRUE(std::isnan(ColumnVector<float>({std::numeric_limits<float>::quiet_NaN(), 1e30f}).Norm2()));
+
+        // Squares near the double limits
+        ColumnVector<double> large(20);
+        large.Fill(1e200);
+        EXPECT_DOUBLE_EQ(large.Norm2(), std::sqrt(20.0) * 1e200);
+    }
+}
@@ -0,0 +1,155 @@
+#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/MatrixView.hpp>
+#include <LinearAlgebra/VectorView.hpp>
+#include <gtest/gtest.h>
+
+namespace LinearAlgebra
+{
+    static Matrix<int> CreateViewTestMatrix()
+    {
+        return Matrix<int>({{1, 2, 3, 4},
+                            {5, 6, 7, 8},
+                            {9, 10, 11, 12}});
+    }
+
+    TEST(ViewTests, GetRow_WhenModified_ShouldModifyMatrix)
+    {
+        Matrix<int> matrix = CreateViewTestMatrix();
+        VectorView<int, RowVector<int>> row = matrix.GetRow(1);
+        EXPECT_EQ(row.Data(), matrix.Data() + 4);
+
+        row[2] = 100;
+        EXPECT_EQ(matrix(1, 2), 100);
+    }
+
+    TEST(ViewTests, GetColumn_WhenIndexIsGiven_ShouldBeStrided)
+    {
+        Matrix<int> matrix = CreateViewTestMatrix();
+        VectorView<int, ColumnVector<int>> column = matrix.GetColumn(2);
+        EXPECT_EQ(column.GetLength(), 3);
+        EXPECT_EQ(column.GetStride(), 4);
+        EXPECT_TRUE(column.ElementwiseEquals(ColumnVector<int>({3, 7, 11})));
+        EXPECT_THROW(column.GetValue(3), std::out_of_range);
+    }
+
+    TEST(ViewTests, Assignment_WhenExpressionIsAssigned_ShouldWriteThroughView)
+    {
+        Matrix<int> matrix = CreateViewTestMatrix();
+        ColumnVector<int> vector = {1, 1, 1};
+
+        matrix.GetColumn(0) = matrix.GetColumn(1) + vector * 2;
+        matrix.GetRow(2) -= matrix.GetRow(0);
+
+        Matrix<int> expected = {{4, 2, 3, 4},
+                                {8, 6, 7, 8},
+                                {8, 8, 8, 8}};
+        EXPECT_TRUE(matrix.ElementwiseEquals(expected));
+        EXPECT_THROW(matrix.GetRow(0) = matrix.GetColumn(0).Transposed(), std::invalid_argument);
+    }
+
+    TEST(ViewTests, Transposed_WhenVectorIsTransposed_ShouldShareStorage)
+    {
+        ColumnVector<int> column = {1, 2, 3};
+        RowVector<int> row = {4, 5, 6};
+
+        VectorView<int, RowVector<int>> transposed = column.Transposed();
+        transposed[0] = 10;
+
+        EXPECT_EQ(column[0], 10);
+        EXPECT_EQ(transposed.Data(), column.Data());
+        EXPECT_EQ(row * column.Transposed().Transposed(), 68);
+    }
+
+    TEST(ViewTests, Block_WhenInRange_ShouldViewSubmatrix)
+    {
+        Matrix<int> matrix = CreateViewTestMatrix();
+        MatrixView<int> block = matrix.Block(1, 1, 2, 2);
+
+        EXPECT_TRUE(block.ElementwiseEquals(Matrix<int>({{6, 7}, {10, 11}})));
+        EXPECT_TRUE(block.GetRow(1).ElementwiseEquals(RowVector<int>({10, 11})));
+        EXPECT_THROW(matrix.Block(2, 2, 2, 2), std::out_of_range);
+
+        block *= 2;
+        EXPECT_EQ(matrix(2, 2), 22);
+        EXPECT_EQ(matrix(0, 0), 1);
+    }
+
+    TEST(ViewTests, TransposedView_WhenMaterialized_ShouldEqualTransposed)
+    {
+        const Matrix<int> matrix = CreateViewTestMatrix();
+        MatrixView<const int> transposed = matrix.TransposedView();
+
+        EXPECT_EQ(transposed.GetRowCount(), 4);
+        EXPECT_EQ(transposed.GetColumnCount(), 3);
+        EXPECT_EQ(transposed.Data(), matrix.Data());
+
+        Matrix<int> copy = transposed;
+        EXPECT_TRUE(copy.ElementwiseEquals(matrix.Transposed()));
+
+        Matrix<int> sum = transposed + matrix.Transposed();
+        EXPECT_TRUE(sum.ElementwiseEquals(Matrix<int>(matrix.Transposed() * 2)));
+    }
+
+    TEST(ViewTests, Assignment_WhenExpressionReadsTransposedDestination_ShouldUseOriginalValues)
+    {
+        Matrix<int> matrix({{1, 2, 3},
+                            {4, 5, 6},
+                            {7, 8, 9}});
+        const Matrix<int> expected({{2, 6, 10},
+                                    {6, 10, 14},
+                                    {10, 14, 18}});
+        const MatrixView<int> view = matrix.View();
+
+        matrix = matrix.TransposedView() + matrix;
+        EXPECT_TRUE(matrix.ElementwiseEquals(expected));
+        EXPECT_EQ(view.Data(), matrix.Data()) << "Assignment should keep the storage";
+
+        matrix = Matrix<int>({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+        matrix += matrix.TransposedView();
+        EXPECT_TRUE(matrix.ElementwiseEquals(expected));
+    }
+
+    TEST(ViewTests, Assignment_WhenBlocksOverlap_ShouldUseOriginalValues)
+    {
+        Matrix<int> matrix = CreateViewTestMatrix();
+        matrix.Block(0, 1, 3, 3) = matrix.Block(0, 0, 3, 3);
+        EXPECT_TRUE(matrix.ElementwiseEquals(Matrix<int>({{1, 1, 2, 3},
+                                                          {5, 5, 6, 7},
+                                                          {9, 9, 10, 11}})));
+    }
+
+    TEST(ViewTests, View_WhenParentIsDestroyed_ShouldKeepStorage)
+    {
+        MatrixView<int> view = CreateViewTestMatrix().Block(0, 0, 2, 2);
+        EXPECT_TRUE(view.ElementwiseEquals(Matrix<int>({{1, 2}, {5, 6}})));
+    }
+
+    TEST(ViewTests, Product_WhenViewsAreMultiplied_ShouldEqualMatrixProduct)
+    {
+        const Matrix<double> matrix = {{1, 2, 3},
+                                       {4, 5, 6},
+                                       {7, 8, 10}};
+        const Matrix<double> transposed = matrix.Transposed();
+        ColumnVector<double> vector = {1, -1, 2};
+
+        EXPECT_TRUE((matrix.TransposedView() * matrix).ElementwiseCompare(transposed * matrix, 1e-12f));
+        EXPECT_TRUE((matrix * matrix.TransposedView()).ElementwiseCompare(matrix * transposed, 1e-12f));
+        EXPECT_TRUE((matrix.Block(0, 1, 3, 2).Transposed() * matrix.Block(0, 0, 3, 2)).ElementwiseCompare(Matrix<double>({{78, 93}, {97, 116}}), 1e-12f));
+        EXPECT_TRUE((matrix.TransposedView() * vector).ElementwiseCompare(transposed * vector, 1e-12f));
+        EXPECT_TRUE((matrix.Block(1, 0, 2, 3) * vector).ElementwiseCompare(ColumnVector<double>({11, 19}), 1e-12f));
+        EXPECT_THROW(matrix.Block(0, 0, 2, 2) * vector, std::invalid_argument);
+    }
+
+    TEST(ViewTests, LUSolve_WhenViewIsGiven_ShouldSolveViewedSystem)
+    {
+        const Matrix<double> matrix = {{4, 1, 100},
+                                       {2, 3, 100}};
+        ColumnVector<double> rhs = {6, 8};
+
+        ColumnVector<double> solution = Factorization::LUSolve(matrix.Block(0, 0, 2, 2), rhs, 1e-12);
+
+        EXPECT_TRUE(solution.ElementwiseCompare(ColumnVector<double>({1, 2}), 1e-12f));
+        EXPECT_NEAR(Factorization::Determinant(matrix.Block(0, 0, 2, 2).Transposed(), 1e-12), 10.0, 1e-12);
+    }
+}
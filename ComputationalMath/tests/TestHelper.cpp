@@ -1,5 +1,8 @@
 #include "TestHelper.hpp"
 
+#include <array>
+#include <cmath>
+
 bool TestHelper::TriangleElementCyclicalEqual(Geometry::TriangleElement element1, Geometry::TriangleElement element2)
 {
     return (element1.I == element2.I && element1.J == element2.J && element1.K == element2.K) ||
@@ -16,4 +19,85 @@ bool TestHelper::LineElementCyclicalEqual(Geometry::LineElement element1, Geomet
 bool TestHelper::Vertex2FNearlyEqual(Geometry::Vertex2F vertex1, Geometry::Vertex2F vertex2)
 {
     return (vertex1 - vertex2).LengthSquared() < 1e-9f;
-}
\ No newline at end of file
+}
+
+double TestHelper::RandomGenerator::NextValue()
+{
+    m_state = m_state * 1103515245u + 12345u;
+    return static_cast<double>((m_state >> 16) % 2001) / 1000.0 - 1.0;
+}
+
+size_t TestHelper::RandomGenerator::NextIndex(const size_t count)
+{
+    m_state = m_state * 1103515245u + 12345u;
+    return (m_state >> 8) % count;
+}
+
+LinearAlgebra::Matrix<double> TestHelper::CreateRandomMatrix(const size_t size, const unsigned int seed)
+{
+    RandomGenerator random(seed);
+    LinearAlgebra::Matrix<double> matrix(size, size);
+    for (size_t i = 0; i < size; i++)
+    {
+        for (size_t j = 0; j < size; j++)
+        {
+            matrix(i, j) = random.NextValue();
+        }
+    }
+    return matrix;
+}
+
+LinearAlgebra::ColumnVector<double> TestHelper::CreateRightHandSide(const size_t length)
+{
+    LinearAlgebra::ColumnVector<double> rhs(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        rhs[i] = static_cast<double>((i * 7 + 3) % 11) - 5.0;
+    }
+    return rhs;
+}
+
+LinearAlgebra::SparseMatrix<double> TestHelper::CreateShiftedLaplacian(const size_t size, const double shift)
+{
+    using LinearAlgebra::SparseIndex;
+    std::vector<LinearAlgebra::SparseEntry<double>> entries;
+    for (size_t i = 0; i < size; i++)
+    {
+        for (size_t j = 0; j < size; j++)
+        {
+            const SparseIndex row = static_cast<SparseIndex>(i * size + j);
+            entries.push_back({row, row, 4.0 + shift});
+            if (i > 0)
+                entries.push_back({row, static_cast<SparseIndex>(row - size), -1.0});
+            if (i + 1 < size)
+                entries.push_back({row, static_cast<SparseIndex>(row + size), -1.0});
+            if (j > 0)
+                entries.push_back({row, row - 1, -1.0});
+            if (j + 1 < size)
+                entries.push_back({row, row + 1, -1.0});
+        }
+    }
+    return LinearAlgebra::SparseMatrix<double>(size * size, size * size, entries);
+}
+
+LinearAlgebra::SparseMatrix<double> TestHelper::AssembleOperator(const Geometry::Mesh2D& mesh, const double shift)
+{
+    std::vector<LinearAlgebra::SparseEntry<double>> entries;
+    for (const Geometry::TriangleElement& element : mesh.Interior)
+    {
+        const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+        const Geometry::Vertex2F v0 = mesh.Vertices[element.I], v1 = mesh.Vertices[element.J], v2 = mesh.Vertices[element.K];
+        const double area = 0.5 * std::abs((v1.X - v0.X) * (v2.Y - v0.Y) - (v2.X - v0.X) * (v1.Y - v0.Y));
+        const std::array<std::array<double, 2>, 3> gradients = {{{v1.Y - v2.Y, v2.X - v1.X}, {v2.Y - v0.Y, v0.X - v2.X}, {v0.Y - v1.Y, v1.X - v0.X}}};
+        for (size_t a = 0; a < 3; a++)
+        {
+            for (size_t b = 0; b < 3; b++)
+            {
+                const double stiffness = (gradients[a][0] * gradients[b][0] + gradients[a][1] * gradients[b][1]) / (4 * area);
+                const double mass = area / 12 * (a == b ? 2 : 1);
+                entries.push_back({indices[a], indices[b], stiffness + shift * mass});
+            }
+        }
+    }
+    return LinearAlgebra::SparseMatrix<double>(mesh.Vertices.size(), mesh.Vertices.size(), entries);
+}
@@ -1,6 +1,10 @@
 #pragma once
+#include <Geometry/Structures/Mesh2D.hpp>
 #include <Geometry/Structures/SimplexElements.hpp>
 #include <Geometry/Structures/Vertex.hpp>
+#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
+#include <LinearAlgebra/VectorBase.hpp>
 #include <algorithm>
 #include <functional>
 #include <gtest/gtest.h>
@@ -122,6 +126,50 @@ namespace TestHelper
     bool LineElementCyclicalEqual(Geometry::LineElement element1, Geometry::LineElement element2);
 
     bool Vertex2FNearlyEqual(Geometry::Vertex2F vertex1, Geometry::Vertex2F vertex2);
+
+    /// <summary>
+    /// Linear congruential generator, such that the random test data is the same on every platform and every run.
+    /// </summary>
+    class RandomGenerator
+    {
+    public:
+        explicit RandomGenerator(unsigned int seed) : m_state(seed) {}
+
+        /// <summary>
+        /// Next value in [-1, 1], in steps of 1e-3.
+        /// </summary>
+        double NextValue();
+
+        /// <summary>
+        /// Next index in [0, count).
+        /// </summary>
+        size_t NextIndex(size_t count);
+
+    private:
+        unsigned int m_state;
+    };
+
+    /// <summary>
+    /// Square matrix of which the entries are the values of RandomGenerator(seed), row by row. Its factorizations
+    /// with partial pivoting swap rows.
+    /// </summary>
+    LinearAlgebra::Matrix<double> CreateRandomMatrix(size_t size, unsigned int seed);
+
+    /// <summary>
+    /// Right-hand side of integers in [-5, 5], without structure that a solver could exploit.
+    /// </summary>
+    LinearAlgebra::ColumnVector<double> CreateRightHandSide(size_t length);
+
+    /// <summary>
+    /// 5-point Laplacian of a size x size grid with Dirichlet boundaries, shifted by shift * I.
+    /// </summary>
+    LinearAlgebra::SparseMatrix<double> CreateShiftedLaplacian(size_t size, double shift);
+
+    /// <summary>
+    /// P1 discretization of -\nabla^2 u + shift * u on mesh with natural boundary conditions, with the consistent mass
+    /// matrix.
+    /// </summary>
+    LinearAlgebra::SparseMatrix<double> AssembleOperator(const Geometry::Mesh2D& mesh, double shift);
 }
 
 #define EXPECT_EQUIVALENT(a, b) EXPECT_TRUE(TestHelper::AreEquivalent(a, b))
@@ -1,4 +1,7 @@
 #include "FemAssembler.hpp"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 #include <unordered_set>
 
 namespace FemAssembler
@@ -26,55 +29,196 @@ namespace FemAssembler
         return result;
     }
 
-    void Add_Matrix_NablaA_NablaV(const Geometry::Mesh2D& mesh, Matrix<float>& matrix, const float scalar)
+    namespace
     {
-        for (const auto& element : mesh.Interior)
+        // Adds value to both (row, column) and (column, row)
+        void AddSymmetric(Matrix<float>& matrix, const unsigned int row, const unsigned int column, const float value)
         {
-            const Geometry::Vertex2F vertex0 = mesh.Vertices[element.I];
-            const Geometry::Vertex2F vertex1 = mesh.Vertices[element.J];
-            const Geometry::Vertex2F vertex2 = mesh.Vertices[element.K];
+            matrix(row, column) += value;
+            if (row != column)
+                matrix(column, row) += value;
+        }
+
+        // Dense targets are indexed by vertex, the element and its local vertices are not needed
+        struct VertexTarget
+        {
+            LinearAlgebra::Matrix<float>& Matrix;
+
+            void Add(const size_t, const std::array<unsigned int, 3>& indices, const size_t a, const size_t b, const float value)
+            {
+                AddSymmetric(Matrix, indices[a], indices[b], value);
+            }
+        };
 
-            Matrix<float> jacobian = Jacobian(vertex0, vertex1, vertex2);
-            const float detJ = Matrix<float>::Determinant(jacobian(0, 0), jacobian(0, 1), jacobian(1, 0), jacobian(1, 1));
-            Matrix<float> invJT = Factorization::InverseMatrix(jacobian, 1e-5f).Transposed();
-
-            ColumnVector<float> nablaPhi0 = invJT * ColumnVector<float>({-1, -1});
-            ColumnVector<float> nablaPhi1 = invJT * ColumnVector<float>({1, 0});
-            ColumnVector<float> nablaPhi2 = invJT * ColumnVector<float>({0, 1});
-
-            matrix(element.I, element.I) += scalar * 0.5f * detJ * nablaPhi0.Transposed() * nablaPhi0;
-            matrix(element.J, element.I) += scalar * 0.5f * detJ * nablaPhi1.Transposed() * nablaPhi0;
-            matrix(element.K, element.I) += scalar * 0.5f * detJ * nablaPhi2.Transposed() * nablaPhi0;
-            matrix(element.I, element.J) += scalar * 0.5f * detJ * nablaPhi0.Transposed() * nablaPhi1;
-            matrix(element.J, element.J) += scalar * 0.5f * detJ * nablaPhi1.Transposed() * nablaPhi1;
-            matrix(element.K, element.J) += scalar * 0.5f * detJ * nablaPhi2.Transposed() * nablaPhi1;
-            matrix(element.I, element.K) += scalar * 0.5f * detJ * nablaPhi0.Transposed() * nablaPhi2;
-            matrix(element.J, element.K) += scalar * 0.5f * detJ * nablaPhi1.Transposed() * nablaPhi2;
-            matrix(element.K, element.K) += scalar * 0.5f * detJ * nablaPhi2.Transposed() * nablaPhi2;
+        // Sparse targets add to the slots of local vertices (a, b) and (b, a) of the element
+        struct SlotTarget
+        {
+            SparseMatrix<float>& Matrix;
+            const SparsePattern& Pattern;
+
+            void Add(const size_t element, const std::array<unsigned int, 3>&, const size_t a, const size_t b, const float value)
+            {
+                const std::array<SparseIndex, 9>& slots = Pattern.ElementSlots[element];
+                Matrix.Values()[slots[3 * a + b]] += value;
+                if (a != b)
+                    Matrix.Values()[slots[3 * b + a]] += value;
+            }
+        };
+
+        SlotTarget CreateSlotTarget(const Geometry::Mesh2D& mesh, const SparsePattern& pattern, SparseMatrix<float>& matrix)
+        {
+            if (pattern.ElementSlots.size() != mesh.Interior.size() || matrix.GetNonZeroCount() != pattern.ColumnIndices.size() ||
+                matrix.GetRowCount() != pattern.VertexCount)
+                throw std::invalid_argument("Sparse matrix does not match the sparsity pattern of the mesh");
+            return SlotTarget{matrix, pattern};
+        }
+
+        template <typename TTarget>
+        void AddNablaANablaV(const Geometry::Mesh2D& mesh, TTarget target, const float scalar)
+        {
+            for (size_t e = 0; e < mesh.Interior.size(); e++)
+            {
+                const auto& element = mesh.Interior[e];
+                const Geometry::Vertex2F vertex0 = mesh.Vertices[element.I];
+                const Geometry::Vertex2F vertex1 = mesh.Vertices[element.J];
+                const Geometry::Vertex2F vertex2 = mesh.Vertices[element.K];
+
+                const SmallMatrix<float, 2, 2> jacobian = Jacobian(vertex0, vertex1, vertex2);
+                const float detJ = jacobian.Determinant();
+                const SmallMatrix<float, 2, 2> invJT = jacobian.Inverse().Transposed();
+
+                const std::array<SmallVector<float, 2>, 3> nablaPhi = {invJT * SmallVector<float, 2>(-1, -1),
+                                                                       invJT * SmallVector<float, 2>(1, 0),
+                                                                       invJT * SmallVector<float, 2>(0, 1)};
+                const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+
+                for (size_t a = 0; a < 3; a++)
+                {
+                    for (size_t b = a; b < 3; b++)
+                    {
+                        target.Add(e, indices, b, a, scalar * 0.5f * detJ * Dot(nablaPhi[b], nablaPhi[a]));
+                    }
+                }
+            }
+        }
+
+        template <typename TTarget>
+        void AddUV(const Geometry::Mesh2D& mesh, TTarget target, const float scalar)
+        {
+            for (size_t e = 0; e < mesh.Interior.size(); e++)
+            {
+                const auto& element = mesh.Interior[e];
+                const Geometry::Vertex2F vertex0 = mesh.Vertices[element.I];
+                const Geometry::Vertex2F vertex1 = mesh.Vertices[element.J];
+                const Geometry::Vertex2F vertex2 = mesh.Vertices[element.K];
+
+                const float detJ = Jacobian(vertex0, vertex1, vertex2).Determinant();
+                const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+
+                target.Add(e, indices, 0, 0, scalar * detJ / 12);
+                target.Add(e, indices, 1, 0, scalar * detJ / 24);
+                target.Add(e, indices, 2, 0, scalar * detJ / 24);
+                target.Add(e, indices, 1, 1, scalar * detJ / 12);
+                target.Add(e, indices, 2, 1, scalar * detJ / 24);
+                target.Add(e, indices, 2, 2, scalar * detJ / 12);
+            }
+        }
+
+        std::vector<unsigned int> GetEssentialBoundaryIndices(const Geometry::Mesh2D& mesh, ColumnVector<float>& column, const std::function<bool(Geometry::Vertex2F, float& output)>& essentialBoundaryFunc)
+        {
+            std::unordered_set<unsigned int> boundaryIndices;
+            for (const auto& boundaryElement : mesh.Boundary)
+            {
+                boundaryIndices.insert(boundaryElement.I);
+                boundaryIndices.insert(boundaryElement.J);
+            }
+
+            std::vector<unsigned int> essentialIndices;
+            for (const unsigned int boundaryIndex : boundaryIndices)
+            {
+                const Geometry::Vertex2F vertex0 = mesh.Vertices[boundaryIndex];
+                float value = 0;
+
+                if (!essentialBoundaryFunc(vertex0, value))
+                    continue;
+
+                essentialIndices.push_back(boundaryIndex);
+                column[boundaryIndex] = value;
+            }
+            return essentialIndices;
         }
     }
 
-    void Add_Matrix_U_V(const Geometry::Mesh2D& mesh, Matrix<float>& matrix, const float scalar)
+    SparsePattern CreateSparsePattern(const Geometry::Mesh2D& mesh)
     {
+        SparsePattern pattern;
+        pattern.VertexCount = mesh.Vertices.size();
+
+        // Every vertex couples to itself and the vertices of its elements, duplicates are removed per row
+        std::vector<std::vector<SparseIndex>> rows(pattern.VertexCount);
         for (const auto& element : mesh.Interior)
         {
-            const Geometry::Vertex2F vertex0 = mesh.Vertices[element.I];
-            const Geometry::Vertex2F vertex1 = mesh.Vertices[element.J];
-            const Geometry::Vertex2F vertex2 = mesh.Vertices[element.K];
+            const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+            for (const unsigned int row : indices)
+            {
+                for (const unsigned int column : indices)
+                    rows[row].push_back(column);
+            }
+        }
 
-            Matrix<float> jacobian = Jacobian(vertex0, vertex1, vertex2);
-            const float detJ = Matrix<float>::Determinant(jacobian(0, 0), jacobian(0, 1), jacobian(1, 0), jacobian(1, 1));
-
-            matrix(element.I, element.I) += scalar * detJ / 12;
-            matrix(element.J, element.I) += scalar * detJ / 24;
-            matrix(element.K, element.I) += scalar * detJ / 24;
-            matrix(element.I, element.J) += scalar * detJ / 24;
-            matrix(element.J, element.J) += scalar * detJ / 12;
-            matrix(element.K, element.J) += scalar * detJ / 24;
-            matrix(element.I, element.K) += scalar * detJ / 24;
-            matrix(element.J, element.K) += scalar * detJ / 24;
-            matrix(element.K, element.K) += scalar * detJ / 12;
+        pattern.RowOffsets.resize(pattern.VertexCount + 1, 0);
+        for (size_t i = 0; i < pattern.VertexCount; i++)
+        {
+            std::vector<SparseIndex>& row = rows[i];
+            row.push_back(static_cast<SparseIndex>(i));
+            std::sort(row.begin(), row.end());
+            row.erase(std::unique(row.begin(), row.end()), row.end());
+            pattern.ColumnIndices.insert(pattern.ColumnIndices.end(), row.begin(), row.end());
+            pattern.RowOffsets[i + 1] = static_cast<SparseIndex>(pattern.ColumnIndices.size());
+            std::vector<SparseIndex>().swap(row);
+        }
+
+        pattern.ElementSlots.reserve(mesh.Interior.size());
+        for (const auto& element : mesh.Interior)
+        {
+            const std::array<unsigned int, 3> indices = {element.I, element.J, element.K};
+            std::array<SparseIndex, 9> slots;
+            for (size_t a = 0; a < 3; a++)
+            {
+                const SparseIndex* begin = pattern.ColumnIndices.data() + pattern.RowOffsets[indices[a]];
+                const SparseIndex* end = pattern.ColumnIndices.data() + pattern.RowOffsets[indices[a] + 1];
+                for (size_t b = 0; b < 3; b++)
+                    slots[3 * a + b] = static_cast<SparseIndex>(std::lower_bound(begin, end, indices[b]) - pattern.ColumnIndices.data());
+            }
+            pattern.ElementSlots.push_back(slots);
         }
+        return pattern;
+    }
+
+    SparseMatrix<float> InitializeSparseMatrix(const SparsePattern& pattern)
+    {
+        return SparseMatrix<float>(pattern.VertexCount, pattern.VertexCount, pattern.RowOffsets, pattern.ColumnIndices,
+                                   std::vector<float>(pattern.ColumnIndices.size(), 0.0f));
+    }
+
+    void Add_Matrix_NablaA_NablaV(const Geometry::Mesh2D& mesh, Matrix<float>& matrix, const float scalar)
+    {
+        AddNablaANablaV(mesh, VertexTarget{matrix}, scalar);
+    }
+
+    void Add_Matrix_NablaA_NablaV(const Geometry::Mesh2D& mesh, const SparsePattern& pattern, SparseMatrix<float>& matrix, const float scalar)
+    {
+        AddNablaANablaV(mesh, CreateSlotTarget(mesh, pattern, matrix), scalar);
+    }
+
+    void Add_Matrix_U_V(const Geometry::Mesh2D& mesh, Matrix<float>& matrix, const float scalar)
+    {
+        AddUV(mesh, VertexTarget{matrix}, scalar);
+    }
+
+    void Add_Matrix_U_V(const Geometry::Mesh2D& mesh, const SparsePattern& pattern, SparseMatrix<float>& matrix, const float scalar)
+    {
+        AddUV(mesh, CreateSlotTarget(mesh, pattern, matrix), scalar);
     }
 
     void Add_Vector_U_F(const Geometry::Mesh2D& mesh, ColumnVector<float>& column, const std::function<float(Geometry::Vertex2F)>& sourceF)
@@ -85,8 +229,7 @@ namespace FemAssembler
             const Geometry::Vertex2F vertex1 = mesh.Vertices[element.J];
             const Geometry::Vertex2F vertex2 = mesh.Vertices[element.K];
 
-            Matrix<float> jacobian = Jacobian(vertex0, vertex1, vertex2);
-            const float detJ = Matrix<float>::Determinant(jacobian(0, 0), jacobian(0, 1), jacobian(1, 0), jacobian(1, 1)); 
+            const float detJ = Jacobian(vertex0, vertex1, vertex2).Determinant();
 
             const float f0 = sourceF(vertex0) / 24;
             const float f1 = sourceF(vertex1) / 24;
@@ -115,34 +258,33 @@ namespace FemAssembler
 
     void ApplyEssentialBoundaryCondition(const Geometry::Mesh2D& mesh, Matrix<float>& matrix, ColumnVector<float>& column, const std::function<bool(Geometry::Vertex2F, float& output)>& essentialBoundaryFunc)
     {
-        std::unordered_set<unsigned int> boundaryIndices;
-        for (const auto& boundaryElement : mesh.Boundary)
+        for (const unsigned int boundaryIndex : GetEssentialBoundaryIndices(mesh, column, essentialBoundaryFunc))
         {
-            boundaryIndices.insert(boundaryElement.I);
-            boundaryIndices.insert(boundaryElement.J);
-        }
-
-        for (const unsigned int boundaryIndex : boundaryIndices)
-        {
-            const Geometry::Vertex2F vertex0 = mesh.Vertices[boundaryIndex];
-            float value = 0;
-
-            if (!essentialBoundaryFunc(vertex0, value))
-                continue;
-
             for (size_t j = 0; j < matrix.GetColumnCount(); j++)
             {
                 matrix(boundaryIndex, j) = 0.0f;
             }
 
             matrix(boundaryIndex, boundaryIndex) = 1.0f;
-            column[boundaryIndex] = value;
         }
     }
 
-    Matrix<float> Jacobian(const Geometry::Vertex2F vertex1, const Geometry::Vertex2F vertex2, const Geometry::Vertex2F vertex3)
+    void ApplyEssentialBoundaryCondition(const Geometry::Mesh2D& mesh, SparseMatrix<float>& matrix, ColumnVector<float>& column, const std::function<bool(Geometry::Vertex2F, float& output)>& essentialBoundaryFunc)
+    {
+        for (const unsigned int boundaryIndex : GetEssentialBoundaryIndices(mesh, column, essentialBoundaryFunc))
+        {
+            const size_t diagonal = matrix.FindIndex(boundaryIndex, boundaryIndex);
+            if (diagonal == matrix.GetNonZeroCount())
+                throw std::invalid_argument("Sparsity pattern has no diagonal");
+
+            std::fill(matrix.Values() + matrix.RowOffsets()[boundaryIndex], matrix.Values() + matrix.RowOffsets()[boundaryIndex + 1], 0.0f);
+            matrix.Values()[diagonal] = 1.0f;
+        }
+    }
+
+    SmallMatrix<float, 2, 2> Jacobian(const Geometry::Vertex2F vertex1, const Geometry::Vertex2F vertex2, const Geometry::Vertex2F vertex3)
     {
-        return Matrix<float>({{vertex2.X - vertex1.X, vertex3.X - vertex1.X},
-                              {vertex2.Y - vertex1.Y, vertex3.Y - vertex1.Y}});
+        return SmallMatrix<float, 2, 2>(vertex2.X - vertex1.X, vertex3.X - vertex1.X,
+                                        vertex2.Y - vertex1.Y, vertex3.Y - vertex1.Y);
     }
 }
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include <Geometry/Structures/Mesh2D.hpp>
 #include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SmallMatrix.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
+#include <array>
 #include <functional>
+#include <vector>
 
 namespace FemAssembler
 {
@@ -12,9 +16,31 @@ namespace FemAssembler
     LinearAlgebra::ColumnVector<float> InitializeVector(const Geometry::Mesh2D& mesh);
     LinearAlgebra::ColumnVector<float> InitializeVector(const Geometry::Mesh2D& mesh, const VertexValueFunc& value);
 
+    /// <summary>
+    /// CSR sparsity pattern of the P1 elements of mesh.Interior, computed once per mesh. ElementSlots[e][3 * a + b] is
+    /// the position in SparseMatrix::Values() of (vertex a, vertex b) of element e, thus the sparse assembly adds the
+    /// element contributions straight into their slots, without searching the rows.
+    /// </summary>
+    struct SparsePattern
+    {
+        size_t VertexCount = 0;
+        std::vector<LinearAlgebra::SparseIndex> RowOffsets;
+        std::vector<LinearAlgebra::SparseIndex> ColumnIndices;
+        std::vector<std::array<LinearAlgebra::SparseIndex, 9>> ElementSlots;
+    };
+
+    SparsePattern CreateSparsePattern(const Geometry::Mesh2D& mesh);
+
+    /// <summary>
+    /// Zero matrix with the sparsity pattern, about 7 nonzeros per row for a P1 mesh instead of a dense N x N matrix.
+    /// </summary>
+    LinearAlgebra::SparseMatrix<float> InitializeSparseMatrix(const SparsePattern& pattern);
+
     void Add_Matrix_NablaA_NablaV(const Geometry::Mesh2D& mesh, LinearAlgebra::Matrix<float>& matrix, float scalar);
+    void Add_Matrix_NablaA_NablaV(const Geometry::Mesh2D& mesh, const SparsePattern& pattern, LinearAlgebra::SparseMatrix<float>& matrix, float scalar);
 
     void Add_Matrix_U_V(const Geometry::Mesh2D& mesh, LinearAlgebra::Matrix<float>& matrix, float scalar);
+    void Add_Matrix_U_V(const Geometry::Mesh2D& mesh, const SparsePattern& pattern, LinearAlgebra::SparseMatrix<float>& matrix, float scalar);
 
     void Add_Vector_U_F(const Geometry::Mesh2D& mesh, LinearAlgebra::ColumnVector<float>& column, const std::function<float(Geometry::Vertex2F)>& sourceF);
 
@@ -22,5 +48,8 @@ namespace FemAssembler
 
     void ApplyEssentialBoundaryCondition(const Geometry::Mesh2D& mesh, LinearAlgebra::Matrix<float>& matrix, LinearAlgebra::ColumnVector<float>& column, const std::function<bool(Geometry::Vertex2F, float& output)>& essentialBoundaryFunc);
 
-    LinearAlgebra::Matrix<float> Jacobian(Geometry::Vertex2F vertex1, Geometry::Vertex2F vertex2, Geometry::Vertex2F vertex3);
+    // Replaces the rows of the Dirichlet vertices by identity rows, in O(nnz) of those rows
+    void ApplyEssentialBoundaryCondition(const Geometry::Mesh2D& mesh, LinearAlgebra::SparseMatrix<float>& matrix, LinearAlgebra::ColumnVector<float>& column, const std::function<bool(Geometry::Vertex2F, float& output)>& essentialBoundaryFunc);
+
+    LinearAlgebra::SmallMatrix<float, 2, 2> Jacobian(Geometry::Vertex2F vertex1, Geometry::Vertex2F vertex2, Geometry::Vertex2F vertex3);
 };
\ No newline at end of file
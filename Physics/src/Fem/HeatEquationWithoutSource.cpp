@@ -1,21 +1,102 @@
 #include "HeatEquationWithoutSource.hpp"
 #include "FemAssembler.hpp"
-#include <LinearAlgebra/FactorizationLU.hpp>
+#include <stdexcept>
+
+namespace
+{
+    LinearAlgebra::SparseMatrix<float> AssembleMassMatrix(const Geometry::Mesh2D& mesh, const FemAssembler::SparsePattern& pattern)
+    {
+        LinearAlgebra::SparseMatrix<float> massMatrix = FemAssembler::InitializeSparseMatrix(pattern);
+        FemAssembler::Add_Matrix_U_V(mesh, pattern, massMatrix, 1.0f);
+        return massMatrix;
+    }
+
+    LinearAlgebra::SparseMatrix<float> AssembleStiffnessMatrix(const Geometry::Mesh2D& mesh, const FemAssembler::SparsePattern& pattern, const float k)
+    {
+        LinearAlgebra::SparseMatrix<float> stiffnessMatrix = FemAssembler::InitializeSparseMatrix(pattern);
+        FemAssembler::Add_Matrix_NablaA_NablaV(mesh, pattern, stiffnessMatrix, 1.0f * k);
+        return stiffnessMatrix;
+    }
+}
 
 HeatEquationWithoutSource::HeatEquationWithoutSource(const Geometry::Mesh2D& mesh, const float k, const float dt, const FemAssembler::VertexValueFunc& initialValues)
+    : HeatEquationWithoutSource(mesh, {}, k, dt, initialValues)
+{
+}
+
+HeatEquationWithoutSource::HeatEquationWithoutSource(const Geometry::RectangularMeshHierarchy& hierarchy, const float k, const float dt,
+                                                     const FemAssembler::VertexValueFunc& initialValues, const HeatEquationSolver solver)
+    : HeatEquationWithoutSource(hierarchy.Meshes.at(0),
+                                solver == HeatEquationSolver::MultigridConjugateGradient ? hierarchy.Prolongations : std::vector<LinearAlgebra::SparseMatrix<float>>(),
+                                k, dt, initialValues)
+{
+}
+
+HeatEquationWithoutSource::HeatEquationWithoutSource(const Geometry::Mesh2D& mesh, const std::vector<LinearAlgebra::SparseMatrix<float>>& prolongations,
+                                                     const float k, const float dt, const FemAssembler::VertexValueFunc& initialValues)
     : m_mesh(mesh), m_k(k), m_dt(dt), m_time(0),
-      m_massMatrix(FemAssembler::InitializeMatrix(mesh)),
-      m_stiffnessMatrix(FemAssembler::InitializeMatrix(mesh)),
-      m_currentSolution(FemAssembler::InitializeVector(mesh, initialValues))
+      m_pattern(FemAssembler::CreateSparsePattern(mesh)),
+      m_massMatrix(AssembleMassMatrix(mesh, m_pattern)),
+      m_stiffnessMatrix(AssembleStiffnessMatrix(mesh, m_pattern, k)),
+      m_currentSolution(FemAssembler::InitializeVector(mesh, initialValues)),
+      m_prolongations(prolongations),
+      m_solver(mesh.Vertices.size(), {100, 1e-6})
 {
-    FemAssembler::Add_Matrix_U_V(mesh, m_massMatrix, 1.0f);
-    FemAssembler::Add_Matrix_NablaA_NablaV(mesh, m_stiffnessMatrix, 1.0f * m_k);
+    SetupSystem(dt);
+}
+
+LinearAlgebra::SparseMatrix<float> HeatEquationWithoutSource::AssembleSystemMatrix(const float dt) const
+{
+    // M and K share their pattern, thus M + dt * K is summed slot by slot
+    LinearAlgebra::SparseMatrix<float> systemMatrix = m_massMatrix;
+    for (size_t k = 0; k < systemMatrix.GetNonZeroCount(); k++)
+        systemMatrix.Values()[k] += dt * m_stiffnessMatrix.Values()[k];
+    return systemMatrix;
+}
+
+void HeatEquationWithoutSource::SetupSystem(const float dt)
+{
+    m_systemMatrix = AssembleSystemMatrix(dt);
+    if (m_prolongations.empty())
+    {
+        // M and K are symmetric, and M + dt * K is positive definite. Its pattern does not depend on dt, thus the
+        // nested dissection and symbolic analysis are only computed for the first time step size.
+        if (m_systemFactorization.has_value())
+        {
+            m_systemFactorization->Factorize(m_systemMatrix);
+            return;
+        }
+        LinearAlgebra::Factorization::SparseCholeskyAnalysis analysis(m_systemMatrix, LinearAlgebra::Ordering::NestedDissection(m_systemMatrix, m_mesh.Vertices));
+        m_systemFactorization.emplace(std::move(analysis), m_systemMatrix, 1e-12f);
+        return;
+    }
+
+    // The Galerkin coarse operators of M + dt * K equal those assembled on the coarse meshes, as the meshes are nested
+    m_multigrid.emplace(m_systemMatrix, m_prolongations);
+}
+
+void HeatEquationWithoutSource::SetTimeStep(const float dt)
+{
+    if (dt == m_dt)
+        return;
+
+    SetupSystem(dt);
+    m_dt = dt;
 }
 
 void HeatEquationWithoutSource::SolveNextTimeStep()
 {
-    m_currentSolution =
-        LinearAlgebra::Factorization::LUSolve(m_massMatrix + m_stiffnessMatrix * m_dt, 
-            m_massMatrix * m_currentSolution, 1e-6f);
+    // M + dt * K is factorized once per time step size, a step only costs the triangular solves. With multigrid, the
+    // previous solution is the initial guess, which is close for small time steps.
+    const LinearAlgebra::ColumnVector<float> rhs = m_massMatrix * m_currentSolution;
+    if (m_systemFactorization.has_value())
+    {
+        m_currentSolution = rhs;
+        m_systemFactorization->SolveInPlace(m_currentSolution);
+    }
+    else if (!m_solver.Solve(m_systemMatrix, rhs, m_currentSolution, *m_multigrid).Converged)
+    {
+        throw std::runtime_error("Conjugate gradients did not converge");
+    }
     m_time += m_dt;
 }
@@ -1,12 +1,35 @@
 #pragma once
 
+#include <Geometry/MeshHierarchy.hpp>
 #include <Geometry/Structures/Mesh2D.hpp>
 #include <Geometry/Structures/Vertex.hpp>
-#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/ConjugateGradient.hpp>
+#include <LinearAlgebra/GeometricMultigrid.hpp>
+#include <LinearAlgebra/SparseCholesky.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
 #include <LinearAlgebra/VectorBase.hpp>
 #include <functional>
+#include <optional>
 #include "FemAssembler.hpp"
 
+/// <summary>
+/// Solver of the linear system M + dt * K of every time step.
+/// </summary>
+enum class HeatEquationSolver
+{
+    /// <summary>
+    /// Sparse Cholesky factorization, refactorized when the time step size changes. A step only costs the triangular
+    /// solves, which is the fastest for a fixed time step size.
+    /// </summary>
+    SparseCholesky,
+
+    /// <summary>
+    /// Conjugate gradients, preconditioned by geometric multigrid on a mesh hierarchy. Costs O(n) per step, without
+    /// the memory of the factor, which suits large meshes or frequently changing time step sizes.
+    /// </summary>
+    MultigridConjugateGradient
+};
+
 /// <summary>
 /// Helmholtz equation with source
 /// dT/dt = k\nabla^2T
@@ -17,19 +40,50 @@ class HeatEquationWithoutSource
 public:
     HeatEquationWithoutSource(const Geometry::Mesh2D& mesh, float k, float dt, const FemAssembler::VertexValueFunc& initialValues);
 
+    /// <summary>
+    /// Problem on the finest mesh of the hierarchy. The coarser meshes are only used by the
+    /// MultigridConjugateGradient solver.
+    /// </summary>
+    HeatEquationWithoutSource(const Geometry::RectangularMeshHierarchy& hierarchy, float k, float dt, const FemAssembler::VertexValueFunc& initialValues,
+                              HeatEquationSolver solver = HeatEquationSolver::SparseCholesky);
+
     const Geometry::Mesh2D& GetGraph() const { return m_mesh; }
     void SolveNextTimeStep();
 
+    /// <summary>
+    /// Changes the time step size of the following steps, which refactorizes the system matrix M + dt * K, reusing the
+    /// symbolic analysis of its pattern, or rebuilds its multigrid hierarchy.
+    /// </summary>
+    void SetTimeStep(float dt);
+    float GetTimeStep() const { return m_dt; }
+
     const LinearAlgebra::ColumnVector<float>& CurrentSolution() const { return m_currentSolution; }
 
     float CurrentTime() const { return m_time; }
 
+private:
+    HeatEquationWithoutSource(const Geometry::Mesh2D& mesh, const std::vector<LinearAlgebra::SparseMatrix<float>>& prolongations, float k, float dt,
+                              const FemAssembler::VertexValueFunc& initialValues);
+
+    LinearAlgebra::SparseMatrix<float> AssembleSystemMatrix(float dt) const;
+    void SetupSystem(float dt);
+
 private:
     Geometry::Mesh2D m_mesh;
     float m_k, m_dt;
     float m_time;
 
-    LinearAlgebra::Matrix<float> m_massMatrix;
-    LinearAlgebra::Matrix<float> m_stiffnessMatrix;
+    // M and K are assembled on the same sparsity pattern, thus their values line up
+    FemAssembler::SparsePattern m_pattern;
+    LinearAlgebra::SparseMatrix<float> m_massMatrix;
+    LinearAlgebra::SparseMatrix<float> m_stiffnessMatrix;
     LinearAlgebra::ColumnVector<float> m_currentSolution;
+
+    // The SparseCholesky solver factorizes M + dt * K, the MultigridConjugateGradient solver keeps the prolongations
+    // of the hierarchy, which are empty otherwise
+    std::vector<LinearAlgebra::SparseMatrix<float>> m_prolongations;
+    std::optional<LinearAlgebra::Factorization::SparseCholeskyFactorization<float>> m_systemFactorization;
+    LinearAlgebra::SparseMatrix<float> m_systemMatrix;
+    std::optional<LinearAlgebra::Iterative::GeometricMultigrid<float>> m_multigrid;
+    LinearAlgebra::Iterative::ConjugateGradientSolver<float> m_solver;
 };
@@ -1,8 +1,9 @@
 #pragma once
 
+#include <Geometry/MeshHierarchy.hpp>
 #include <Geometry/Structures/Mesh2D.hpp>
 #include <Geometry/Structures/Rectangle.hpp>
-#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
 #include <LinearAlgebra/VectorBase.hpp>
 
 /// <summary>
@@ -16,6 +17,11 @@ class HelmholtzEquationWithSourceFEM
 public:
     HelmholtzEquationWithSourceFEM(const Geometry::Rectangle& bounds, const Geometry::Mesh2D& mesh, float k);
 
+    /// <summary>
+    /// Problem on the finest mesh of the hierarchy, of which Solve uses the coarser meshes for geometric multigrid.
+    /// </summary>
+    HelmholtzEquationWithSourceFEM(const Geometry::Rectangle& bounds, const Geometry::RectangularMeshHierarchy& hierarchy, float k);
+
     LinearAlgebra::ColumnVector<float> Solve() const;
     float SourceFunction(Geometry::Vertex2F vertex) const;
     float AnalyticSolutionFunction(Geometry::Vertex2F position) const;
@@ -25,6 +31,7 @@ private:
     Geometry::Rectangle m_bounds;
     float m_k;
 
-    LinearAlgebra::Matrix<float> m_matrix;
+    LinearAlgebra::SparseMatrix<float> m_matrix;
     LinearAlgebra::ColumnVector<float> m_columnVector;
+    std::vector<LinearAlgebra::SparseMatrix<double>> m_prolongations;
 };
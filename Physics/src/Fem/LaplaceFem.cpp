@@ -1,13 +1,17 @@
 #include "LaplaceFem.hpp"
 #include "FemAssembler.hpp"
-#include <LinearAlgebra/FactorizationLU.hpp>
+#include <LinearAlgebra/BiCGStab.hpp>
+#include <LinearAlgebra/Conversion.hpp>
+#include <LinearAlgebra/GeometricMultigrid.hpp>
+#include <stdexcept>
 
 LaplaceFem::LaplaceFem(const Geometry::Rectangle& bounds, const Geometry::Mesh2D& mesh)
     : m_mesh(mesh), m_bounds(bounds),
-      m_matrix(FemAssembler::InitializeMatrix(mesh)),
       m_columnVector(FemAssembler::InitializeVector(mesh))
 {
-    FemAssembler::Add_Matrix_NablaA_NablaV(m_mesh, m_matrix, 1.0f);
+    const FemAssembler::SparsePattern pattern = FemAssembler::CreateSparsePattern(m_mesh);
+    m_matrix = FemAssembler::InitializeSparseMatrix(pattern);
+    FemAssembler::Add_Matrix_NablaA_NablaV(m_mesh, pattern, m_matrix, 1.0f);
 
     FemAssembler::AddNaturalBoundaryConditions(m_mesh, m_columnVector,
                                                [this](const Geometry::Vertex2F vertex1, const Geometry::Vertex2F vertex2)
@@ -18,6 +22,13 @@ LaplaceFem::LaplaceFem(const Geometry::Rectangle& bounds, const Geometry::Mesh2D
                                                   { return this->EssentialBoundaryCondition(vertex, value); });
 }
 
+LaplaceFem::LaplaceFem(const Geometry::Rectangle& bounds, const Geometry::RectangularMeshHierarchy& hierarchy)
+    : LaplaceFem(bounds, hierarchy.Meshes.at(0))
+{
+    for (const LinearAlgebra::SparseMatrix<float>& prolongation : hierarchy.Prolongations)
+        m_prolongations.push_back(LinearAlgebra::ConvertSparseMatrix<double>(prolongation));
+}
+
 float LaplaceFem::NaturalBoundaryCondition(const Geometry::Vertex2F vertex1, const Geometry::Vertex2F vertex2) const
 {
     // dU/dn = \nabla Y * n = (0, 1) * n
@@ -42,5 +53,19 @@ float LaplaceFem::AnalyticSolutionFunction(Geometry::Vertex2F position) const
 
 LinearAlgebra::ColumnVector<float> LaplaceFem::Solve() const
 {
-    return LinearAlgebra::Factorization::LUSolve(m_matrix, m_columnVector, 1e-5f);
+    // The essential boundary condition rows break the symmetry, thus BiCGStab instead of conjugate gradients.
+    // Solved in double, as float cannot attain a small residual for the O(h^2) right-hand side of fine meshes. With a
+    // mesh hierarchy, a multigrid V-cycle preconditions, for iteration counts independent of the mesh size.
+    using namespace LinearAlgebra::Iterative;
+    const LinearAlgebra::SparseMatrix<double> matrix = LinearAlgebra::ConvertSparseMatrix<double>(m_matrix);
+    const LinearAlgebra::ColumnVector<double> rhs = LinearAlgebra::ConvertVector<double>(m_columnVector);
+    IterativeReport report;
+    LinearAlgebra::ColumnVector<double> solution;
+    if (m_prolongations.empty())
+        solution = BiCGStab(matrix, rhs, IncompleteLUPreconditioner<double>(matrix), {5000, 1e-6}, &report);
+    else
+        solution = BiCGStab(matrix, rhs, GeometricMultigrid<double>(matrix, m_prolongations), {5000, 1e-6}, &report);
+    if (!report.Converged)
+        throw std::runtime_error("BiCGStab did not converge");
+    return LinearAlgebra::ConvertVector<float>(solution);
 }
@@ -1,8 +1,9 @@
 #pragma once
 
+#include <Geometry/MeshHierarchy.hpp>
 #include <Geometry/Structures/Mesh2D.hpp>
 #include <Geometry/Structures/Rectangle.hpp>
-#include <LinearAlgebra/Matrix.hpp>
+#include <LinearAlgebra/SparseMatrix.hpp>
 #include <LinearAlgebra/VectorBase.hpp>
 /// <summary>
 /// Very unnatural problem, but just to combine Dirichlet and Neumann Boundary conditions
@@ -15,6 +16,11 @@ class LaplaceFem
 public:
     LaplaceFem(const Geometry::Rectangle& bounds, const Geometry::Mesh2D& mesh);
 
+    /// <summary>
+    /// Problem on the finest mesh of the hierarchy, of which Solve uses the coarser meshes for geometric multigrid.
+    /// </summary>
+    LaplaceFem(const Geometry::Rectangle& bounds, const Geometry::RectangularMeshHierarchy& hierarchy);
+
     float NaturalBoundaryCondition(Geometry::Vertex2F vertex1, Geometry::Vertex2F vertex2) const;
 
     bool EssentialBoundaryCondition(Geometry::Vertex2F vertex1, float& result) const;
@@ -26,7 +32,7 @@ public:
 private:
     Geometry::Mesh2D m_mesh;
     Geometry::Rectangle m_bounds;
-    LinearAlgebra::Matrix<float> m_matrix;
+    LinearAlgebra::SparseMatrix<float> m_matrix;
     LinearAlgebra::ColumnVector<float> m_columnVector;
-
+    std::vector<LinearAlgebra::SparseMatrix<double>> m_prolongations;
 };
@@ -4,6 +4,7 @@
 #include "Drawables/DrawableMesh.hpp"
 #include "Drawables/DrawableTimeDependentFemMesh.hpp"
 #include <Geometry/MeshGenerator.hpp>
+#include <Geometry/MeshHierarchy.hpp>
 #include <Geometry/Structures/Rectangle.hpp>
 #include <Render/Drawable/ObjectScene.hpp>
 #include <algorithm>
@@ -12,13 +13,14 @@ template <typename T, typename... _Args>
 std::unique_ptr<Render::ObjectScene> CreateFemScene(_Args&&... __args)
 {
     using namespace Geometry;
+    // Powers of two cells, such that the meshes halve down to 2 x 2 cells for geometric multigrid
     Rectangle bounds(-0.75f, 0.75f, -0.75f, 0.75f);
-    Mesh2D mesh = CreateRectangularMesh(bounds, 10, 10);
-    T fem(bounds, mesh, std::forward<_Args>(__args)...);
+    const RectangularMeshHierarchy hierarchy = CreateRectangularMeshHierarchy(bounds, 16, 16);
+    T fem(bounds, hierarchy, std::forward<_Args>(__args)...);
     LinearAlgebra::ColumnVector<float> solution = fem.Solve();
 
     auto scene = std::make_unique<Render::ObjectScene>(true);
-    scene->AddObject(std::make_unique<DrawableMesh>(mesh, solution));
+    scene->AddObject(std::make_unique<DrawableMesh>(hierarchy.Meshes[0], solution));
     scene->AddObject(std::make_unique<Axis>());
     return scene;
 }
@@ -29,8 +31,8 @@ std::unique_ptr<Render::ObjectScene> CreateTimeFemScene(_Args&&... __args)
     using namespace Geometry;
 
     const Rectangle bounds(-0.75f, 0.75f, -0.75f, 0.75f);
-    Mesh2D mesh = CreateRectangularMesh(bounds, 25, 25);
-    T fem(mesh, std::forward<_Args>(__args)...);
+    const RectangularMeshHierarchy hierarchy = CreateRectangularMeshHierarchy(bounds, 32, 32);
+    T fem(hierarchy, std::forward<_Args>(__args)...);
     auto scene = std::make_unique<Render::ObjectScene>(true);
     auto drawableFem = std::make_unique<DrawableTimeDependentFemMesh>(fem);
     scene->AddObject(std::move(drawableFem));
@@ -14,8 +14,10 @@ int main()
     window.AddScene(CreateCircularScene());
     window.AddScene(CreateFemScene<HelmholtzEquationWithSourceFEM>(1));
     window.AddScene(CreateFemScene<LaplaceFem>());
+    // The time step size is fixed, thus every step is a pair of triangular solves with the sparse Cholesky factor
     window.AddScene(CreateTimeFemScene<HeatEquationWithoutSource>(0.05f, 1e-3f, [](const Geometry::Vertex2F vertex)
-                                                                  { return (vertex.Length() <= 0.25) ? 1.0f : 0.0f; }));
+                                                                  { return (vertex.Length() <= 0.25) ? 1.0f : 0.0f; },
+                                                                  HeatEquationSolver::SparseCholesky));
 
     size_t sceneIndex = 0;
     window.SetCallbackOnKey([&sceneIndex, &window](const Render::KeyEvent& eventArgs)